@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Hashing.hpp>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr size_t kDataSize = 256 * 1024;
+
+        eastl::vector<char> BuildData()
+        {
+            std::mt19937_64 random(0x5eed);
+            eastl::vector<char> data(kDataSize);
+            for (char& byte: data)
+            {
+                byte = static_cast<char>(random());
+            }
+            return data;
+        }
+
+        // Hashes consecutive slices of the data, so the item count is the number of bytes hashed. The size is known at
+        // compile time, as with most hashed keys and descriptors.
+        template <size_t Size, class Hash>
+        void RunHash(BenchmarkContext& _context, Hash&& _hash)
+        {
+            const eastl::vector<char> data = BuildData();
+            constexpr size_t sliceCount = kDataSize / Size;
+
+            _context.SetItemCount(sliceCount * Size);
+            _context.Measure([&]
+            {
+                u64 sum = 0;
+                for (size_t i = 0; i < sliceCount; i++)
+                {
+                    sum += _hash(data.data() + i * Size);
+                }
+                BenchmarkContext::DoNotOptimize(sum);
+            });
+        }
+
+        // Descriptor-like usage, fed field by field.
+        template <size_t Size>
+        u64 Murmur2Append(const char* _data)
+        {
+            u64 hash = Hashing::Hash64(_data, sizeof(u64));
+            for (size_t offset = sizeof(u64); offset < Size; offset += sizeof(u64))
+            {
+                hash = Hashing::Hash64Append(_data + offset, sizeof(u64), hash);
+            }
+            return hash;
+        }
+
+        template <size_t Size>
+        u64 Streaming(const char* _data)
+        {
+            Hashing::FastHasher hasher;
+            for (size_t offset = 0; offset < Size; offset += sizeof(u64))
+            {
+                u64 field;
+                memcpy(&field, _data + offset, sizeof(field));
+                hasher.Update(field);
+            }
+            return hasher.Digest();
+        }
+    }
+
+#define KE_HASHING_BENCHMARKS(size)                                                                                    \
+    KE_BENCHMARK(Hashing, Murmur2_##size)                                                                              \
+    {                                                                                                                  \
+        RunHash<size>(_context, [](const char* _data) { return Hashing::Hash64(_data, size); });                       \
+    }                                                                                                                  \
+    KE_BENCHMARK(Hashing, Fast_##size)                                                                                 \
+    {                                                                                                                  \
+        RunHash<size>(_context, [](const char* _data) { return Hashing::FastHash64(_data, size); });                   \
+    }
+
+    KE_HASHING_BENCHMARKS(8)
+    KE_HASHING_BENCHMARKS(32)
+    KE_HASHING_BENCHMARKS(128)
+    KE_HASHING_BENCHMARKS(512)
+    KE_HASHING_BENCHMARKS(4096)
+    KE_HASHING_BENCHMARKS(65536)
+
+#undef KE_HASHING_BENCHMARKS
+
+    KE_BENCHMARK(Hashing, Murmur2Append_Descriptor128) { RunHash<128>(_context, Murmur2Append<128>); }
+    KE_BENCHMARK(Hashing, Streaming_Descriptor128) { RunHash<128>(_context, Streaming<128>); }
+    KE_BENCHMARK(Hashing, Murmur2Append_Descriptor1024) { RunHash<1024>(_context, Murmur2Append<1024>); }
+    KE_BENCHMARK(Hashing, Streaming_Descriptor1024) { RunHash<1024>(_context, Streaming<1024>); }
+}
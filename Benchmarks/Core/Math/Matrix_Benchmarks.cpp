@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Matrix.hpp>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        constexpr size_t kMatrixCount = 1024;
+
+        // Diagonally dominant affine matrices, so they are always invertible, and inverses stay well conditioned.
+        template <class Matrix>
+        eastl::vector<Matrix> BuildMatrices(u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+            eastl::vector<Matrix> matrices(kMatrixCount);
+            for (Matrix& matrix: matrices)
+            {
+                for (size_t row = 0; row < 3; row++)
+                {
+                    for (size_t col = 0; col < 4; col++)
+                    {
+                        matrix.Get(row, col) = distribution(random) + (row == col ? 4.f : 0.f);
+                    }
+                }
+            }
+            return matrices;
+        }
+
+        // Applies `_operation` to pairs of matrices, so the item count is the number of operations.
+        template <class Matrix, class Operation>
+        void RunMatrixOperation(BenchmarkContext& _context, Operation&& _operation)
+        {
+            const eastl::vector<Matrix> lhs = BuildMatrices<Matrix>(0x5eed);
+            const eastl::vector<Matrix> rhs = BuildMatrices<Matrix>(0xbeef);
+            eastl::vector<decltype(_operation(lhs[0], rhs[0]))> results(kMatrixCount);
+
+            _context.SetItemCount(kMatrixCount);
+            _context.Measure([&]
+            {
+                for (size_t i = 0; i < kMatrixCount; i++)
+                {
+                    results[i] = _operation(lhs[i], rhs[i]);
+                }
+                BenchmarkContext::DoNotOptimize(results.data());
+            });
+        }
+    }
+
+    // Covers every instantiated layout, named as `<ScalarType>_<Simd|Scalar>_<RowMajor|ColumnMajor>`.
+#define KE_MATRIX44_BENCHMARKS(type, simdOptimal, rowMajor, name)                                                      \
+    KE_BENCHMARK(Matrix44, Multiply_##name)                                                                            \
+    {                                                                                                                  \
+        using Matrix = Matrix44Base<type, simdOptimal, rowMajor>;                                                      \
+        RunMatrixOperation<Matrix>(_context, [](const Matrix& _a, const Matrix& _b) { return _a * _b; });              \
+    }                                                                                                                  \
+    KE_BENCHMARK(Matrix44, MultiplyVector_##name)                                                                      \
+    {                                                                                                                  \
+        using Matrix = Matrix44Base<type, simdOptimal, rowMajor>;                                                      \
+        RunMatrixOperation<Matrix>(_context, [](const Matrix& _a, const Matrix& _b) { return _a * _b.m_vectors[0]; }); \
+    }                                                                                                                  \
+    KE_BENCHMARK(Matrix44, Transposed_##name)                                                                          \
+    {                                                                                                                  \
+        using Matrix = Matrix44Base<type, simdOptimal, rowMajor>;                                                      \
+        RunMatrixOperation<Matrix>(_context, [](const Matrix& _a, const Matrix&) { return _a.Transposed(); });         \
+    }                                                                                                                  \
+    KE_BENCHMARK(Matrix44, Determinant_##name)                                                                         \
+    {                                                                                                                  \
+        using Matrix = Matrix44Base<type, simdOptimal, rowMajor>;                                                      \
+        RunMatrixOperation<Matrix>(_context, [](const Matrix& _a, const Matrix&) { return _a.Determinant(); });        \
+    }                                                                                                                  \
+    KE_BENCHMARK(Matrix44, Inverse_##name)                                                                             \
+    {                                                                                                                  \
+        using Matrix = Matrix44Base<type, simdOptimal, rowMajor>;                                                      \
+        RunMatrixOperation<Matrix>(_context, [](const Matrix& _a, const Matrix&) { return _a.Inverse(); });            \
+    }
+
+    KE_MATRIX44_BENCHMARKS(float, false, true, Float_Scalar_RowMajor)
+    KE_MATRIX44_BENCHMARKS(float, false, false, Float_Scalar_ColumnMajor)
+    KE_MATRIX44_BENCHMARKS(float, true, true, Float_Simd_RowMajor)
+    KE_MATRIX44_BENCHMARKS(float, true, false, Float_Simd_ColumnMajor)
+    KE_MATRIX44_BENCHMARKS(double, false, true, Double_Scalar_RowMajor)
+    KE_MATRIX44_BENCHMARKS(double, false, false, Double_Scalar_ColumnMajor)
+    KE_MATRIX44_BENCHMARKS(double, true, true, Double_Simd_RowMajor)
+    KE_MATRIX44_BENCHMARKS(double, true, false, Double_Simd_ColumnMajor)
+
+#undef KE_MATRIX44_BENCHMARKS
+}
@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Matrix.hpp>
+#include <KryneEngine/Core/Math/Quaternion.hpp>
+#include <KryneEngine/Core/Math/RotationConversion.hpp>
+#include <KryneEngine/Core/Math/Vector.hpp>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        constexpr size_t kRotationCount = 4096;
+
+        template <class T>
+        eastl::vector<QuaternionBase<T>> BuildRotations(u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            std::uniform_real_distribution<T> distribution(-1, 1);
+
+            eastl::vector<QuaternionBase<T>> rotations(kRotationCount);
+            for (QuaternionBase<T>& rotation: rotations)
+            {
+                const T w = distribution(random);
+                const T x = distribution(random);
+                const T y = distribution(random);
+                const T z = distribution(random);
+                rotation = QuaternionBase<T>(w, x, y, z);
+                rotation.Normalize();
+            }
+            return rotations;
+        }
+
+        // Also used as Euler angles, hence the range.
+        template <class Vector3>
+        eastl::vector<Vector3> BuildVectors(u32 _seed)
+        {
+            using T = typename Vector3::ScalarType;
+            std::mt19937 random(_seed);
+            std::uniform_real_distribution<T> distribution(-std::numbers::pi_v<T>, std::numbers::pi_v<T>);
+
+            eastl::vector<Vector3> vectors(kRotationCount);
+            for (Vector3& vector: vectors)
+            {
+                vector = Vector3(distribution(random), distribution(random), distribution(random));
+            }
+            return vectors;
+        }
+
+        template <class Matrix33>
+        eastl::vector<Matrix33> BuildRotationMatrices(u32 _seed)
+        {
+            using T = typename Matrix33::ScalarType;
+            const eastl::vector<QuaternionBase<T>> rotations = BuildRotations<T>(_seed);
+
+            eastl::vector<Matrix33> matrices(kRotationCount);
+            for (size_t i = 0; i < kRotationCount; i++)
+            {
+                matrices[i] = ToMatrix33<Matrix33>(rotations[i]);
+            }
+            return matrices;
+        }
+
+        // Applies `_operation` to pairs of inputs, so the item count is the number of operations.
+        template <class Lhs, class Rhs, class Operation>
+        void RunOperation(
+            BenchmarkContext& _context,
+            const eastl::vector<Lhs>& _lhs,
+            const eastl::vector<Rhs>& _rhs,
+            Operation&& _operation)
+        {
+            eastl::vector<decltype(_operation(_lhs[0], _rhs[0]))> results(kRotationCount);
+
+            _context.SetItemCount(kRotationCount);
+            _context.Measure([&]
+            {
+                for (size_t i = 0; i < kRotationCount; i++)
+                {
+                    results[i] = _operation(_lhs[i], _rhs[i]);
+                }
+                BenchmarkContext::DoNotOptimize(results.data());
+            });
+        }
+
+        template <class T>
+        void RunMultiply(BenchmarkContext& _context)
+        {
+            RunOperation(
+                _context,
+                BuildRotations<T>(0x5eed),
+                BuildRotations<T>(0xbeef),
+                [](const QuaternionBase<T>& _a, const QuaternionBase<T>& _b) { return _a * _b; });
+        }
+
+        template <class T>
+        void RunNormalize(BenchmarkContext& _context)
+        {
+            RunOperation(
+                _context,
+                BuildRotations<T>(0x5eed),
+                BuildRotations<T>(0xbeef),
+                [](QuaternionBase<T> _a, const QuaternionBase<T>&) { return _a.Normalize(); });
+        }
+
+        template <class Vector3>
+        void RunApplyTo(BenchmarkContext& _context)
+        {
+            using T = typename Vector3::ScalarType;
+            RunOperation(
+                _context,
+                BuildRotations<T>(0x5eed),
+                BuildVectors<Vector3>(0xbeef),
+                [](const QuaternionBase<T>& _rotation, const Vector3& _vector) { return _rotation.ApplyTo(_vector); });
+        }
+
+        template <class Vector3>
+        void RunFromEulerAngles(BenchmarkContext& _context)
+        {
+            using T = typename Vector3::ScalarType;
+            const eastl::vector<Vector3> angles = BuildVectors<Vector3>(0x5eed);
+            RunOperation(
+                _context,
+                angles,
+                angles,
+                [](const Vector3& _angles, const Vector3&)
+                {
+                    return FromEulerAngles<T, T, Vector3::kSimdOptimal>(_angles);
+                });
+        }
+
+        template <class Vector3>
+        void RunQuaternionToEulerAngles(BenchmarkContext& _context)
+        {
+            using T = typename Vector3::ScalarType;
+            const eastl::vector<QuaternionBase<T>> rotations = BuildRotations<T>(0x5eed);
+            RunOperation(
+                _context,
+                rotations,
+                rotations,
+                [](const QuaternionBase<T>& _rotation, const QuaternionBase<T>&)
+                {
+                    return ToEulerAngles<Vector3>(_rotation);
+                });
+        }
+
+        template <class Matrix33>
+        void RunToMatrix33(BenchmarkContext& _context)
+        {
+            using T = typename Matrix33::ScalarType;
+            const eastl::vector<QuaternionBase<T>> rotations = BuildRotations<T>(0x5eed);
+            RunOperation(
+                _context,
+                rotations,
+                rotations,
+                [](const QuaternionBase<T>& _rotation, const QuaternionBase<T>&)
+                {
+                    return ToMatrix33<Matrix33>(_rotation);
+                });
+        }
+
+        template <class Matrix33>
+        void RunMatrixToEulerAngles(BenchmarkContext& _context)
+        {
+            using T = typename Matrix33::ScalarType;
+            using Vector3 = Vector3Base<T, Matrix33::kSimdOptimal>;
+            const eastl::vector<Matrix33> matrices = BuildRotationMatrices<Matrix33>(0x5eed);
+            RunOperation(
+                _context,
+                matrices,
+                matrices,
+                [](const Matrix33& _matrix, const Matrix33&) { return ToEulerAngles<Vector3>(_matrix); });
+        }
+    }
+
+    KE_BENCHMARK(Quaternion, Multiply_Float) { RunMultiply<float>(_context); }
+    KE_BENCHMARK(Quaternion, Multiply_Double) { RunMultiply<double>(_context); }
+    KE_BENCHMARK(Quaternion, Normalize_Float) { RunNormalize<float>(_context); }
+    KE_BENCHMARK(Quaternion, Normalize_Double) { RunNormalize<double>(_context); }
+
+#define KE_VECTOR_ROTATION_BENCHMARKS(type, name)                                                                      \
+    KE_BENCHMARK(Quaternion, ApplyTo_##name) { RunApplyTo<type>(_context); }                                           \
+    KE_BENCHMARK(RotationConversion, FromEulerAngles_##name) { RunFromEulerAngles<type>(_context); }                   \
+    KE_BENCHMARK(RotationConversion, QuaternionToEulerAngles_##name) { RunQuaternionToEulerAngles<type>(_context); }
+
+    KE_VECTOR_ROTATION_BENCHMARKS(float3, Float_Scalar)
+    KE_VECTOR_ROTATION_BENCHMARKS(float3_simd, Float_Simd)
+    KE_VECTOR_ROTATION_BENCHMARKS(double3, Double_Scalar)
+    KE_VECTOR_ROTATION_BENCHMARKS(double3_simd, Double_Simd)
+
+#undef KE_VECTOR_ROTATION_BENCHMARKS
+
+    // Same naming as the Matrix44 benchmarks: `<ScalarType>_<Simd|Scalar>_<RowMajor|ColumnMajor>`.
+#define KE_MATRIX_ROTATION_BENCHMARKS(type, simdOptimal, rowMajor, name)                                               \
+    KE_BENCHMARK(RotationConversion, ToMatrix33_##name)                                                                \
+    {                                                                                                                  \
+        RunToMatrix33<Matrix33Base<type, simdOptimal, rowMajor>>(_context);                                            \
+    }                                                                                                                  \
+    KE_BENCHMARK(RotationConversion, MatrixToEulerAngles_##name)                                                       \
+    {                                                                                                                  \
+        RunMatrixToEulerAngles<Matrix33Base<type, simdOptimal, rowMajor>>(_context);                                   \
+    }
+
+    KE_MATRIX_ROTATION_BENCHMARKS(float, false, true, Float_Scalar_RowMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(float, false, false, Float_Scalar_ColumnMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(float, true, true, Float_Simd_RowMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(float, true, false, Float_Simd_ColumnMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(double, false, true, Double_Scalar_RowMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(double, false, false, Double_Scalar_ColumnMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(double, true, true, Double_Simd_RowMajor)
+    KE_MATRIX_ROTATION_BENCHMARKS(double, true, false, Double_Simd_ColumnMajor)
+
+#undef KE_MATRIX_ROTATION_BENCHMARKS
+}
@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Vector.hpp>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        // Small enough for all operands to stay in L1/L2, so the arithmetic is measured rather than the memory.
+        constexpr size_t kVectorCount = 4096;
+
+        template <class Vector>
+        eastl::vector<Vector> BuildVectors(u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+            // SIMD optimal 3D vectors are padded, so the component count can't be deduced from their size.
+            constexpr size_t componentCount = requires(Vector _vector) { _vector.w; } ? 4 : 3;
+
+            eastl::vector<Vector> vectors(kVectorCount);
+            for (Vector& vector: vectors)
+            {
+                for (size_t i = 0; i < componentCount; i++)
+                {
+                    vector[i] = distribution(random);
+                }
+            }
+            return vectors;
+        }
+
+        // Applies `_operation` to pairs of vectors, so the item count is the number of operations.
+        template <class Vector, class Operation>
+        void RunVectorOperation(BenchmarkContext& _context, Operation&& _operation)
+        {
+            const eastl::vector<Vector> lhs = BuildVectors<Vector>(0x5eed);
+            const eastl::vector<Vector> rhs = BuildVectors<Vector>(0xbeef);
+            eastl::vector<decltype(_operation(lhs[0], rhs[0]))> results(kVectorCount);
+
+            _context.SetItemCount(kVectorCount);
+            _context.Measure([&]
+            {
+                for (size_t i = 0; i < kVectorCount; i++)
+                {
+                    results[i] = _operation(lhs[i], rhs[i]);
+                }
+                BenchmarkContext::DoNotOptimize(results.data());
+            });
+        }
+    }
+
+#define KE_VECTOR_BENCHMARKS(type, name)                                                                               \
+    KE_BENCHMARK(Vector, Add_##name)                                                                                   \
+    {                                                                                                                  \
+        RunVectorOperation<type>(_context, [](const type& _a, const type& _b) { return _a + _b; });                    \
+    }                                                                                                                  \
+    KE_BENCHMARK(Vector, MultiplyAdd_##name)                                                                           \
+    {                                                                                                                  \
+        RunVectorOperation<type>(_context, [](const type& _a, const type& _b) { return _a * _b + _a; });               \
+    }                                                                                                                  \
+    KE_BENCHMARK(Vector, Normalized_##name)                                                                            \
+    {                                                                                                                  \
+        RunVectorOperation<type>(_context, [](const type& _a, const type&) { return _a.Normalized(); });               \
+    }
+
+#define KE_VECTOR3_BENCHMARKS(type, name)                                                                              \
+    KE_VECTOR_BENCHMARKS(type, name)                                                                                   \
+    KE_BENCHMARK(Vector, Dot_##name)                                                                                   \
+    {                                                                                                                  \
+        RunVectorOperation<type>(_context, [](const type& _a, const type& _b) { return type::Dot(_a, _b); });          \
+    }                                                                                                                  \
+    KE_BENCHMARK(Vector, Cross_##name)                                                                                 \
+    {                                                                                                                  \
+        RunVectorOperation<type>(                                                                                      \
+            _context,                                                                                                  \
+            [](const type& _a, const type& _b) { return type::CrossProduct(_a, _b); });                                \
+    }
+
+#define KE_VECTOR4_BENCHMARKS(type, name)                                                                              \
+    KE_VECTOR_BENCHMARKS(type, name)                                                                                   \
+    KE_BENCHMARK(Vector, Dot_##name)                                                                                   \
+    {                                                                                                                  \
+        RunVectorOperation<type>(_context, [](const type& _a, const type& _b) { return Dot(_a, _b); });                \
+    }
+
+    KE_VECTOR3_BENCHMARKS(float3, Float3_Scalar)
+    KE_VECTOR3_BENCHMARKS(float3_simd, Float3_Simd)
+    KE_VECTOR3_BENCHMARKS(double3, Double3_Scalar)
+    KE_VECTOR3_BENCHMARKS(double3_simd, Double3_Simd)
+
+    KE_VECTOR4_BENCHMARKS(float4, Float4_Scalar)
+    KE_VECTOR4_BENCHMARKS(float4_simd, Float4_Simd)
+    KE_VECTOR4_BENCHMARKS(double4, Double4_Scalar)
+    KE_VECTOR4_BENCHMARKS(double4_simd, Double4_Simd)
+
+#undef KE_VECTOR4_BENCHMARKS
+#undef KE_VECTOR3_BENCHMARKS
+#undef KE_VECTOR_BENCHMARKS
+}
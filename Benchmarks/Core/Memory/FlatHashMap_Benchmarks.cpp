@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <EASTL/hash_map.h>
+#include <KryneEngine/Core/Common/StringHelpers.hpp>
+#include <KryneEngine/Core/Memory/Containers/FlatHashMap.inl>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr u32 kEntryCount = 100'000;
+
+        // Both maps are driven through the same small interface, so each benchmark body is written once.
+        template <class Key>
+        struct EastlMap
+        {
+            eastl::hash_map<Key, u64> m_map;
+
+            void Insert(const Key& _key, u64 _value) { m_map.insert({ _key, _value }); }
+            bool Erase(const Key& _key) { return m_map.erase(_key) != 0; }
+            void Clear() { m_map.clear(); }
+
+            [[nodiscard]] const u64* Find(const Key& _key) const
+            {
+                const auto it = m_map.find(_key);
+                return it == m_map.end() ? nullptr : &it->second;
+            }
+        };
+
+        template <class Key>
+        struct FlatMap
+        {
+            FlatHashMap<Key, u64> m_map;
+
+            void Insert(const Key& _key, u64 _value) { m_map.Insert(_key, _value); }
+            bool Erase(const Key& _key) { return m_map.Erase(_key); }
+            void Clear() { m_map.Clear(); }
+
+            [[nodiscard]] const u64* Find(const Key& _key) const
+            {
+                const auto it = m_map.Find(_key);
+                return it == m_map.end() ? nullptr : &it->second;
+            }
+        };
+
+        // Half of the keys are inserted, the other half is used for misses.
+        template <class Key>
+        eastl::vector<Key> BuildKeys()
+        {
+            std::mt19937_64 random(0x5eed);
+            eastl::vector<Key> keys;
+            keys.reserve(2 * kEntryCount);
+            for (u32 i = 0; i < 2 * kEntryCount; i++)
+            {
+                keys.push_back(Key(random()));
+            }
+            return keys;
+        }
+
+        template <class Map, class Key>
+        void RunInsert(BenchmarkContext& _context)
+        {
+            const eastl::vector<Key> keys = BuildKeys<Key>();
+            Map map;
+
+            _context.SetItemCount(kEntryCount);
+            _context.Measure([&]
+            {
+                map.Clear();
+                for (u32 i = 0; i < kEntryCount; i++)
+                {
+                    map.Insert(keys[i], i);
+                }
+            });
+        }
+
+        template <class Map, class Key>
+        void RunFind(BenchmarkContext& _context, bool _hit)
+        {
+            const eastl::vector<Key> keys = BuildKeys<Key>();
+            Map map;
+            for (u32 i = 0; i < kEntryCount; i++)
+            {
+                map.Insert(keys[i], i);
+            }
+
+            const u32 offset = _hit ? 0 : kEntryCount;
+            _context.SetItemCount(kEntryCount);
+            _context.Measure([&]
+            {
+                u64 sum = 0;
+                for (u32 i = 0; i < kEntryCount; i++)
+                {
+                    const u64* value = map.Find(keys[offset + i]);
+                    sum += value != nullptr ? *value : 1;
+                }
+                BenchmarkContext::DoNotOptimize(sum);
+            });
+        }
+
+        // Steady state churn, as with resource tables: each erase is followed by the insertion of a new key.
+        template <class Map, class Key>
+        void RunChurn(BenchmarkContext& _context)
+        {
+            const eastl::vector<Key> keys = BuildKeys<Key>();
+            Map map;
+            for (u32 i = 0; i < kEntryCount; i++)
+            {
+                map.Insert(keys[i], i);
+            }
+
+            _context.SetItemCount(kEntryCount);
+            _context.Measure([&]
+            {
+                // Two passes, so the map ends up with the keys it started with.
+                for (u32 i = 0; i < kEntryCount; i++)
+                {
+                    map.Erase(keys[i]);
+                    map.Insert(keys[kEntryCount + i], i);
+                }
+                for (u32 i = 0; i < kEntryCount; i++)
+                {
+                    map.Erase(keys[kEntryCount + i]);
+                    map.Insert(keys[i], i);
+                }
+            });
+        }
+    }
+
+#define KE_HASH_MAP_BENCHMARKS(keyName, Key, mapName, Map)                                                             \
+    KE_BENCHMARK(HashMap, Insert_##keyName##_##mapName) { RunInsert<Map<Key>, Key>(_context); }                         \
+    KE_BENCHMARK(HashMap, FindHit_##keyName##_##mapName) { RunFind<Map<Key>, Key>(_context, true); }                    \
+    KE_BENCHMARK(HashMap, FindMiss_##keyName##_##mapName) { RunFind<Map<Key>, Key>(_context, false); }                  \
+    KE_BENCHMARK(HashMap, Churn_##keyName##_##mapName) { RunChurn<Map<Key>, Key>(_context); }
+
+    KE_HASH_MAP_BENCHMARKS(U64, u64, Eastl, EastlMap)
+    KE_HASH_MAP_BENCHMARKS(U64, u64, Flat, FlatMap)
+    KE_HASH_MAP_BENCHMARKS(StringHash, StringHash, Eastl, EastlMap)
+    KE_HASH_MAP_BENCHMARKS(StringHash, StringHash, Flat, FlatMap)
+
+#undef KE_HASH_MAP_BENCHMARKS
+}
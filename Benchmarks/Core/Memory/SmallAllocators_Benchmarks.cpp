@@ -0,0 +1,269 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <thread>
+#include <KryneEngine/Core/Memory/Allocators/ConcurrentTlsfAllocator.hpp>
+#include <KryneEngine/Core/Memory/Allocators/SlabAllocator.hpp>
+#include <KryneEngine/Core/Memory/Allocators/TlsfAllocator.hpp>
+#include <KryneEngine/Core/Platform/StdAlloc.hpp>
+
+#include "Utils/Benchmark.hpp"
+
+namespace KryneEngine::Benchmarks
+{
+    namespace
+    {
+        constexpr size_t kHeapSize = 16 * 1024 * 1024;
+
+        class MallocAllocator final: public IAllocator
+        {
+        public:
+            void* Allocate(size_t _size, size_t _alignment) override
+            {
+                return _alignment == 0 ? StdAlloc::Malloc(_size) : StdAlloc::MemAlign(_size, _alignment);
+            }
+
+            void Free(void* _ptr, size_t) override
+            {
+                StdAlloc::Free(_ptr);
+            }
+        };
+
+        struct TraceOperation
+        {
+            u32 m_slot;
+            u32 m_size; // 0 for a free
+        };
+
+        struct Trace
+        {
+            eastl::vector<TraceOperation> m_operations;
+            u32 m_slotCount;
+        };
+
+        // FiberJob-like: batches of same-sized objects, allocated when jobs are batched and freed in order on completion.
+        Trace BuildJobChurnTrace()
+        {
+            constexpr u32 batchSize = 256;
+            constexpr u32 batchCount = 256;
+            constexpr u32 jobSize = 192;
+
+            Trace trace { .m_slotCount = batchSize };
+            for (u32 batch = 0; batch < batchCount; batch++)
+            {
+                for (u32 i = 0; i < batchSize; i++)
+                {
+                    trace.m_operations.push_back({ i, jobSize });
+                }
+                for (u32 i = 0; i < batchSize; i++)
+                {
+                    trace.m_operations.push_back({ i, 0 });
+                }
+            }
+            return trace;
+        }
+
+        // Container nodes: random interleaving of inserts and erases, with a live set of a few thousand nodes.
+        Trace BuildContainerNodesTrace()
+        {
+            constexpr u32 slotCount = 4096;
+            constexpr u32 operationCount = 200'000;
+            constexpr u32 nodeSizes[] = { 32, 48, 64 };
+
+            std::mt19937 random(0x5eed);
+            Trace trace { .m_slotCount = slotCount };
+            eastl::vector<bool> used(slotCount, false);
+            for (u32 i = 0; i < operationCount; i++)
+            {
+                const u32 slot = random() % slotCount;
+                trace.m_operations.push_back({ slot, used[slot] ? 0 : nodeSizes[random() % eastl::size(nodeSizes)] });
+                used[slot] = !used[slot];
+            }
+            for (u32 slot = 0; slot < slotCount; slot++)
+            {
+                if (used[slot])
+                {
+                    trace.m_operations.push_back({ slot, 0 });
+                }
+            }
+            return trace;
+        }
+
+        // Type-erased callable storage: mixed sizes, mostly short-lived.
+        Trace BuildFunctionStorageTrace()
+        {
+            constexpr u32 slotCount = 8;
+            constexpr u32 operationCount = 100'000;
+
+            std::mt19937 random(0xf00d);
+            Trace trace { .m_slotCount = slotCount };
+            for (u32 i = 0; i < operationCount; i++)
+            {
+                const u32 slot = i % slotCount;
+                if (i >= slotCount)
+                {
+                    trace.m_operations.push_back({ slot, 0 });
+                }
+                trace.m_operations.push_back({ slot, 16 + static_cast<u32>(random() % 15) * 16 });
+            }
+            for (u32 slot = 0; slot < slotCount; slot++)
+            {
+                trace.m_operations.push_back({ slot, 0 });
+            }
+            return trace;
+        }
+
+        void ReplayTrace(IAllocator* _allocator, const Trace& _trace, eastl::vector<eastl::pair<void*, u32>>& _slots)
+        {
+            for (const TraceOperation& operation: _trace.m_operations)
+            {
+                auto& [ptr, size] = _slots[operation.m_slot];
+                if (operation.m_size == 0)
+                {
+                    _allocator->Free(ptr, size);
+                }
+                else
+                {
+                    ptr = _allocator->Allocate(operation.m_size, 0);
+                    size = operation.m_size;
+                    *static_cast<u8*>(ptr) = static_cast<u8>(size);
+                }
+            }
+        }
+
+        void RunTrace(BenchmarkContext& _context, IAllocator* _allocator, const Trace& _trace)
+        {
+            eastl::vector<eastl::pair<void*, u32>> slots(_trace.m_slotCount);
+            _context.SetItemCount(_trace.m_operations.size());
+            _context.Measure([&] { ReplayTrace(_allocator, _trace, slots); });
+        }
+
+        enum class AllocatorType
+        {
+            Slab,
+            SlabThreadCache,
+            Tlsf,
+            ConcurrentTlsf,
+            Malloc,
+        };
+
+        template <class Func>
+        void RunWithAllocator(AllocatorType _type, const Func& _run)
+        {
+            switch (_type)
+            {
+                case AllocatorType::Slab:
+                case AllocatorType::SlabThreadCache:
+                {
+                    SlabAllocator* allocator = SlabAllocator::Create(
+                        AllocatorInstance(),
+                        kHeapSize,
+                        _type == AllocatorType::SlabThreadCache);
+                    _run(allocator);
+                    SlabAllocator::Destroy(allocator);
+                    break;
+                }
+                case AllocatorType::Tlsf:
+                {
+                    TlsfAllocator* allocator = TlsfAllocator::Create(AllocatorInstance(), kHeapSize);
+                    _run(allocator);
+                    TlsfAllocator::Destroy(allocator);
+                    break;
+                }
+                case AllocatorType::ConcurrentTlsf:
+                {
+                    ConcurrentTlsfAllocator* allocator = ConcurrentTlsfAllocator::Create(AllocatorInstance(), kHeapSize);
+                    _run(allocator);
+                    ConcurrentTlsfAllocator::Destroy(allocator);
+                    break;
+                }
+                case AllocatorType::Malloc:
+                {
+                    MallocAllocator allocator;
+                    _run(&allocator);
+                    break;
+                }
+            }
+        }
+
+        void RunSingleThreaded(BenchmarkContext& _context, AllocatorType _type, const Trace& _trace)
+        {
+            RunWithAllocator(_type, [&](IAllocator* _allocator)
+            {
+                RunTrace(_context, _allocator, _trace);
+            });
+        }
+
+        // Each thread replays the container nodes trace on its own slots, sharing the allocator.
+        void RunMultiThreaded(BenchmarkContext& _context, AllocatorType _type)
+        {
+            constexpr u32 threadCount = 4;
+            const Trace trace = BuildContainerNodesTrace();
+
+            RunWithAllocator(_type, [&](IAllocator* _allocator)
+            {
+                _context.SetItemCount(trace.m_operations.size() * threadCount);
+                _context.Measure([&]
+                {
+                    eastl::vector<std::thread> threads;
+                    for (u32 i = 0; i < threadCount; i++)
+                    {
+                        threads.emplace_back([&]
+                        {
+                            eastl::vector<eastl::pair<void*, u32>> slots(trace.m_slotCount);
+                            ReplayTrace(_allocator, trace, slots);
+                        });
+                    }
+                    for (std::thread& thread: threads)
+                    {
+                        thread.join();
+                    }
+                });
+            });
+        }
+    }
+
+#define KE_SMALL_ALLOCATORS_BENCHMARK(traceName, buildTrace, allocatorType)                                            \
+    KE_BENCHMARK(SmallAllocators, traceName##_##allocatorType)                                                          \
+    {                                                                                                                   \
+        RunSingleThreaded(_context, AllocatorType::allocatorType, buildTrace());                                        \
+    }
+
+#define KE_SMALL_ALLOCATORS_BENCHMARKS(traceName, buildTrace)                                                           \
+    KE_SMALL_ALLOCATORS_BENCHMARK(traceName, buildTrace, Slab)                                                          \
+    KE_SMALL_ALLOCATORS_BENCHMARK(traceName, buildTrace, SlabThreadCache)                                               \
+    KE_SMALL_ALLOCATORS_BENCHMARK(traceName, buildTrace, Tlsf)                                                          \
+    KE_SMALL_ALLOCATORS_BENCHMARK(traceName, buildTrace, Malloc)
+
+    KE_SMALL_ALLOCATORS_BENCHMARKS(JobChurn, BuildJobChurnTrace)
+    KE_SMALL_ALLOCATORS_BENCHMARKS(ContainerNodes, BuildContainerNodesTrace)
+    KE_SMALL_ALLOCATORS_BENCHMARKS(FunctionStorage, BuildFunctionStorageTrace)
+
+#undef KE_SMALL_ALLOCATORS_BENCHMARKS
+#undef KE_SMALL_ALLOCATORS_BENCHMARK
+
+    // TLSF isn't thread-safe, so the threaded trace compares against its concurrent variant.
+    KE_BENCHMARK(SmallAllocators, ContainerNodesThreaded_Slab)
+    {
+        RunMultiThreaded(_context, AllocatorType::Slab);
+    }
+
+    KE_BENCHMARK(SmallAllocators, ContainerNodesThreaded_SlabThreadCache)
+    {
+        RunMultiThreaded(_context, AllocatorType::SlabThreadCache);
+    }
+
+    KE_BENCHMARK(SmallAllocators, ContainerNodesThreaded_ConcurrentTlsf)
+    {
+        RunMultiThreaded(_context, AllocatorType::ConcurrentTlsf);
+    }
+
+    KE_BENCHMARK(SmallAllocators, ContainerNodesThreaded_Malloc)
+    {
+        RunMultiThreaded(_context, AllocatorType::Malloc);
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <EASTL/algorithm.h>
+#include <EASTL/string.h>
+
+namespace KryneEngine::Benchmarks
+{
+    const void* volatile BenchmarkContext::s_sink = nullptr;
+
+    namespace
+    {
+        struct RegisteredBenchmark
+        {
+            const char* m_group;
+            const char* m_name;
+            BenchmarkFunction m_function;
+        };
+
+        // Function-local static, to not depend on the static initialization order of the registrations.
+        eastl::vector<RegisteredBenchmark>& GetRegistry()
+        {
+            static eastl::vector<RegisteredBenchmark> registry;
+            return registry;
+        }
+
+        struct BenchmarkResult
+        {
+            eastl::string m_fullName;
+            u64 m_repetitionCount;
+            u64 m_itemCount;
+            double m_minNs;
+            double m_medianNs;
+            double m_meanNs;
+            double m_maxNs;
+            double m_stdDevNs;
+        };
+
+        BenchmarkResult ComputeResult(const RegisteredBenchmark& _benchmark, const BenchmarkContext& _context)
+        {
+            eastl::vector<u64> timings = _context.GetTimings();
+            eastl::sort(timings.begin(), timings.end());
+
+            BenchmarkResult result {
+                .m_fullName = eastl::string(_benchmark.m_group) + "." + _benchmark.m_name,
+                .m_repetitionCount = timings.size(),
+                .m_itemCount = _context.GetItemCount(),
+            };
+
+            if (timings.empty())
+            {
+                return result;
+            }
+
+            const size_t count = timings.size();
+            result.m_minNs = static_cast<double>(timings.front());
+            result.m_maxNs = static_cast<double>(timings.back());
+            result.m_medianNs = count % 2 == 1
+                ? static_cast<double>(timings[count / 2])
+                : 0.5 * static_cast<double>(timings[count / 2 - 1] + timings[count / 2]);
+
+            double sum = 0;
+            for (const u64 timing: timings)
+            {
+                sum += static_cast<double>(timing);
+            }
+            result.m_meanNs = sum / static_cast<double>(count);
+
+            double squaredDeviationSum = 0;
+            for (const u64 timing: timings)
+            {
+                const double deviation = static_cast<double>(timing) - result.m_meanNs;
+                squaredDeviationSum += deviation * deviation;
+            }
+            result.m_stdDevNs = std::sqrt(squaredDeviationSum / static_cast<double>(count));
+
+            return result;
+        }
+
+        bool WriteJson(const char* _path, const eastl::vector<BenchmarkResult>& _results)
+        {
+            FILE* file = fopen(_path, "w");
+            if (file == nullptr)
+            {
+                return false;
+            }
+
+            fprintf(file, "{\n  \"benchmarks\": [\n");
+            for (size_t i = 0; i < _results.size(); i++)
+            {
+                const BenchmarkResult& result = _results[i];
+                fprintf(
+                    file,
+                    "    {\"name\": \"%s\", \"repetitions\": %llu, \"items\": %llu, \"min_ns\": %.1f, "
+                    "\"median_ns\": %.1f, \"mean_ns\": %.1f, \"max_ns\": %.1f, \"stddev_ns\": %.1f, "
+                    "\"ns_per_item\": %.3f}%s\n",
+                    result.m_fullName.c_str(),
+                    static_cast<unsigned long long>(result.m_repetitionCount),
+                    static_cast<unsigned long long>(result.m_itemCount),
+                    result.m_minNs,
+                    result.m_medianNs,
+                    result.m_meanNs,
+                    result.m_maxNs,
+                    result.m_stdDevNs,
+                    result.m_medianNs / static_cast<double>(eastl::max<u64>(result.m_itemCount, 1)),
+                    i + 1 < _results.size() ? "," : "");
+            }
+            fprintf(file, "  ]\n}\n");
+            fclose(file);
+            return true;
+        }
+    }
+
+    BenchmarkRegistration::BenchmarkRegistration(const char* _group, const char* _name, BenchmarkFunction _function)
+    {
+        GetRegistry().push_back({ _group, _name, _function });
+    }
+
+    s32 RunBenchmarks(s32 _argc, const char** _argv)
+    {
+        const char* filter = nullptr;
+        const char* jsonPath = nullptr;
+        u32 repetitionCount = 10;
+        constexpr u32 warmupCount = 1;
+
+        for (s32 i = 1; i < _argc; i++)
+        {
+            if (strcmp(_argv[i], "--filter") == 0 && i + 1 < _argc)
+            {
+                filter = _argv[++i];
+            }
+            else if (strcmp(_argv[i], "--json") == 0 && i + 1 < _argc)
+            {
+                jsonPath = _argv[++i];
+            }
+            else if (strcmp(_argv[i], "--repetitions") == 0 && i + 1 < _argc)
+            {
+                repetitionCount = eastl::max(static_cast<u32>(strtoul(_argv[++i], nullptr, 10)), 1u);
+            }
+            else
+            {
+                fprintf(stderr, "Unknown argument '%s'\n", _argv[i]);
+                return 1;
+            }
+        }
+
+        eastl::vector<RegisteredBenchmark> benchmarks = GetRegistry();
+        eastl::sort(benchmarks.begin(), benchmarks.end(), [](const auto& _a, const auto& _b)
+        {
+            const s32 groupComparison = strcmp(_a.m_group, _b.m_group);
+            return groupComparison != 0 ? groupComparison < 0 : strcmp(_a.m_name, _b.m_name) < 0;
+        });
+
+        printf("%-56s %14s %14s %14s %12s\n", "Benchmark", "Median (ns)", "Min (ns)", "StdDev (ns)", "ns/item");
+
+        eastl::vector<BenchmarkResult> results;
+        for (const RegisteredBenchmark& benchmark: benchmarks)
+        {
+            const eastl::string fullName = eastl::string(benchmark.m_group) + "." + benchmark.m_name;
+            if (filter != nullptr && fullName.find(filter) == eastl::string::npos)
+            {
+                continue;
+            }
+
+            BenchmarkContext context(repetitionCount, warmupCount);
+            benchmark.m_function(context);
+
+            results.push_back(ComputeResult(benchmark, context));
+            const BenchmarkResult& result = results.back();
+            printf(
+                "%-56s %14.0f %14.0f %14.0f %12.3f\n",
+                result.m_fullName.c_str(),
+                result.m_medianNs,
+                result.m_minNs,
+                result.m_stdDevNs,
+                result.m_medianNs / static_cast<double>(eastl::max<u64>(result.m_itemCount, 1)));
+        }
+
+        if (jsonPath != nullptr && !WriteJson(jsonPath, results))
+        {
+            fprintf(stderr, "Failed to write results to '%s'\n", jsonPath);
+            return 1;
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Common/Types.hpp>
+
+namespace KryneEngine::Benchmarks
+{
+    class BenchmarkContext
+    {
+    public:
+        explicit BenchmarkContext(u32 _repetitionCount, u32 _warmupCount)
+            : m_repetitionCount(_repetitionCount)
+            , m_warmupCount(_warmupCount)
+        {}
+
+        /// @brief Sets the number of items processed by each measured run, used to report per-item timings.
+        void SetItemCount(u64 _itemCount) { m_itemCount = _itemCount; }
+
+        /**
+         * @brief Times repeated runs of `_function`.
+         *
+         * @details
+         * Everything outside of the measured function (setup, teardown) isn't accounted for, so the function should
+         * leave its inputs in the same state it found them, to keep runs comparable.
+         */
+        template <class Func>
+        void Measure(Func&& _function)
+        {
+            for (u32 i = 0; i < m_warmupCount; i++)
+            {
+                _function();
+            }
+
+            m_timings.reserve(m_timings.size() + m_repetitionCount);
+            for (u32 i = 0; i < m_repetitionCount; i++)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                _function();
+                const auto end = std::chrono::steady_clock::now();
+                m_timings.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            }
+        }
+
+        /// @brief Prevents the compiler from optimizing away the computation of `_value`.
+        template <class T>
+        static void DoNotOptimize(const T& _value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            // Only publishing the address isn't enough, as the value itself is dead once the caller returns.
+            asm volatile("" : : "r,m"(_value) : "memory");
+#else
+            s_sink = &_value;
+#endif
+        }
+
+        [[nodiscard]] u64 GetItemCount() const { return m_itemCount; }
+        [[nodiscard]] const eastl::vector<u64>& GetTimings() const { return m_timings; }
+
+    private:
+        u32 m_repetitionCount;
+        u32 m_warmupCount;
+        u64 m_itemCount = 1;
+        eastl::vector<u64> m_timings;
+
+        static const void* volatile s_sink;
+    };
+
+    using BenchmarkFunction = void (*)(BenchmarkContext& _context);
+
+    struct BenchmarkRegistration
+    {
+        BenchmarkRegistration(const char* _group, const char* _name, BenchmarkFunction _function);
+    };
+
+    /**
+     * @brief Runs all registered benchmarks, and prints their results.
+     *
+     * @details
+     * Supported arguments:
+     * - `--filter <text>`: only runs benchmarks whose `Group.Name` contains `<text>`.
+     * - `--repetitions <count>`: number of measured runs per benchmark, 10 by default.
+     * - `--json <path>`: also writes the results to a JSON file, to be compared across runs.
+     */
+    s32 RunBenchmarks(s32 _argc, const char** _argv);
+}
+
+#define KE_BENCHMARK(group, name)                                                                                       \
+    static void KE_Benchmark_##group##_##name(::KryneEngine::Benchmarks::BenchmarkContext& _context);                  \
+    static const ::KryneEngine::Benchmarks::BenchmarkRegistration s_benchmarkRegistration_##group##_##name(             \
+        #group,                                                                                                         \
+        #name,                                                                                                          \
+        KE_Benchmark_##group##_##name);                                                                                 \
+    static void KE_Benchmark_##group##_##name(::KryneEngine::Benchmarks::BenchmarkContext& _context)
@@ -0,0 +1,12 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Benchmark.hpp"
+
+int main(int _argc, const char** _argv)
+{
+    return KryneEngine::Benchmarks::RunBenchmarks(_argc, _argv);
+}
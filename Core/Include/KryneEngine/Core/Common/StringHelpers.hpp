@@ -10,11 +10,23 @@
 #include <EASTL/string.h>
 #include <string>
 
+#include "KryneEngine/Core/Common/StringInterning.hpp"
 #include "KryneEngine/Core/Common/Types.hpp"
 #include "KryneEngine/Core/Math/Hashing.hpp"
 
 namespace KryneEngine
 {
+    /**
+     * @brief 64-bit string hash, along with the interned source string.
+     *
+     * @details
+     * The source string is interned in the global `StringInterning` table, so hashing the same string again doesn't
+     * allocate, and the struct is trivially copyable. Building with `KE_STRIP_STRING_HASH_NAMES` only keeps the
+     * hash, in which case `GetString()` returns an empty string.
+     *
+     * String literals can be hashed at compile time with `KE_SH("...")` or `"..."_sh`. The literal is referenced
+     * directly, so there is no runtime hashing nor interning at all.
+     */
     struct StringHash
     {
         explicit StringHash(u64 _value)
@@ -22,20 +34,40 @@ namespace KryneEngine
         {}
 
         explicit StringHash(const eastl::string_view& _string)
-            : m_string(_string)
-            , m_hash(Hash64(_string))
+            : m_hash(Hash64(_string))
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+            , m_string(StringInterning::Intern(_string, m_hash))
+#endif
         {}
 
-        StringHash(const StringHash& _other) = default;
-        StringHash(StringHash&& _other) noexcept = default;
+        /// @brief Hashes a string with static storage duration at compile time.
+        static consteval StringHash FromLiteral(const char* _literal, size_t _size)
+        {
+            return StringHash(Hashing::Hash64(_literal, _size), _literal);
+        }
 
-        StringHash& operator=(const StringHash& _other) = default;
-        StringHash& operator=(StringHash&& _other) noexcept = default;
+        template <size_t N>
+        static consteval StringHash FromLiteral(const char (&_literal)[N])
+        {
+            return FromLiteral(_literal, N - 1);
+        }
 
         u64 m_hash;
-        eastl::string m_string {};
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+        const char* m_string = nullptr;
+#endif
 
-        static u64 Hash64(const eastl::string_view& _string)
+        /// @brief Returns the interned source string, or an empty string if unknown.
+        [[nodiscard]] const char* GetString() const
+        {
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+            return m_string != nullptr ? m_string : "";
+#else
+            return "";
+#endif
+        }
+
+        static constexpr u64 Hash64(const eastl::string_view& _string)
         {
             return Hashing::Hash64(_string.data(), _string.size());
         }
@@ -49,8 +81,24 @@ namespace KryneEngine
         {
             return m_hash < rhs.m_hash;
         }
+
+    private:
+        constexpr StringHash(u64 _hash, [[maybe_unused]] const char* _literal)
+            : m_hash(_hash)
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+            , m_string(_literal)
+#endif
+        {}
     };
 
+    inline namespace Literals
+    {
+        consteval StringHash operator""_sh(const char* _literal, size_t _size)
+        {
+            return StringHash::FromLiteral(_literal, _size);
+        }
+    }
+
     struct Utf8Iterator
     {
         explicit Utf8Iterator(eastl::string_view _string);
@@ -94,6 +142,8 @@ namespace KryneEngine
     }
 }
 
+#define KE_SH(literal) ::KryneEngine::StringHash::FromLiteral(literal)
+
 namespace eastl
 {
     template <>
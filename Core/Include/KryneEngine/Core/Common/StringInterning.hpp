@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <EASTL/string_view.h>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+
+/**
+ * @brief Global, thread-safe table of unique strings, indexed by their 64-bit hash.
+ *
+ * @details
+ * Strings are copied once into append-only arenas, and live until the end of the program, so the returned pointers
+ * can be stored freely. The table is sharded by hash, each shard behind its own RW spin lock, so lookups of already
+ * interned strings only take a shared lock.
+ *
+ * Two different strings with the same hash are considered the same string, like `StringHash` does.
+ */
+namespace KryneEngine::StringInterning
+{
+    struct Stats
+    {
+        u64 m_stringCount = 0;
+        u64 m_internCount = 0;
+
+        /// Size of the unique strings, null terminators included.
+        size_t m_stringBytes = 0;
+        /// Memory used by the table itself: arena chunks plus hash index.
+        size_t m_arenaBytes = 0;
+        size_t m_indexBytes = 0;
+
+        /// Size of the string copies which were avoided, by interning an already known string.
+        size_t m_deduplicatedBytes = 0;
+
+        /**
+         * @brief Memory saved compared to each intern call owning a heap copy of its string.
+         * @details This is an upper bound, as short strings would fit in the small string buffer of `eastl::string`.
+         */
+        [[nodiscard]] s64 GetSavedBytes() const
+        {
+            return static_cast<s64>(m_stringBytes + m_deduplicatedBytes)
+                - static_cast<s64>(m_arenaBytes + m_indexBytes);
+        }
+    };
+
+    /// @brief Returns the unique null terminated copy of `_string`, which `_hash` is the hash of.
+    const char* Intern(eastl::string_view _string, u64 _hash);
+
+    /// @brief Returns the interned string for this hash, or `nullptr` if none was interned.
+    const char* Find(u64 _hash);
+
+    [[nodiscard]] Stats GetStats();
+}
@@ -0,0 +1,27 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Math/BoundingBox.hpp"
+
+namespace KryneEngine::Math
+{
+    struct BoundingSphere
+    {
+        float3 m_center {};
+        float m_radius = 0.f;
+
+        BoundingSphere() = default;
+        BoundingSphere(const float3& _center, float _radius): m_center(_center), m_radius(_radius) {}
+
+        /// @brief Returns the sphere enclosing the box, which is not the smallest enclosing sphere of its content.
+        static BoundingSphere FromBoundingBox(const BoundingBox& _box)
+        {
+            return { _box.GetCenter(), _box.GetSize().Length() * 0.5f };
+        }
+    };
+}
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "KryneEngine/Core/Math/BoundingBox.hpp"
+#include "KryneEngine/Core/Math/Ray.hpp"
+
+namespace KryneEngine
+{
+    class FibersManager;
+}
+
+namespace KryneEngine::Math
+{
+    /**
+     * @brief Bounding volume hierarchy over a set of bounding boxes.
+     *
+     * @details
+     * The tree is built top-down using binned SAH splits, optionally in parallel on the fibers manager, then collapsed
+     * into 4-wide nodes, so that each traversal step tests 4 child boxes at once.
+     *
+     * Primitives are referred to by their index in the span given to `Build`. Queries only test the primitive bounding
+     * boxes, and call back the user for each candidate primitive to run the exact test.
+     * The query implementations live in `Bvh.inl`.
+     */
+    class Bvh
+    {
+    public:
+        static constexpr u32 kWidth = 4;
+        static constexpr u32 kInvalidIndex = ~0u;
+        static constexpr u32 kDefaultMaxLeafSize = 4;
+
+        /// @brief Wide node, storing the bounding boxes of its children as structure of arrays.
+        struct Node
+        {
+            float m_minX[kWidth];
+            float m_minY[kWidth];
+            float m_minZ[kWidth];
+            float m_maxX[kWidth];
+            float m_maxY[kWidth];
+            float m_maxZ[kWidth];
+
+            /// Index of the child node, or of its first primitive in the leaf order if `m_counts[i] > 0`.
+            /// `kInvalidIndex` for unused slots.
+            u32 m_children[kWidth];
+            u32 m_counts[kWidth];
+        };
+
+        struct Hit
+        {
+            u32 m_primitive = kInvalidIndex;
+            float m_distance = FLT_MAX;
+
+            [[nodiscard]] bool IsValid() const { return m_primitive != kInvalidIndex; }
+        };
+
+        void Build(
+            eastl::span<const BoundingBox> _primitives,
+            FibersManager* _fibersManager = nullptr,
+            u32 _maxLeafSize = kDefaultMaxLeafSize);
+
+        void Clear();
+
+        /**
+         * @brief Calls `_func(u32 _primitive)` for every primitive whose bounding box overlaps `_box`.
+         */
+        template <class Func>
+        void QueryOverlaps(const BoundingBox& _box, Func&& _func) const;
+
+        /**
+         * @brief Finds the closest primitive hit by the ray, visiting the nodes front to back.
+         *
+         * @param _intersect Called as `float _intersect(u32 _primitive, float _maxDistance)` for each primitive whose
+         * bounding box is hit closer than the current closest hit. Returns the hit distance along the ray, or any
+         * value greater or equal to `_maxDistance` if there is no closer hit.
+         */
+        template <class Func>
+        Hit Raycast(const Ray& _ray, Func&& _intersect, float _maxDistance = FLT_MAX) const;
+
+        /**
+         * @brief Finds the closest primitive to a point, visiting the nodes closest first.
+         *
+         * @param _distance Called as `float _distance(u32 _primitive, float _maxDistance)` for each primitive whose
+         * bounding box is closer than the current closest primitive. Returns the distance to the primitive, or any
+         * value greater or equal to `_maxDistance` if it is farther.
+         */
+        template <class Func>
+        Hit FindClosest(const float3& _point, Func&& _distance, float _maxDistance = FLT_MAX) const;
+
+        [[nodiscard]] bool IsEmpty() const { return m_nodes.empty(); }
+        [[nodiscard]] const eastl::vector<Node>& GetNodes() const { return m_nodes; }
+
+        /// @brief Primitive indices in leaf order.
+        [[nodiscard]] const eastl::vector<u32>& GetPrimitiveIndices() const { return m_primitiveIndices; }
+
+    private:
+        eastl::vector<Node> m_nodes;
+        eastl::vector<u32> m_primitiveIndices;
+        eastl::vector<BoundingBox> m_primitiveBounds;
+
+        struct RayData
+        {
+            float3 m_origin;
+            float3 m_inverseDirection;
+        };
+
+        // Child tests, returning the mask of the valid children passing the test.
+
+        static u32 _OverlapChildren(const Node& _node, const BoundingBox& _box);
+        static u32 _IntersectChildren(
+            const Node& _node, const RayData& _ray, float _maxDistance, float (&distances_)[kWidth]);
+        static u32 _ChildrenDistancesSquared(
+            const Node& _node, const float3& _point, float _maxDistanceSquared, float (&distancesSquared_)[kWidth]);
+
+        static bool _Overlaps(const BoundingBox& _a, const BoundingBox& _b);
+    };
+}
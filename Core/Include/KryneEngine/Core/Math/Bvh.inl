@@ -0,0 +1,210 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "Bvh.hpp"
+
+#include <bit>
+#include <EASTL/fixed_vector.h>
+
+namespace KryneEngine::Math
+{
+    template <class Func>
+    void Bvh::QueryOverlaps(const BoundingBox& _box, Func&& _func) const
+    {
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
+        eastl::fixed_vector<u32, 64> stack;
+        stack.push_back(0);
+
+        while (!stack.empty())
+        {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            u32 mask = _OverlapChildren(node, _box);
+            while (mask != 0)
+            {
+                const u32 child = std::countr_zero(mask);
+                mask &= mask - 1;
+
+                if (node.m_counts[child] == 0)
+                {
+                    stack.push_back(node.m_children[child]);
+                    continue;
+                }
+
+                const u32 end = node.m_children[child] + node.m_counts[child];
+                for (u32 i = node.m_children[child]; i < end; i++)
+                {
+                    if (_Overlaps(m_primitiveBounds[i], _box))
+                    {
+                        _func(m_primitiveIndices[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    namespace BvhDetails
+    {
+        struct StackEntry
+        {
+            u32 m_node;
+            float m_distance;
+        };
+
+        /// @brief Sorts the children of the mask by decreasing distance, so that the closest one is pushed last.
+        inline u32 SortChildren(u32 _mask, const float (&_distances)[Bvh::kWidth], u32 (&order_)[Bvh::kWidth])
+        {
+            u32 count = 0;
+            while (_mask != 0)
+            {
+                const u32 child = std::countr_zero(_mask);
+                _mask &= _mask - 1;
+
+                u32 i = count++;
+                for (; i > 0 && _distances[order_[i - 1]] < _distances[child]; i--)
+                {
+                    order_[i] = order_[i - 1];
+                }
+                order_[i] = child;
+            }
+            return count;
+        }
+    }
+
+    template <class Func>
+    Bvh::Hit Bvh::Raycast(const Ray& _ray, Func&& _intersect, float _maxDistance) const
+    {
+        Hit hit { kInvalidIndex, _maxDistance };
+        if (m_nodes.empty())
+        {
+            return hit;
+        }
+
+        const RayData ray {
+            _ray.m_origin,
+            float3(1.f / _ray.m_direction.x, 1.f / _ray.m_direction.y, 1.f / _ray.m_direction.z),
+        };
+
+        eastl::fixed_vector<BvhDetails::StackEntry, 64> stack;
+        stack.push_back({ 0, 0.f });
+
+        while (!stack.empty())
+        {
+            const BvhDetails::StackEntry entry = stack.back();
+            stack.pop_back();
+            if (entry.m_distance > hit.m_distance)
+            {
+                continue;
+            }
+
+            const Node& node = m_nodes[entry.m_node];
+            float distances[kWidth];
+            u32 order[kWidth];
+            const u32 count = BvhDetails::SortChildren(
+                _IntersectChildren(node, ray, hit.m_distance, distances),
+                distances,
+                order);
+
+            // Inner children are pushed farthest first, leaves are tested closest first.
+            for (u32 i = 0; i < count; i++)
+            {
+                const u32 child = order[i];
+                if (node.m_counts[child] == 0)
+                {
+                    stack.push_back({ node.m_children[child], distances[child] });
+                }
+            }
+            for (u32 i = count; i-- > 0;)
+            {
+                const u32 child = order[i];
+                if (node.m_counts[child] == 0 || distances[child] > hit.m_distance)
+                {
+                    continue;
+                }
+
+                const u32 end = node.m_children[child] + node.m_counts[child];
+                for (u32 j = node.m_children[child]; j < end; j++)
+                {
+                    const float distance = _intersect(m_primitiveIndices[j], hit.m_distance);
+                    if (distance < hit.m_distance)
+                    {
+                        hit = { m_primitiveIndices[j], distance };
+                    }
+                }
+            }
+        }
+
+        return hit;
+    }
+
+    template <class Func>
+    Bvh::Hit Bvh::FindClosest(const float3& _point, Func&& _distance, float _maxDistance) const
+    {
+        Hit hit { kInvalidIndex, _maxDistance };
+        if (m_nodes.empty())
+        {
+            return hit;
+        }
+
+        eastl::fixed_vector<BvhDetails::StackEntry, 64> stack;
+        stack.push_back({ 0, 0.f });
+
+        while (!stack.empty())
+        {
+            const BvhDetails::StackEntry entry = stack.back();
+            stack.pop_back();
+            if (entry.m_distance > hit.m_distance * hit.m_distance)
+            {
+                continue;
+            }
+
+            const Node& node = m_nodes[entry.m_node];
+            float distancesSquared[kWidth];
+            u32 order[kWidth];
+            const u32 count = BvhDetails::SortChildren(
+                _ChildrenDistancesSquared(node, _point, hit.m_distance * hit.m_distance, distancesSquared),
+                distancesSquared,
+                order);
+
+            // Inner children are pushed farthest first, leaves are tested closest first.
+            for (u32 i = 0; i < count; i++)
+            {
+                const u32 child = order[i];
+                if (node.m_counts[child] == 0)
+                {
+                    stack.push_back({ node.m_children[child], distancesSquared[child] });
+                }
+            }
+            for (u32 i = count; i-- > 0;)
+            {
+                const u32 child = order[i];
+                if (node.m_counts[child] == 0 || distancesSquared[child] > hit.m_distance * hit.m_distance)
+                {
+                    continue;
+                }
+
+                const u32 end = node.m_children[child] + node.m_counts[child];
+                for (u32 j = node.m_children[child]; j < end; j++)
+                {
+                    const float distance = _distance(m_primitiveIndices[j], hit.m_distance);
+                    if (distance < hit.m_distance)
+                    {
+                        hit = { m_primitiveIndices[j], distance };
+                    }
+                }
+            }
+        }
+
+        return hit;
+    }
+}
@@ -26,6 +26,13 @@ namespace KryneEngine::Math
 
         static u32 PackFloat16x2(float _a, float _b);
 
+        /**
+         * @brief Bulk versions of the conversions above.
+         * @details Results are bit-for-bit identical to the single value conversions, only vectorized.
+         */
+        static void ConvertToFloat16(const float* _input, u16* _output, size_t _count);
+        static void ConvertFromFloat16(const u16* _input, float* _output, size_t _count);
+
         u16 m_data;
     };
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Math/BoundingBox.hpp"
+#include "KryneEngine/Core/Math/BoundingSphere.hpp"
+#include "KryneEngine/Core/Math/Matrix44.hpp"
+#include "KryneEngine/Core/Math/TransformBatch.hpp"
+
+namespace KryneEngine::Math
+{
+    /// @brief Plane of equation `dot(m_normal, p) + m_distance = 0`. Points on the side of the normal are in front.
+    struct Plane
+    {
+        float3 m_normal {};
+        float m_distance = 0.f;
+
+        Plane() = default;
+        Plane(const float3& _normal, float _distance): m_normal(_normal), m_distance(_distance) {}
+
+        [[nodiscard]] float SignedDistance(const float3& _point) const
+        {
+            return float3::Dot(m_normal, _point) + m_distance;
+        }
+
+        void Normalize()
+        {
+            const float length = m_normal.Length();
+            // Degenerate planes (e.g. the far plane of an infinite projection) are left as is.
+            if (length > 0.f)
+            {
+                m_normal = m_normal / length;
+                m_distance /= length;
+            }
+        }
+    };
+
+    /**
+     * @brief Convex volume bounded by 6 planes, all facing inwards.
+     *
+     * @details
+     * Extracted from a view projection matrix using the Gribb-Hartmann method, for the engine projection convention:
+     * column vectors, and a clip space depth in [0, w].
+     *
+     * With reversed depth, the depth 0 plane is the far one, so `_reversedDepth` must match the projection for the
+     * `Near` and `Far` planes to be named correctly. Intersection tests don't depend on it.
+     */
+    struct Frustum
+    {
+        enum PlaneIndex: u8
+        {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            Count,
+        };
+
+        Plane m_planes[PlaneIndex::Count];
+
+        Frustum() = default;
+
+        template <bool SimdOptimal, bool RowMajor>
+        explicit Frustum(const Matrix44Base<float, SimdOptimal, RowMajor>& _viewProjection, bool _reversedDepth = false)
+        {
+            const auto row = [&](size_t _row)
+            {
+                return float4(
+                    _viewProjection.Get(_row, 0),
+                    _viewProjection.Get(_row, 1),
+                    _viewProjection.Get(_row, 2),
+                    _viewProjection.Get(_row, 3));
+            };
+            const float4 x = row(0);
+            const float4 y = row(1);
+            const float4 z = row(2);
+            const float4 w = row(3);
+
+            const auto setPlane = [this](PlaneIndex _index, const float4& _coefficients)
+            {
+                m_planes[_index] = Plane(float3(_coefficients.x, _coefficients.y, _coefficients.z), _coefficients.w);
+                m_planes[_index].Normalize();
+            };
+            setPlane(Left, w + x);
+            setPlane(Right, w - x);
+            setPlane(Bottom, w + y);
+            setPlane(Top, w - y);
+            setPlane(_reversedDepth ? Far : Near, z);
+            setPlane(_reversedDepth ? Near : Far, w - z);
+        }
+
+        /// @brief Conservative test, which can report boxes near the frustum corners as intersecting.
+        [[nodiscard]] bool Intersects(const BoundingBox& _box) const;
+
+        [[nodiscard]] bool Intersects(const BoundingSphere& _sphere) const;
+    };
+
+    // Batched culling, on structure of arrays data (see `SoaTypes.hpp`).
+    // The results are written as a bitmask, with bit `i % 64` of `_visibilityMask[i / 64]` set if object `i` intersects
+    // the frustum. All the words covering `_count` objects are written.
+    // To split the work across jobs, give each job a range of objects starting at a multiple of 64, so that jobs
+    // never write to the same mask word.
+
+    void CullBoundingBoxes(
+        const Frustum& _frustum,
+        Vector3Soa<const float> _mins,
+        Vector3Soa<const float> _maxs,
+        size_t _count,
+        u64* _visibilityMask);
+
+    void CullBoundingSpheres(
+        const Frustum& _frustum,
+        Vector3Soa<const float> _centers,
+        const float* _radii,
+        size_t _count,
+        u64* _visibilityMask);
+
+    /**
+     * @brief Writes the indices of the set bits of a visibility mask.
+     *
+     * @param _visibilityMask Mask as written by the culling functions.
+     * @param _count Number of objects covered by the mask.
+     * @param _indices Output indices, must be able to hold `_count` indices.
+     * @param _indexOffset Value added to all indices, to write the indices of a job range directly as global indices.
+     * @return The number of indices written.
+     */
+    size_t CompactVisibleIndices(const u64* _visibilityMask, size_t _count, u32* _indices, u32 _indexOffset = 0);
+}
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <cstring>
 #include <EASTL/span.h>
+#include <EASTL/type_traits.h>
 
 #include "KryneEngine/Core/Common/Types.hpp"
 
@@ -28,14 +30,14 @@ namespace KryneEngine::Hashing
                 const u64 blocks = _size >> 3;
                 for (u32 i = 0; i < blocks; ++i)
                 {
-                    u64 block = static_cast<u64>(_data[8 * i + 0])
-                        | static_cast<u64>(_data[8 * i + 1]) << 8
-                        | static_cast<u64>(_data[8 * i + 2]) << 16
-                        | static_cast<u64>(_data[8 * i + 3]) << 24
-                        | static_cast<u64>(_data[8 * i + 4]) << 32
-                        | static_cast<u64>(_data[8 * i + 5]) << 40
-                        | static_cast<u64>(_data[8 * i + 6]) << 48
-                        | static_cast<u64>(_data[8 * i + 7]) << 56;
+                    u64 block = static_cast<u64>(static_cast<u8>(_data[8 * i + 0]))
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 1])) << 8
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 2])) << 16
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 3])) << 24
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 4])) << 32
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 5])) << 40
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 6])) << 48
+                        | static_cast<u64>(static_cast<u8>(_data[8 * i + 7])) << 56;
 
                     block *= kMurmurPrime;
                     block ^= block >> kMurmurShift;
@@ -88,6 +90,356 @@ namespace KryneEngine::Hashing
         }
     }
 
+    namespace Xxh3
+    {
+        // https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+        // Outputs match XXH3_64bits_withSeed, so values can be checked against the reference implementation.
+
+        static constexpr u64 kPrime32_1 = 0x9E37'79B1u;
+        static constexpr u64 kPrime32_2 = 0x85EB'CA77u;
+        static constexpr u64 kPrime32_3 = 0xC2B2'AE3Du;
+        static constexpr u64 kPrime64_1 = 0x9E37'79B1'85EB'CA87ull;
+        static constexpr u64 kPrime64_2 = 0xC2B2'AE3D'27D4'EB4Full;
+        static constexpr u64 kPrime64_3 = 0x1656'67B1'9E37'79F9ull;
+        static constexpr u64 kPrime64_4 = 0x85EB'CA77'C2B2'AE63ull;
+        static constexpr u64 kPrime64_5 = 0x27D4'EB2F'1656'67C5ull;
+        static constexpr u64 kPrimeMx1 = 0x1656'6791'9E37'79F9ull;
+        static constexpr u64 kPrimeMx2 = 0x9FB2'1C65'1E98'DF25ull;
+
+        static constexpr size_t kSecretSize = 192;
+        static constexpr size_t kStripeSize = 64;
+        static constexpr size_t kAccumulatorCount = kStripeSize / sizeof(u64);
+        static constexpr size_t kSecretConsumeRate = 8;
+        static constexpr size_t kStripesPerBlock = (kSecretSize - kStripeSize) / kSecretConsumeRate;
+        static constexpr size_t kMidSizeMax = 240;
+
+        alignas(64) static constexpr u8 kDefaultSecret[kSecretSize] = {
+            0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+            0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+            0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+            0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+            0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+            0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+            0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+            0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+            0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+            0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+            0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+            0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+        };
+
+        template <class Byte>
+        constexpr u32 ReadLe32(const Byte* _data)
+        {
+            if consteval
+            {
+                return static_cast<u32>(static_cast<u8>(_data[0]))
+                    | static_cast<u32>(static_cast<u8>(_data[1])) << 8
+                    | static_cast<u32>(static_cast<u8>(_data[2])) << 16
+                    | static_cast<u32>(static_cast<u8>(_data[3])) << 24;
+            }
+            else
+            {
+                u32 value;
+                memcpy(&value, _data, sizeof(value));
+                return value;
+            }
+        }
+
+        template <class Byte>
+        constexpr u64 ReadLe64(const Byte* _data)
+        {
+            if consteval
+            {
+                return static_cast<u64>(ReadLe32(_data)) | static_cast<u64>(ReadLe32(_data + 4)) << 32;
+            }
+            else
+            {
+                u64 value;
+                memcpy(&value, _data, sizeof(value));
+                return value;
+            }
+        }
+
+        constexpr u64 RotateLeft(u64 _value, u32 _shift)
+        {
+            return (_value << _shift) | (_value >> (64 - _shift));
+        }
+
+        constexpr u64 ByteSwap32(u64 _value)
+        {
+            return ((_value & 0xff) << 24)
+                | ((_value & 0xff00) << 8)
+                | ((_value >> 8) & 0xff00)
+                | ((_value >> 24) & 0xff);
+        }
+
+        constexpr u64 ByteSwap64(u64 _value)
+        {
+            return ByteSwap32(_value >> 32) | ByteSwap32(_value & 0xffff'ffff) << 32;
+        }
+
+        /// @brief Full 64x64 -> 128 bits multiplication, with both halves of the result xor-ed together.
+        constexpr u64 Mul128Fold64(u64 _a, u64 _b)
+        {
+#if defined(__SIZEOF_INT128__)
+            const __uint128_t product = static_cast<__uint128_t>(_a) * _b;
+            return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#else
+            const u64 lowLow = (_a & 0xffff'ffff) * (_b & 0xffff'ffff);
+            const u64 highLow = (_a >> 32) * (_b & 0xffff'ffff);
+            const u64 lowHigh = (_a & 0xffff'ffff) * (_b >> 32);
+            const u64 highHigh = (_a >> 32) * (_b >> 32);
+            const u64 cross = (lowLow >> 32) + (highLow & 0xffff'ffff) + lowHigh;
+            const u64 high = (highLow >> 32) + (cross >> 32) + highHigh;
+            const u64 low = (cross << 32) | (lowLow & 0xffff'ffff);
+            return low ^ high;
+#endif
+        }
+
+        constexpr u64 Xxh64Avalanche(u64 _hash)
+        {
+            _hash ^= _hash >> 33;
+            _hash *= kPrime64_2;
+            _hash ^= _hash >> 29;
+            _hash *= kPrime64_3;
+            _hash ^= _hash >> 32;
+            return _hash;
+        }
+
+        constexpr u64 Avalanche(u64 _hash)
+        {
+            _hash ^= _hash >> 37;
+            _hash *= kPrimeMx1;
+            _hash ^= _hash >> 32;
+            return _hash;
+        }
+
+        constexpr u64 Rrmxmx(u64 _hash, u64 _size)
+        {
+            _hash ^= RotateLeft(_hash, 49) ^ RotateLeft(_hash, 24);
+            _hash *= kPrimeMx2;
+            _hash ^= (_hash >> 35) + _size;
+            _hash *= kPrimeMx2;
+            return _hash ^ (_hash >> 28);
+        }
+
+        constexpr u64 Mix16(const char* _data, const u8* _secret, u64 _seed)
+        {
+            return Mul128Fold64(
+                ReadLe64(_data) ^ (ReadLe64(_secret) + _seed),
+                ReadLe64(_data + 8) ^ (ReadLe64(_secret + 8) - _seed));
+        }
+
+        constexpr u64 HashShort(const char* _data, u64 _size, const u8* _secret, u64 _seed)
+        {
+            if (_size > 8)
+            {
+                const u64 low = ReadLe64(_data) ^ ((ReadLe64(_secret + 24) ^ ReadLe64(_secret + 32)) + _seed);
+                const u64 high = ReadLe64(_data + _size - 8) ^ ((ReadLe64(_secret + 40) ^ ReadLe64(_secret + 48)) - _seed);
+                return Avalanche(_size + ByteSwap64(low) + high + Mul128Fold64(low, high));
+            }
+            if (_size >= 4)
+            {
+                _seed ^= ByteSwap32(_seed & 0xffff'ffff) << 32;
+                const u64 input = ReadLe32(_data + _size - 4) + (static_cast<u64>(ReadLe32(_data)) << 32);
+                const u64 bitFlip = (ReadLe64(_secret + 8) ^ ReadLe64(_secret + 16)) - _seed;
+                return Rrmxmx(input ^ bitFlip, _size);
+            }
+            if (_size > 0)
+            {
+                const u32 combined = static_cast<u32>(static_cast<u8>(_data[0])) << 16
+                    | static_cast<u32>(static_cast<u8>(_data[_size >> 1])) << 24
+                    | static_cast<u32>(static_cast<u8>(_data[_size - 1]))
+                    | static_cast<u32>(_size) << 8;
+                const u64 bitFlip = (ReadLe32(_secret) ^ ReadLe32(_secret + 4)) + _seed;
+                return Xxh64Avalanche(combined ^ bitFlip);
+            }
+            return Xxh64Avalanche(_seed ^ ReadLe64(_secret + 56) ^ ReadLe64(_secret + 64));
+        }
+
+        constexpr u64 HashMedium(const char* _data, u64 _size, const u8* _secret, u64 _seed)
+        {
+            u64 accumulator = _size * kPrime64_1;
+            if (_size > 32)
+            {
+                if (_size > 64)
+                {
+                    if (_size > 96)
+                    {
+                        accumulator += Mix16(_data + 48, _secret + 96, _seed);
+                        accumulator += Mix16(_data + _size - 64, _secret + 112, _seed);
+                    }
+                    accumulator += Mix16(_data + 32, _secret + 64, _seed);
+                    accumulator += Mix16(_data + _size - 48, _secret + 80, _seed);
+                }
+                accumulator += Mix16(_data + 16, _secret + 32, _seed);
+                accumulator += Mix16(_data + _size - 32, _secret + 48, _seed);
+            }
+            accumulator += Mix16(_data, _secret, _seed);
+            accumulator += Mix16(_data + _size - 16, _secret + 16, _seed);
+            return Avalanche(accumulator);
+        }
+
+        constexpr u64 HashMidSize(const char* _data, u64 _size, const u8* _secret, u64 _seed)
+        {
+            constexpr u64 secretSizeMin = 136;
+            constexpr u64 startOffset = 3;
+            constexpr u64 lastOffset = 17;
+
+            u64 accumulator = _size * kPrime64_1;
+            for (u64 i = 0; i < 8; i++)
+            {
+                accumulator += Mix16(_data + 16 * i, _secret + 16 * i, _seed);
+            }
+            accumulator = Avalanche(accumulator);
+
+            const u64 roundCount = _size / 16;
+            for (u64 i = 8; i < roundCount; i++)
+            {
+                accumulator += Mix16(_data + 16 * i, _secret + 16 * (i - 8) + startOffset, _seed);
+            }
+            accumulator += Mix16(_data + _size - 16, _secret + secretSizeMin - lastOffset, _seed);
+            return Avalanche(accumulator);
+        }
+
+        constexpr void InitAccumulators(u64* _accumulators)
+        {
+            _accumulators[0] = kPrime32_3;
+            _accumulators[1] = kPrime64_1;
+            _accumulators[2] = kPrime64_2;
+            _accumulators[3] = kPrime64_3;
+            _accumulators[4] = kPrime64_4;
+            _accumulators[5] = kPrime32_2;
+            _accumulators[6] = kPrime64_5;
+            _accumulators[7] = kPrime32_1;
+        }
+
+        /// @brief Derives the secret used for long inputs hashed with a non-zero seed.
+        constexpr void InitSecret(u8* _secret, u64 _seed)
+        {
+            for (size_t i = 0; i < kSecretSize; i += 16)
+            {
+                const u64 low = ReadLe64(kDefaultSecret + i) + _seed;
+                const u64 high = ReadLe64(kDefaultSecret + i + 8) - _seed;
+                if consteval
+                {
+                    for (size_t j = 0; j < 8; j++)
+                    {
+                        _secret[i + j] = static_cast<u8>(low >> (8 * j));
+                        _secret[i + 8 + j] = static_cast<u8>(high >> (8 * j));
+                    }
+                }
+                else
+                {
+                    memcpy(_secret + i, &low, sizeof(low));
+                    memcpy(_secret + i + 8, &high, sizeof(high));
+                }
+            }
+        }
+
+        constexpr void AccumulateStripeScalar(u64* _accumulators, const char* _stripe, const u8* _secret)
+        {
+            for (size_t i = 0; i < kAccumulatorCount; i++)
+            {
+                const u64 data = ReadLe64(_stripe + 8 * i);
+                const u64 key = data ^ ReadLe64(_secret + 8 * i);
+                _accumulators[i ^ 1] += data;
+                _accumulators[i] += (key & 0xffff'ffff) * (key >> 32);
+            }
+        }
+
+        constexpr void ScrambleScalar(u64* _accumulators, const u8* _secret)
+        {
+            for (size_t i = 0; i < kAccumulatorCount; i++)
+            {
+                u64 accumulator = _accumulators[i];
+                accumulator ^= accumulator >> 47;
+                accumulator ^= ReadLe64(_secret + 8 * i);
+                accumulator *= kPrime32_1;
+                _accumulators[i] = accumulator;
+            }
+        }
+
+        /**
+         * @brief Vectorized versions of the stripe accumulation and scrambling, bit-exact with the scalar ones.
+         * @details Uses AVX-512, AVX2, SSE2 or NEON, depending on the target selected at runtime by `SimdDispatch`, and
+         * falls back on the scalar functions otherwise.
+         */
+        void AccumulateStripes(u64* _accumulators, const char* _stripes, const u8* _secret, size_t _stripeCount);
+        void Scramble(u64* _accumulators, const u8* _secret);
+
+        constexpr u64 MergeAccumulators(const u64* _accumulators, const u8* _secret, u64 _start)
+        {
+            u64 result = _start;
+            for (size_t i = 0; i < kAccumulatorCount; i += 2)
+            {
+                result += Mul128Fold64(
+                    _accumulators[i] ^ ReadLe64(_secret + 8 * i),
+                    _accumulators[i + 1] ^ ReadLe64(_secret + 8 * i + 8));
+            }
+            return Avalanche(result);
+        }
+
+        constexpr u64 HashLongScalar(const char* _data, u64 _size, u64 _seed)
+        {
+            u8 secret[kSecretSize] {};
+            InitSecret(secret, _seed);
+
+            u64 accumulators[kAccumulatorCount] {};
+            InitAccumulators(accumulators);
+
+            constexpr u64 blockSize = kStripesPerBlock * kStripeSize;
+            const u64 blockCount = (_size - 1) / blockSize;
+            for (u64 block = 0; block < blockCount; block++)
+            {
+                for (u64 i = 0; i < kStripesPerBlock; i++)
+                {
+                    AccumulateStripeScalar(accumulators, _data + block * blockSize + i * kStripeSize, secret + i * kSecretConsumeRate);
+                }
+                ScrambleScalar(accumulators, secret + kSecretSize - kStripeSize);
+            }
+
+            // The last stripe always covers the last 64 bytes, and might overlap with the previous one.
+            const u64 stripeCount = ((_size - 1) - blockCount * blockSize) / kStripeSize;
+            for (u64 i = 0; i < stripeCount; i++)
+            {
+                AccumulateStripeScalar(accumulators, _data + blockCount * blockSize + i * kStripeSize, secret + i * kSecretConsumeRate);
+            }
+            AccumulateStripeScalar(accumulators, _data + _size - kStripeSize, secret + kSecretSize - kStripeSize - 7);
+
+            return MergeAccumulators(accumulators, secret + 11, _size * kPrime64_1);
+        }
+
+        /// @brief Runtime path for inputs longer than 240 bytes, using the vectorized stripe accumulation.
+        u64 HashLong(const char* _data, u64 _size, u64 _seed);
+
+        constexpr u64 Xxh3Hash64(const char* _data, u64 _size, u64 _seed)
+        {
+            if (_size <= 16)
+            {
+                return HashShort(_data, _size, kDefaultSecret, _seed);
+            }
+            if (_size <= 128)
+            {
+                return HashMedium(_data, _size, kDefaultSecret, _seed);
+            }
+            if (_size <= kMidSizeMax)
+            {
+                return HashMidSize(_data, _size, kDefaultSecret, _seed);
+            }
+
+            if consteval
+            {
+                return HashLongScalar(_data, _size, _seed);
+            }
+            else
+            {
+                return HashLong(_data, _size, _seed);
+            }
+        }
+    }
+
     constexpr u64 Hash64(const char* _data, size_t _size)
     {
         return Murmur2::Murmur2Hash64(_data, _size);
@@ -151,4 +503,99 @@ namespace KryneEngine::Hashing
     {
         return Hash64Append(reinterpret_cast<const char*>(_span.data()), _span.size() * sizeof(T), _accumulatedHash);
     }
-}
\ No newline at end of file
+
+    /**
+     * @brief Fast non-cryptographic hash (XXH3, 64 bits).
+     *
+     * @details
+     * Several times faster than `Hash64` on anything longer than a few bytes, with a better distribution. Inputs of
+     * up to 240 bytes go through a short scalar path, which can also be evaluated at compile time. Longer inputs are
+     * processed in 64 bytes stripes with SIMD.
+     *
+     * Values differ from `Hash64`, so both can't be mixed for the same keys.
+     */
+    constexpr u64 FastHash64(const char* _data, size_t _size, u64 _seed = 0)
+    {
+        return Xxh3::Xxh3Hash64(_data, _size, _seed);
+    }
+
+    template <size_t N>
+    constexpr u64 FastHash64(const char (&_data)[N], u64 _seed = 0)
+    {
+        return FastHash64(_data, N - 1, _seed);
+    }
+
+    /**
+     * @brief Incremental version of `FastHash64`, for data that isn't contiguous in memory.
+     *
+     * @details
+     * Feeding the same bytes in any number of `Update` calls gives the same result as a single `FastHash64` call on
+     * the whole input. Up to 256 bytes are buffered before being consumed, so a descriptor can be hashed field by
+     * field without any significant overhead.
+     */
+    class FastHasher
+    {
+    public:
+        explicit FastHasher(u64 _seed = 0);
+
+        void Reset(u64 _seed = 0);
+
+        void Update(const void* _data, size_t _size);
+
+        template <class T>
+        void Update(const T& _value)
+        {
+            static_assert(eastl::is_trivially_copyable_v<T>, "Only trivially copyable values can be hashed as bytes");
+
+            // Inlined buffering, so hashing small fields doesn't go through a call and a variable size copy.
+            const u32 offset = m_bufferedSize;
+            if (offset + sizeof(T) <= kBufferSize)
+            {
+                m_bufferedSize = offset + sizeof(T);
+                m_totalSize += sizeof(T);
+                memcpy(m_buffer + offset, &_value, sizeof(T));
+            }
+            else
+            {
+                Update(&_value, sizeof(T));
+            }
+        }
+
+        template <class T>
+        void Update(eastl::span<T> _span)
+        {
+            Update(_span.data(), _span.size_bytes());
+        }
+
+        /// @brief Hash of all the data fed so far. More data can still be added afterward.
+        [[nodiscard]] u64 Digest() const;
+
+    private:
+        static constexpr size_t kBufferSize = 4 * Xxh3::kStripeSize;
+
+        alignas(64) u64 m_accumulators[Xxh3::kAccumulatorCount];
+
+        // Once stripes have been consumed, the end of the buffer holds the last consumed stripe, which is needed to
+        // build the final stripe when fewer than 64 bytes are buffered.
+        alignas(64) u8 m_buffer[kBufferSize];
+        alignas(64) u8 m_secret[Xxh3::kSecretSize];
+
+        u64 m_seed;
+        u64 m_totalSize;
+        u32 m_bufferedSize;
+        u32 m_stripesInBlock;
+
+        // The accumulators and the secret are only set up once the input outgrows the buffer, which short
+        // descriptors never do.
+        bool m_consumingStripes;
+
+        void _StartConsumingStripes();
+
+        static void _ConsumeStripes(
+            u64* _accumulators,
+            u32& _stripesInBlock,
+            const char* _stripes,
+            size_t _stripeCount,
+            const u8* _secret);
+    };
+}
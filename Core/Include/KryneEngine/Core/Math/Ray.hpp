@@ -0,0 +1,28 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Math/Vector.hpp"
+
+namespace KryneEngine::Math
+{
+    /// @brief Half-line starting at `m_origin`. The direction doesn't need to be normalized, distances along the ray
+    /// are expressed in multiples of it.
+    struct Ray
+    {
+        float3 m_origin {};
+        float3 m_direction {};
+
+        Ray() = default;
+        Ray(const float3& _origin, const float3& _direction): m_origin(_origin), m_direction(_direction) {}
+
+        [[nodiscard]] float3 GetPoint(float _distance) const
+        {
+            return m_origin + m_direction * _distance;
+        }
+    };
+}
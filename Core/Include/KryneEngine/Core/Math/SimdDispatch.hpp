@@ -0,0 +1,49 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Common/Types.hpp"
+
+namespace KryneEngine::Math
+{
+    /**
+     * @brief Instruction sets the hot math kernels are compiled for.
+     * @details Covers batch transforms, frustum culling, bulk Float16 conversions and XXH3 long hashing. `Baseline`
+     * is built with the same flags as the rest of the engine (see `XSimdUtils.hpp`). The other targets are only built
+     * on x86-64, when `KRYNE_ENGINE_SIMD_DISPATCH` is enabled.
+     */
+    enum class SimdTarget: u8
+    {
+        Baseline,
+        Sse4_2,
+        Avx2,
+        Avx512,
+
+        Count,
+    };
+
+    namespace SimdDispatch
+    {
+        /// @brief Returns whether kernels were built for `_target`, and the CPU and OS support it.
+        [[nodiscard]] bool IsTargetSupported(SimdTarget _target);
+
+        /// @brief The widest supported target, detected once at startup through cpuid.
+        [[nodiscard]] SimdTarget GetBestTarget();
+
+        /// @brief The target currently used by the kernels. Defaults to `GetBestTarget()`.
+        [[nodiscard]] SimdTarget GetActiveTarget();
+
+        /**
+         * @brief Switches all kernels to `_target`, which must be supported.
+         * @details Meant for tests and benchmarks comparing targets. Kernels running concurrently may still use the
+         * previous target.
+         */
+        void SetActiveTarget(SimdTarget _target);
+
+        [[nodiscard]] const char* GetTargetName(SimdTarget _target);
+    }
+}
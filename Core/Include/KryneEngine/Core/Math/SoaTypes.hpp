@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace KryneEngine::Math
+{
+    // Structure of arrays (SoA) views: each component is stored in its own array, so a whole SIMD register of values
+    // can be loaded at once.
+    // Kept free of any engine dependency, as they are also used by the kernels compiled for each SIMD target.
+
+    template <class T>
+    struct Vector3Soa
+    {
+        T* x;
+        T* y;
+        T* z;
+
+        operator Vector3Soa<const T>() const requires (!std::is_const_v<T>) { return { x, y, z }; }
+    };
+
+    template <class T>
+    struct QuaternionSoa
+    {
+        T* w;
+        T* x;
+        T* y;
+        T* z;
+
+        operator QuaternionSoa<const T>() const requires (!std::is_const_v<T>) { return { w, x, y, z }; }
+    };
+
+    /// @brief One array per matrix element, always indexed as `[row * 4 + column]`, whatever the matrix layout.
+    template <class T>
+    struct Matrix44Soa
+    {
+        T* m_elements[16];
+
+        [[nodiscard]] T* Get(size_t _row, size_t _col) const { return m_elements[_row * 4 + _col]; }
+
+        operator Matrix44Soa<const T>() const requires (!std::is_const_v<T>)
+        {
+            Matrix44Soa<const T> result;
+            for (size_t i = 0; i < 16; i++)
+            {
+                result.m_elements[i] = m_elements[i];
+            }
+            return result;
+        }
+    };
+}
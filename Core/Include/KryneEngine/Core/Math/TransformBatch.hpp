@@ -0,0 +1,49 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Math/Matrix44.hpp"
+#include "KryneEngine/Core/Math/SoaTypes.hpp"
+
+namespace KryneEngine::Math
+{
+    // Batched transform kernels, working on structure of arrays (SoA) data, see `SoaTypes.hpp`. Kernels process as many
+    // values per instruction as the target selected at runtime by `SimdDispatch` allows (4, 8 or 16 floats), and
+    // finish the remaining values one at a time.
+    // Outputs may alias inputs, as long as they point to the exact same arrays.
+
+    /// @brief Transforms `_count` points by `_matrix`, as `_matrix * float4(point, 1)`. The last row is ignored.
+    template <bool SimdOptimal, bool RowMajor>
+    void TransformPoints(
+        const Matrix44Base<float, SimdOptimal, RowMajor>& _matrix,
+        Vector3Soa<const float> _points,
+        Vector3Soa<float> _output,
+        size_t _count);
+
+    /// @brief Transforms `_count` directions by `_matrix`, as `_matrix * float4(direction, 0)`.
+    template <bool SimdOptimal, bool RowMajor>
+    void TransformDirections(
+        const Matrix44Base<float, SimdOptimal, RowMajor>& _matrix,
+        Vector3Soa<const float> _directions,
+        Vector3Soa<float> _output,
+        size_t _count);
+
+    /// @brief Bulk version of `ComputeTransformMatrix`. Rotations are expected to be normalized.
+    void ComputeTransformMatrices(
+        Vector3Soa<const float> _positions,
+        QuaternionSoa<const float> _rotations,
+        Vector3Soa<const float> _scales,
+        Matrix44Soa<float> _output,
+        size_t _count);
+
+    /// @brief Computes `_lhs[i] * _rhs[i]` for `_count` pairs of matrices.
+    void MultiplyMatrices(
+        Matrix44Soa<const float> _lhs,
+        Matrix44Soa<const float> _rhs,
+        Matrix44Soa<float> _output,
+        size_t _count);
+}
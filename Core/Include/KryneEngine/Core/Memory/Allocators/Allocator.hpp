@@ -10,6 +10,10 @@
 
 namespace KryneEngine
 {
+    class AllocatorTracker;
+    class HeapSamplingProfiler;
+    struct AllocatorStats;
+
     class IAllocator
     {
     public:
@@ -17,6 +21,15 @@ namespace KryneEngine
 
         virtual void* Allocate(size_t _size, size_t _alignment) = 0;
         virtual void Free(void* _ptr, size_t _alignment) = 0;
+
+        /// @brief Returns the usage tracker of the allocator, or `nullptr` if it doesn't track its usage.
+        [[nodiscard]] virtual AllocatorTracker* GetTracker() { return nullptr; }
+
+        /**
+         * @brief Fills the usage statistics of the allocator.
+         * @return `false` if the allocator doesn't track its usage.
+         */
+        virtual bool GetAllocatorStats(AllocatorStats& _stats);
     };
 
     struct AllocatorInstance final
@@ -64,6 +77,26 @@ namespace KryneEngine
         void SetAllocator(IAllocator* _allocator) { m_allocator = _allocator; }
         [[nodiscard]] IAllocator* GetAllocator() const { return m_allocator; }
 
+        /**
+         * @brief Returns the exact counters of the default heap, or `nullptr` if they are disabled.
+         *
+         * @details
+         * Counters are opt-in (`KRYNE_ENGINE_COUNT_DEFAULT_HEAP_ALLOCATIONS`), as they add shared atomic counters to
+         * every default heap allocation and free. Byte counts use `StdAlloc::GetAllocationSize()`, so they stay at 0
+         * on Windows, where only the allocation counts are reported.
+         */
+        [[nodiscard]] static AllocatorTracker* GetDefaultHeapTracker();
+
+        /**
+         * @brief Returns the sampling profiler fed by default heap allocations, or `nullptr` if tracking is disabled.
+         *
+         * @details
+         * Tracking is enabled by default (`KRYNE_ENGINE_TRACK_DEFAULT_HEAP_ALLOCATIONS`), as unsampled allocations
+         * only update a per-thread counter.
+         */
+        [[nodiscard]] static HeapSamplingProfiler* GetDefaultHeapProfiler();
+        [[nodiscard]] AllocatorTracker* GetTracker() const;
+
         bool operator ==(const AllocatorInstance& _other) const { return m_allocator == _other.m_allocator; }
 
     private:
@@ -0,0 +1,147 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+
+namespace KryneEngine
+{
+    class AllocatorTracker;
+
+    struct AllocatorStats
+    {
+        const char* m_name = nullptr;
+
+        size_t m_bytesInUse = 0;
+        size_t m_peakBytesInUse = 0;
+        size_t m_budget = 0;
+
+        u64 m_allocationCount = 0;
+        u64 m_totalAllocationCount = 0;
+        u64 m_failedAllocationCount = 0;
+
+        /// Free space left in the allocator own memory, 0 if not reported by the allocator.
+        size_t m_totalFreeBytes = 0;
+        size_t m_largestFreeBlock = 0;
+
+        /// @brief Ratio of the free memory which can't be used by an allocation of the largest free block size.
+        [[nodiscard]] float GetFragmentation() const
+        {
+            return m_totalFreeBytes == 0
+                ? 0.f
+                : 1.f - static_cast<float>(m_largestFreeBlock) / static_cast<float>(m_totalFreeBytes);
+        }
+    };
+
+    /**
+     * @param _tracker The tracker which budget was exceeded.
+     * @param _bytesInUse The usage which went over the budget.
+     * @param _userData The user data passed along the callback.
+     */
+    using AllocatorBudgetCallback = void (*)(const AllocatorTracker& _tracker, size_t _bytesInUse, void* _userData);
+
+    /**
+     * @brief Usage counters of an allocator, along with its name and its soft budget.
+     *
+     * @details
+     * Counters are updated with relaxed atomics, so a tracker can be shared by concurrent allocations.
+     *
+     * The budget callback is called by the allocation which makes the usage go over the budget, and won't be called
+     * again until the usage went back under the budget. The callback is called from within the allocator, so it must
+     * not allocate from it.
+     */
+    class AllocatorTracker
+    {
+    public:
+        explicit AllocatorTracker(const char* _name = nullptr): m_name(_name) {}
+        ~AllocatorTracker();
+
+        AllocatorTracker(const AllocatorTracker&) = delete;
+        AllocatorTracker& operator=(const AllocatorTracker&) = delete;
+
+        void SetName(const char* _name) { m_name = _name; }
+        [[nodiscard]] const char* GetName() const { return m_name; }
+
+        /**
+         * @brief Sets a soft budget, which doesn't prevent any allocation, but calls `_callback` when exceeded.
+         * @param _budget Budget in bytes, 0 to disable it.
+         * @param _callback Can be null, to only report the budget in the stats.
+         *
+         * @details
+         * Can be called while the allocator is in use. Concurrent allocations see either the previous callback or the
+         * new one, along with their matching user data.
+         */
+        void SetBudget(size_t _budget, AllocatorBudgetCallback _callback, void* _userData = nullptr);
+        [[nodiscard]] size_t GetBudget() const { return m_budget.load(std::memory_order_relaxed); }
+
+        void RegisterAllocation(size_t _size)
+        {
+            m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+            m_totalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+            const size_t previous = m_bytesInUse.fetch_add(_size, std::memory_order_relaxed);
+            _OnUsageIncreased(previous, previous + _size);
+        }
+
+        void RegisterFree(size_t _size)
+        {
+            m_allocationCount.fetch_sub(1, std::memory_order_relaxed);
+            m_bytesInUse.fetch_sub(_size, std::memory_order_relaxed);
+        }
+
+        void RegisterFailedAllocation()
+        {
+            m_failedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// @brief Overrides the usage, for allocators which release their memory in bulk.
+        void SetUsage(size_t _bytesInUse, u64 _allocationCount);
+
+        [[nodiscard]] size_t GetBytesInUse() const { return m_bytesInUse.load(std::memory_order_relaxed); }
+
+        /// @brief Returns the tracked counters. Free space is left for the allocator to fill.
+        [[nodiscard]] AllocatorStats GetStats() const;
+
+    private:
+        const char* m_name;
+
+        std::atomic<size_t> m_bytesInUse = 0;
+        std::atomic<size_t> m_peakBytesInUse = 0;
+        std::atomic<u64> m_allocationCount = 0;
+        std::atomic<u64> m_totalAllocationCount = 0;
+        std::atomic<u64> m_failedAllocationCount = 0;
+
+        // Immutable once published, so the callback and its user data are always read as a pair.
+        struct BudgetCallback
+        {
+            AllocatorBudgetCallback m_function;
+            void* m_userData;
+            // Replaced callbacks are kept alive until destruction, as allocations can still be calling them.
+            const BudgetCallback* m_previous;
+        };
+
+        std::atomic<size_t> m_budget = 0;
+        std::atomic<const BudgetCallback*> m_budgetCallback = nullptr;
+
+        void _OnUsageIncreased(size_t _previous, size_t _current)
+        {
+            if (_current > m_peakBytesInUse.load(std::memory_order_relaxed)) [[unlikely]]
+            {
+                _UpdatePeak(_current);
+            }
+            const size_t budget = m_budget.load(std::memory_order_relaxed);
+            if (budget != 0 && _previous <= budget && _current > budget) [[unlikely]]
+            {
+                _OnBudgetExceeded(_current);
+            }
+        }
+
+        void _UpdatePeak(size_t _current);
+        void _OnBudgetExceeded(size_t _current);
+    };
+} // namespace KryneEngine
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+#include "KryneEngine/Core/Memory/Allocators/TlsfAllocator.hpp"
+#include "KryneEngine/Core/Threads/HelperFunctions.hpp"
+#include "KryneEngine/Core/Threads/SpinLock.hpp"
+#include "KryneEngine/Core/Threads/ThreadSlots.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief A thread-safe allocator built on top of a shared `TlsfAllocator`, with per-thread caches.
+     *
+     * @details
+     * Small allocations (up to `kMaxCachedSize` bytes, with an alignment up to `kCachedAlignment`) are served from
+     * per-thread magazines, one per size class, without any synchronization. Empty magazines are refilled with
+     * `kRefillBatchSize` blocks at once, under a single acquisition of the TLSF lock.
+     *
+     * Freed small blocks go back to the calling thread's magazine. When it is full, half of it is pushed at once to a
+     * lock-free remote-free list, as are frees from threads without a cache and large frees while the TLSF lock is
+     * contended. The remote-free list is drained back to the TLSF heap the next time the lock is acquired.
+     *
+     * Every block is preceded by a small prefix holding its size class, written once when the block is taken from the
+     * TLSF heap. Frees read it to route the block, without touching the TLSF block header, which may be written
+     * concurrently under the lock.
+     *
+     * Up to `kMaxThreadCaches` live threads get a cache, other threads always go through the TLSF lock. Caches are
+     * indexed by `Threads::GetThreadSlot()`, so the cache of an exited thread is reused along with its slot.
+     */
+    class ConcurrentTlsfAllocator final: public IAllocator
+    {
+    public:
+        static constexpr size_t kMaxCachedSize = 512;
+        static constexpr size_t kCachedAlignment = 16;
+        static constexpr u32 kSizeClassCount = 16;
+        static constexpr u32 kMagazineCapacity = 32;
+        static constexpr u32 kRefillBatchSize = kMagazineCapacity / 2;
+        static constexpr u32 kMaxThreadCaches = Threads::kMaxThreadSlots;
+
+        ConcurrentTlsfAllocator(const ConcurrentTlsfAllocator& _other) = delete;
+        ConcurrentTlsfAllocator(ConcurrentTlsfAllocator&& _other) = delete;
+        ConcurrentTlsfAllocator& operator=(const ConcurrentTlsfAllocator& _other) = delete;
+        ConcurrentTlsfAllocator& operator=(ConcurrentTlsfAllocator&& _other) = delete;
+
+        void* Allocate(size_t _size, size_t _alignment) override;
+        void Free(void* _ptr, size_t _size) override;
+
+        static ConcurrentTlsfAllocator* Create(AllocatorInstance _parentAllocator, size_t _heapSize);
+        static void Destroy(ConcurrentTlsfAllocator* _allocator);
+
+        void SetAutoGrowth(bool _autoGrowth);
+        void SetTrimPolicy(const TlsfAllocator::TrimPolicy& _policy);
+
+        /**
+         * @brief Gives empty TLSF heaps back to the parent allocator, see `TlsfAllocator::TrimEmptyHeaps()`.
+         *
+         * @details
+         * Can be called from a low priority background job. Blocks cached by threads keep their heap alive, so threads
+         * going idle should call `FlushThreadCache()` first.
+         */
+        u32 TrimEmptyHeaps(u32 _keptEmptyHeaps);
+
+        /// @brief Gives all the blocks cached by the calling thread back to the TLSF heap.
+        void FlushThreadCache();
+
+        /// @brief Returns the tracker of the underlying TLSF heap. Blocks cached by threads count as in use.
+        [[nodiscard]] AllocatorTracker* GetTracker() override { return m_tlsf->GetTracker(); }
+        bool GetAllocatorStats(AllocatorStats& _stats) override;
+
+        [[nodiscard]] static u32 GetSizeClass(size_t _size);
+        [[nodiscard]] static size_t GetSizeClassSize(u32 _sizeClass);
+
+    private:
+        ConcurrentTlsfAllocator(AllocatorInstance _parentAllocator, TlsfAllocator* _tlsf);
+        ~ConcurrentTlsfAllocator() override;
+
+        struct RemoteFreeNode
+        {
+            RemoteFreeNode* m_next;
+        };
+
+        struct Magazine
+        {
+            u32 m_count = 0;
+            void* m_blocks[kMagazineCapacity];
+        };
+
+        struct alignas(Threads::kCacheLineSize) ThreadCache
+        {
+            Magazine m_magazines[kSizeClassCount];
+        };
+
+        AllocatorInstance m_parentAllocator;
+        TlsfAllocator* m_tlsf;
+        SpinLock m_lock;
+
+        alignas(Threads::kCacheLineSize) std::atomic<RemoteFreeNode*> m_remoteFreeList = nullptr;
+
+        // Each slot is only ever written by the thread owning the matching thread slot.
+        alignas(Threads::kCacheLineSize) ThreadCache* m_threadCaches[kMaxThreadCaches] {};
+
+        ThreadCache* _GetThreadCache();
+        void* _AllocateFromHeap(size_t _size, size_t _alignment);
+        void _Refill(Magazine& _magazine, u32 _sizeClass);
+        void _PushRemoteFrees(RemoteFreeNode* _first, RemoteFreeNode* _last);
+        void _DrainRemoteFrees();
+    };
+} // namespace KryneEngine
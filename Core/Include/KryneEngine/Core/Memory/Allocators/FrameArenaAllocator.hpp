@@ -0,0 +1,151 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+#include "KryneEngine/Core/Memory/Allocators/AllocatorTracker.hpp"
+#include "KryneEngine/Core/Threads/HelperFunctions.hpp"
+#include "KryneEngine/Core/Threads/SpinLock.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief A multi-buffered bump allocator for per-frame transient data.
+     *
+     * @details
+     * The allocator owns one region per buffered frame. Allocations are bumped from the region of the current frame,
+     * and are never freed individually: `Free()` is a no-op, and the whole region is reset when its frame slot comes
+     * back around in `BeginFrame()`. Memory allocated during frame `N` thus stays valid until
+     * `BeginFrame(N + frameCount)`.
+     *
+     * Each fiber thread bumps from its own sub-arena, a `kChunkSize` chunk grabbed from the frame region with a single
+     * atomic add, so fiber jobs never contend. Other threads share a last sub-arena behind a spin lock. Allocations
+     * bigger than `kMaxSubArenaAllocationSize` are directly taken from the frame region.
+     *
+     * Once a frame region is exhausted, memory is taken from a chain of overflow blocks allocated from the parent
+     * allocator, which are released on the next reset of the frame. The high-water statistics can be used to size the
+     * regions so overflows stay exceptional.
+     *
+     * The tracker usage covers the live memory of all the buffered frames. As allocations are never freed individually,
+     * it is only updated in `BeginFrame()`, where the budget is checked, and allocation counts are not tracked.
+     *
+     * `BeginFrame()` must not be called concurrently with allocations.
+     */
+    class FrameArenaAllocator final: public IAllocator
+    {
+    public:
+        static constexpr u8 kMaxFrameCount = 4;
+        static constexpr size_t kChunkSize = 16 * 1024;
+        static constexpr size_t kChunkAlignment = Threads::kCacheLineSize;
+        static constexpr size_t kMaxSubArenaAllocationSize = kChunkSize / 4;
+        static constexpr size_t kDefaultAlignment = 16;
+
+        struct Stats
+        {
+            size_t m_regionBytes = 0;
+            size_t m_overflowBytes = 0;
+            u32 m_overflowBlockCount = 0;
+
+            size_t m_highWaterBytes = 0;
+            size_t m_highWaterOverflowBytes = 0;
+            u64 m_overflowedFrameCount = 0;
+        };
+
+        FrameArenaAllocator(const FrameArenaAllocator& _other) = delete;
+        FrameArenaAllocator(FrameArenaAllocator&& _other) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator& _other) = delete;
+        FrameArenaAllocator& operator=(FrameArenaAllocator&& _other) = delete;
+
+        void* Allocate(size_t _size, size_t _alignment) override;
+        void Free(void* _ptr, size_t _size) override {}
+
+        /**
+         * @param _parentAllocator Allocator used for the frame regions, sub-arena states and overflow blocks.
+         * @param _regionSize Size of each frame region.
+         * @param _frameCount Number of buffered frames, from 1 to `kMaxFrameCount`.
+         * @param _threadCount Number of fiber threads getting a lock-free sub-arena.
+         */
+        static FrameArenaAllocator* Create(
+            AllocatorInstance _parentAllocator,
+            size_t _regionSize,
+            u8 _frameCount,
+            u16 _threadCount);
+        static void Destroy(FrameArenaAllocator* _allocator);
+
+        /// @brief Switches to the region of `_frameId`, releasing everything allocated in it `frameCount` frames ago.
+        void BeginFrame(u64 _frameId);
+
+        [[nodiscard]] u8 GetFrameCount() const { return m_frameCount; }
+        [[nodiscard]] size_t GetRegionSize() const { return m_regionSize; }
+
+        /// @brief Returns the current frame usage, along with the high-water marks across all frames so far.
+        [[nodiscard]] Stats GetStats() const;
+
+        [[nodiscard]] AllocatorTracker* GetTracker() override { return &m_tracker; }
+
+        /// @brief Reports the live memory of all frames, and the remaining space of the current frame region as free.
+        bool GetAllocatorStats(AllocatorStats& _stats) override;
+
+    private:
+        FrameArenaAllocator(AllocatorInstance _parentAllocator, size_t _regionSize, u8 _frameCount, u16 _threadCount);
+        ~FrameArenaAllocator() override;
+
+        struct OverflowBlock
+        {
+            OverflowBlock* m_next;
+            size_t m_size;
+            size_t m_offset;
+        };
+        static constexpr size_t kOverflowHeaderSize = Alignment::AlignUp(sizeof(OverflowBlock), kChunkAlignment);
+
+        struct FrameRegion
+        {
+            std::byte* m_memory = nullptr;
+            alignas(Threads::kCacheLineSize) std::atomic<size_t> m_offset = 0;
+            OverflowBlock* m_overflowBlocks = nullptr;
+            size_t m_overflowBytes = 0;
+            u32 m_overflowBlockCount = 0;
+        };
+
+        struct alignas(Threads::kCacheLineSize) SubArena
+        {
+            std::byte* m_cursor = nullptr;
+            std::byte* m_end = nullptr;
+        };
+
+        AllocatorInstance m_parentAllocator;
+        size_t m_regionSize;
+        u8 m_frameCount;
+        u8 m_currentFrame = 0;
+        u16 m_threadCount;
+
+        FrameRegion m_frames[kMaxFrameCount] {};
+
+        // One sub-arena per fiber thread, plus a shared one for the other threads.
+        SubArena* m_subArenas = nullptr;
+        SpinLock m_sharedSubArenaLock;
+        mutable SpinLock m_overflowLock;
+
+        size_t m_highWaterBytes = 0;
+        size_t m_highWaterOverflowBytes = 0;
+        u64 m_overflowedFrameCount = 0;
+
+        AllocatorTracker m_tracker { "Frame arena" };
+
+        void* _AllocateFromSubArena(SubArena& _subArena, size_t _size, size_t _alignment);
+        std::byte* _AllocateFromRegion(size_t _size, size_t _alignment);
+        std::byte* _AllocateFromOverflow(FrameRegion& _frame, size_t _size, size_t _alignment);
+        void _ReleaseOverflowBlocks(FrameRegion& _frame);
+        void _UpdateHighWater(const FrameRegion& _frame);
+        [[nodiscard]] size_t _GetRegionUsage(const FrameRegion& _frame) const;
+        [[nodiscard]] size_t _GetLiveBytes() const;
+    };
+} // namespace KryneEngine
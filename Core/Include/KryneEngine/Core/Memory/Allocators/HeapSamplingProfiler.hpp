@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <EASTL/hash_map.h>
+#include <EASTL/vector.h>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Threads/HelperFunctions.hpp"
+#include "KryneEngine/Core/Threads/SpinLock.hpp"
+#include "KryneEngine/Core/Threads/ThreadSlots.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief Low overhead sampling profiler for heap allocations.
+     *
+     * @details
+     * Instead of tracking every allocation, one allocation is sampled every `samplingInterval` bytes on average. The
+     * distance between two samples is drawn from an exponential distribution (Poisson process sampling), so every
+     * allocated byte has the same chance of triggering a sample, regardless of the allocation pattern. Each sample
+     * is weighted by the inverse of its sampling probability, which gives unbiased estimates of the allocated and live
+     * bytes of each site.
+     *
+     * Unsampled allocations only decrement a per-thread counter, and unsampled frees check a small counting filter
+     * of the live sampled addresses. Sampled allocations capture their callstack, and are pushed to a per-thread
+     * buffer, which is only merged into the shared site table when full or when a report is taken.
+     *
+     * Per-thread state is indexed by `Threads::GetThreadSlot()`, and inherited along with the slot when a thread exits.
+     * Allocations of threads without a slot are not sampled.
+     *
+     * The profiler fed by the default heap is available through `AllocatorInstance::GetDefaultHeapProfiler()`.
+     */
+    class HeapSamplingProfiler
+    {
+    public:
+        static constexpr size_t kDefaultSamplingInterval = 512 * 1024;
+        static constexpr u32 kMaxCallstackDepth = 24;
+        static constexpr u32 kThreadBufferCapacity = 64;
+
+        enum class ReportType: u8
+        {
+            LiveHeap,
+            AllocationRate,
+        };
+
+        struct SiteReport
+        {
+            u64 m_siteHash;
+            u32 m_callstackDepth;
+            void* m_callstack[kMaxCallstackDepth];
+
+            // Estimations, extrapolated from the samples
+            u64 m_liveCount;
+            u64 m_liveBytes;
+            u64 m_allocatedCount;
+            u64 m_allocatedBytes;
+        };
+
+        struct Report
+        {
+            ReportType m_type;
+            /// Sites sorted by live bytes or allocated bytes, depending on the report type.
+            eastl::vector<SiteReport> m_sites;
+            u64 m_liveBytes = 0;
+            u64 m_allocatedBytes = 0;
+            u64 m_sampleCount = 0;
+            /// Time over which the allocated counts were accumulated, to compute allocation rates.
+            double m_durationSeconds = 0;
+        };
+
+        /**
+         * @param _samplingInterval See `SetSamplingInterval()`.
+         * @param _skippedFrameCount Number of innermost frames dropped from the captured callstacks, on top of the
+         * profiler's own frame, to hide the allocator functions calling `RegisterAllocation()`.
+         */
+        explicit HeapSamplingProfiler(size_t _samplingInterval = kDefaultSamplingInterval, u32 _skippedFrameCount = 0);
+        ~HeapSamplingProfiler();
+
+        HeapSamplingProfiler(const HeapSamplingProfiler&) = delete;
+        HeapSamplingProfiler& operator=(const HeapSamplingProfiler&) = delete;
+
+        inline void RegisterAllocation(void* _ptr, size_t _size)
+        {
+            const u32 threadSlot = Threads::GetThreadSlot();
+            if (threadSlot == Threads::kNoThreadSlot) [[unlikely]]
+            {
+                return;
+            }
+
+            ThreadState& threadState = m_threadStates[threadSlot];
+            threadState.m_bytesUntilNextSample -= static_cast<s64>(_size);
+            if (threadState.m_bytesUntilNextSample <= 0) [[unlikely]]
+            {
+                _OnSamplingPoint(threadState, _ptr, _size);
+            }
+        }
+
+        inline void RegisterDeallocation(void* _ptr)
+        {
+            if (m_liveFilter[_GetFilterIndex(_ptr)].load(std::memory_order_relaxed) != 0) [[unlikely]]
+            {
+                _OnPossibleSampleFree(_ptr);
+            }
+        }
+
+        /// @brief Sets the mean number of bytes between two samples. Sampling is disabled if 0.
+        void SetSamplingInterval(size_t _interval);
+        [[nodiscard]] size_t GetSamplingInterval() const { return m_samplingInterval.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Merges all thread buffers and returns the estimated usage of each allocation site.
+         * @param _resetAllocationCounters If true, the allocated counts of the next report start from this point.
+         */
+        [[nodiscard]] Report TakeReport(ReportType _type, bool _resetAllocationCounters = true);
+
+        /// @brief Writes the top sites of a report as text, symbolizing the callstacks when the platform allows it.
+        static void PrintReport(const Report& _report, FILE* _file, u32 _maxSiteCount = 32);
+
+    private:
+        // Internal containers directly use the system heap, so they are not tracked themselves.
+        class CustomAllocator
+        {
+        public:
+            CustomAllocator() = default;
+            explicit CustomAllocator(const char* _name) {}
+
+            void* allocate(size_t _size, int _flags = 0);
+            /// Alignment offsets are not supported, and fail the allocation.
+            void* allocate(size_t _size, size_t _alignment, size_t _alignmentOffset = 0, int _flags = 0);
+            void deallocate(void* _ptr, size_t _size = 0);
+        };
+
+        struct PendingSample
+        {
+            void* m_ptr;
+            size_t m_size;
+            double m_weight;
+            u32 m_callstackDepth;
+            bool m_freed;
+            void* m_callstack[kMaxCallstackDepth];
+        };
+
+        struct ThreadBuffer
+        {
+            SpinLock m_lock;
+            u32 m_count = 0;
+            PendingSample m_samples[kThreadBufferCapacity];
+        };
+
+        struct alignas(Threads::kCacheLineSize) ThreadState
+        {
+            s64 m_bytesUntilNextSample = 0;
+            // 0 until the first sampling point of the thread slot, which only seeds the generator.
+            u64 m_randomState = 0;
+            // Allocated on the first sample, and only written under `m_lock`.
+            ThreadBuffer* m_buffer = nullptr;
+        };
+
+        struct Site
+        {
+            u32 m_callstackDepth;
+            void* m_callstack[kMaxCallstackDepth];
+            double m_liveCount;
+            double m_liveBytes;
+            double m_allocatedCount;
+            double m_allocatedBytes;
+        };
+
+        struct LiveSample
+        {
+            u64 m_siteHash;
+            double m_weight;
+            size_t m_size;
+        };
+
+        static constexpr u32 kLiveFilterSizePot = 12;
+
+        std::atomic<size_t> m_samplingInterval;
+        u32 m_skippedFrameCount;
+
+        // Each state is only ever accessed by the thread owning the matching thread slot, except for its buffer.
+        ThreadState m_threadStates[Threads::kMaxThreadSlots] {};
+
+        // Number of live samples per address bucket, including the ones still pending in thread buffers.
+        std::atomic<u16> m_liveFilter[1u << kLiveFilterSizePot] {};
+
+        SpinLock m_lock;
+        eastl::hash_map<u64, Site, eastl::hash<u64>, eastl::equal_to<u64>, CustomAllocator> m_sites;
+        eastl::hash_map<void*, LiveSample, eastl::hash<void*>, eastl::equal_to<void*>, CustomAllocator> m_liveSamples;
+        u64 m_sampleCount = 0;
+        std::chrono::steady_clock::time_point m_allocationCountersStart;
+
+        static u32 _GetFilterIndex(const void* _ptr)
+        {
+            return static_cast<u32>((reinterpret_cast<uintptr_t>(_ptr) >> 4) * 0x9E37'79B9'7F4A'7C15ull
+                >> (64 - kLiveFilterSizePot));
+        }
+
+        void _OnSamplingPoint(ThreadState& _threadState, void* _ptr, size_t _size);
+        void _OnPossibleSampleFree(void* _ptr);
+        ThreadBuffer* _AcquireThreadBuffer(ThreadState& _threadState);
+        void _FlushThreadBuffer(ThreadBuffer& _buffer);
+        [[nodiscard]] s64 _DrawSamplingDistance(ThreadState& _threadState) const;
+    };
+}
@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+#include "KryneEngine/Core/Threads/HelperFunctions.hpp"
+#include "KryneEngine/Core/Threads/SpinLock.hpp"
+#include "KryneEngine/Core/Threads/ThreadSlots.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief A size-class slab allocator for small fixed-size objects.
+     *
+     * @details
+     * The allocator reserves a single contiguous heap from its parent allocator, split in `kPageSize` pages. Each page
+     * is dedicated to a size class (16 to 256 bytes, by steps of 16 bytes), and starts with a header holding the
+     * free list of its slots. Since pages are aligned on `kPageSize`, freeing a slot only needs to mask its address to
+     * find its page, and checking whether a pointer belongs to the slab heap is a simple range check.
+     *
+     * Allocations which don't fit a size class (too big, or aligned on more than `kMaxSlotAlignment`), as well as
+     * allocations done once the slab heap is full, are forwarded to the parent allocator.
+     *
+     * The allocator is thread-safe. When created with thread caching, up to `kMaxThreadCaches` live threads get per-size
+     * class magazines, so most allocations and frees don't need to take the lock. Caches are indexed by
+     * `Threads::GetThreadSlot()`, so the cache of an exited thread is reused along with its slot.
+     */
+    class SlabAllocator final: public IAllocator
+    {
+    public:
+        static constexpr size_t kPageSize = 64 * 1024;
+        static constexpr size_t kSizeClassGranularity = 16;
+        static constexpr size_t kMaxSlotSize = 256;
+        static constexpr size_t kMaxSlotAlignment = 64;
+        static constexpr u32 kSizeClassCount = kMaxSlotSize / kSizeClassGranularity;
+        static constexpr u32 kInvalidSizeClass = kSizeClassCount;
+        static constexpr u32 kMagazineCapacity = 64;
+        static constexpr u32 kRefillBatchSize = kMagazineCapacity / 2;
+        static constexpr u32 kMaxThreadCaches = Threads::kMaxThreadSlots;
+
+        SlabAllocator(const SlabAllocator& _other) = delete;
+        SlabAllocator(SlabAllocator&& _other) = delete;
+        SlabAllocator& operator=(const SlabAllocator& _other) = delete;
+        SlabAllocator& operator=(SlabAllocator&& _other) = delete;
+
+        void* Allocate(size_t _size, size_t _alignment) override;
+        void Free(void* _ptr, size_t _size) override;
+
+        /**
+         * @param _parentAllocator Allocator providing the slab heap, and used for allocations not fitting a size class.
+         * @param _heapSize Size of the slab heap, rounded up to a multiple of `kPageSize`.
+         * @param _threadCaching Enables per-thread slot caches.
+         */
+        static SlabAllocator* Create(AllocatorInstance _parentAllocator, size_t _heapSize, bool _threadCaching);
+        static void Destroy(SlabAllocator* _allocator);
+
+        /// @brief Gives all the slots cached by the calling thread back to their pages.
+        void FlushThreadCache();
+
+        [[nodiscard]] bool Owns(const void* _ptr) const
+        {
+            return reinterpret_cast<uintptr_t>(_ptr) - reinterpret_cast<uintptr_t>(m_heapStart) < m_heapSize;
+        }
+
+        [[nodiscard]] u32 GetUsedPageCount() const { return m_usedPageCount; }
+
+        /// @return The size class able to hold `_size` bytes at `_alignment`, or `kInvalidSizeClass` if none fits.
+        [[nodiscard]] static u32 GetSizeClass(size_t _size, size_t _alignment);
+        [[nodiscard]] static size_t GetSlotSize(u32 _sizeClass) { return (_sizeClass + 1) * kSizeClassGranularity; }
+
+    private:
+        SlabAllocator(AllocatorInstance _parentAllocator, std::byte* _heapStart, size_t _heapSize, bool _threadCaching);
+        ~SlabAllocator() override;
+
+        struct FreeSlot
+        {
+            FreeSlot* m_next;
+        };
+
+        struct PageHeader
+        {
+            PageHeader* m_next;
+            PageHeader* m_previous;
+            FreeSlot* m_freeSlots;
+            u32 m_usedCount;
+            u32 m_capacity;
+            u32 m_carvedCount;
+            u32 m_sizeClass;
+        };
+
+        static constexpr size_t kPageHeaderSize = kMaxSlotAlignment;
+        static_assert(sizeof(PageHeader) <= kPageHeaderSize);
+
+        struct Magazine
+        {
+            u32 m_count = 0;
+            void* m_slots[kMagazineCapacity];
+        };
+
+        struct alignas(Threads::kCacheLineSize) ThreadCache
+        {
+            Magazine m_magazines[kSizeClassCount];
+        };
+
+        AllocatorInstance m_parentAllocator;
+        std::byte* m_heapStart;
+        size_t m_heapSize;
+        bool m_threadCaching;
+
+        SpinLock m_lock;
+
+        // Pages with free slots, per size class.
+        PageHeader* m_partialPages[kSizeClassCount] {};
+        // Released pages, linked through their header.
+        PageHeader* m_freePages = nullptr;
+        u32 m_untouchedPageIndex = 0;
+        u32 m_usedPageCount = 0;
+
+        // Each slot is only ever written by the thread owning the matching thread slot.
+        ThreadCache* m_threadCaches[kMaxThreadCaches] {};
+
+        ThreadCache* _GetThreadCache();
+        void* _AllocateSlot(u32 _sizeClass);
+        void _FreeSlot(void* _ptr);
+        PageHeader* _AcquirePage(u32 _sizeClass);
+        void _ReleasePage(PageHeader* _page);
+        void _LinkPartialPage(PageHeader* _page);
+        void _UnlinkPartialPage(PageHeader* _page);
+
+        [[nodiscard]] PageHeader* _GetPage(const void* _ptr) const
+        {
+            const size_t offset = static_cast<const std::byte*>(_ptr) - m_heapStart;
+            return reinterpret_cast<PageHeader*>(m_heapStart + (offset & ~(kPageSize - 1)));
+        }
+    };
+} // namespace KryneEngine
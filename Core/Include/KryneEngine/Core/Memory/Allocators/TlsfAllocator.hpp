@@ -8,6 +8,7 @@
 
 #include "KryneEngine/Core/Common/Types.hpp"
 #include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+#include "KryneEngine/Core/Memory/Allocators/AllocatorTracker.hpp"
 
 namespace KryneEngine
 {
@@ -27,10 +28,25 @@ namespace KryneEngine
      * at the start of the initial heap, and will be followed by the TLSF heap control block, with the remaining of the
      * heap used as the initial heap pool.
      * This allows the allocator to be fully accounted for memory-wise.
+     *
+     * With auto-growth, additional heaps of the same size are requested from the parent allocator when no free block
+     * fits an allocation. Additional heaps which become completely empty can be given back with `TrimEmptyHeaps()`,
+     * or automatically following the `TrimPolicy`.
+     *
+     * Used blocks are tracked, including their alignment and minimum block size overheads. The allocator stats also
+     * report the fragmentation of the free blocks, by walking the free lists.
      */
     class TlsfAllocator: public IAllocator
     {
     public:
+        struct TrimPolicy
+        {
+            /// Number of empty heaps kept when trimming, to absorb the next allocation spike.
+            u32 m_keptEmptyHeaps = 1;
+            /// Automatically trims when the number of empty heaps goes over this threshold. Disabled if 0.
+            u32 m_autoTrimThreshold = 0;
+        };
+
         TlsfAllocator(const TlsfAllocator& _other) = delete;
         TlsfAllocator(TlsfAllocator&& _other) = delete;
         TlsfAllocator& operator=(const TlsfAllocator& _other) = delete;
@@ -47,6 +63,26 @@ namespace KryneEngine
 
         bool AddHeap();
 
+        /**
+         * @brief Gives completely empty additional heaps back to the parent allocator.
+         * @param _keptEmptyHeaps Number of empty heaps to keep.
+         * @return The number of released heaps.
+         */
+        u32 TrimEmptyHeaps(u32 _keptEmptyHeaps);
+
+        void SetTrimPolicy(const TrimPolicy& _policy);
+        [[nodiscard]] const TrimPolicy& GetTrimPolicy() const { return m_trimPolicy; }
+
+        /// @brief Number of heaps, including the initial one.
+        [[nodiscard]] u32 GetHeapCount() const { return m_heapCount; }
+        /// @brief Number of additional heaps with no used block.
+        [[nodiscard]] u32 GetEmptyHeapCount() const { return m_emptyHeapCount; }
+        /// @brief Total size of the used blocks, including alignment and minimum block size overheads.
+        [[nodiscard]] size_t GetUsedBytes() const { return m_tracker.GetBytesInUse(); }
+
+        [[nodiscard]] AllocatorTracker* GetTracker() override { return &m_tracker; }
+        bool GetAllocatorStats(AllocatorStats& _stats) override;
+
     protected:
         explicit TlsfAllocator(AllocatorInstance _parentAllocator, size_t _heapSize, u32 _allocatorSize);
         ~TlsfAllocator() override;
@@ -69,6 +105,11 @@ namespace KryneEngine
         u32 m_allocatorSize;
         bool m_autoGrowth = true;
 
+        TrimPolicy m_trimPolicy {};
+        u32 m_heapCount = 1;
+        u32 m_emptyHeapCount = 0;
+        AllocatorTracker m_tracker { "TLSF allocator" };
+
         void InsertBlock(TlsfHeap::BlockHeader* _block);
         void RemoveBlock(TlsfHeap::BlockHeader* _block, u8 _fl, u8 _sl);
         static TlsfHeap::BlockHeader* LinkNext(TlsfHeap::BlockHeader* _block);
@@ -88,5 +129,8 @@ namespace KryneEngine
         TlsfHeap::BlockHeader* MergePreviousBlock(TlsfHeap::BlockHeader* _block);
         TlsfHeap::BlockHeader* MergeNextBlock(TlsfHeap::BlockHeader* _block);
         static TlsfHeap::BlockHeader* MergeBlocks(TlsfHeap::BlockHeader* _left, TlsfHeap::BlockHeader* _right);
+
+        [[nodiscard]] size_t GetAdditionalHeapPoolSize() const;
+        [[nodiscard]] bool IsWholeAdditionalHeap(const TlsfHeap::BlockHeader* _block) const;
     };
 } // namespace KryneEngine
@@ -0,0 +1,239 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <EASTL/functional.h>
+#include <EASTL/tuple.h>
+#include <EASTL/utility.h>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define KE_FLAT_HASH_MAP_SSE2 1
+#else
+#   define KE_FLAT_HASH_MAP_SSE2 0
+#endif
+
+namespace KryneEngine
+{
+    namespace FlatHashMapDetail
+    {
+        using Control = s8;
+
+        static constexpr Control kEmpty = -128;
+        static constexpr Control kDeleted = -2;
+        static constexpr Control kSentinel = -1;
+
+        /// @brief Set of matching slots in a group, iterated from the lowest slot.
+        template <class T, u32 Shift>
+        struct BitMask
+        {
+            T m_mask;
+
+            [[nodiscard]] explicit operator bool() const { return m_mask != 0; }
+            [[nodiscard]] u32 LowestBit() const;
+            [[nodiscard]] u32 TrailingZeros() const;
+            [[nodiscard]] u32 LeadingZeros(u32 _width) const;
+
+            BitMask& operator++()
+            {
+                m_mask &= m_mask - 1;
+                return *this;
+            }
+        };
+
+#if KE_FLAT_HASH_MAP_SSE2
+        /// @brief Group of 16 control bytes, matched with SSE2 compares and a movemask.
+        struct Group
+        {
+            static constexpr u32 kWidth = 16;
+            using Mask = BitMask<u32, 0>;
+
+            __m128i m_control;
+
+            explicit Group(const Control* _control);
+
+            [[nodiscard]] Mask Match(Control _h2) const;
+            [[nodiscard]] Mask MatchEmpty() const;
+            [[nodiscard]] Mask MatchEmptyOrDeleted() const;
+        };
+#else
+        /// @brief Group of 8 control bytes, matched 8 at a time within a u64 register.
+        struct Group
+        {
+            static constexpr u32 kWidth = 8;
+            using Mask = BitMask<u64, 3>;
+
+            u64 m_control;
+
+            explicit Group(const Control* _control);
+
+            // Can report false positives for bytes following a match, which are filtered out by the key comparison.
+            [[nodiscard]] Mask Match(Control _h2) const;
+            [[nodiscard]] Mask MatchEmpty() const;
+            [[nodiscard]] Mask MatchEmptyOrDeleted() const;
+        };
+#endif
+    }
+
+    /**
+     * @brief Open addressing hash map, with SwissTable-style metadata probing.
+     *
+     * @details
+     * Entries are stored inline in a single allocation, next to an array of control bytes, one per slot, holding
+     * either 7 bits of the entry hash or an empty/deleted marker. Lookups compare a whole group of control bytes
+     * against the hash at once (16 with SSE2, 8 with a portable u64 fallback), and only compare keys for the matching
+     * slots. Nothing is allocated per entry, and a probe mostly touches one control group and one slot.
+     *
+     * The capacity is always a power of two minus one, and grows with a maximum load factor of 7/8. Erasing leaves a
+     * tombstone when needed to keep probe sequences intact; tombstones are cleaned up on the next rehash.
+     *
+     * Any insertion can rehash the table, which invalidates iterators and pointers to entries. Keys must not be
+     * modified through iterators.
+     */
+    template <
+        class Key,
+        class Value,
+        class Hash = eastl::hash<Key>,
+        class Equal = eastl::equal_to<Key>,
+        class Allocator = AllocatorInstance>
+    class FlatHashMap
+    {
+        using Control = FlatHashMapDetail::Control;
+        using Group = FlatHashMapDetail::Group;
+
+    public:
+        using ValueType = eastl::pair<Key, Value>;
+
+        template <bool Const>
+        class IteratorBase
+        {
+            friend class FlatHashMap;
+            template <bool> friend class IteratorBase;
+            using Entry = eastl::conditional_t<Const, const ValueType, ValueType>;
+
+        public:
+            IteratorBase() = default;
+            template <bool OtherConst> requires (Const && !OtherConst)
+            IteratorBase(const IteratorBase<OtherConst>& _other)
+                : m_control(_other.m_control)
+                , m_entry(_other.m_entry)
+            {}
+
+            Entry& operator*() const { return *m_entry; }
+            Entry* operator->() const { return m_entry; }
+
+            IteratorBase& operator++()
+            {
+                m_control++;
+                m_entry++;
+                _SkipEmptySlots();
+                return *this;
+            }
+
+            bool operator==(const IteratorBase& _other) const { return m_entry == _other.m_entry; }
+
+        private:
+            IteratorBase(const Control* _control, Entry* _entry): m_control(_control), m_entry(_entry) {}
+
+            const Control* m_control = nullptr;
+            Entry* m_entry = nullptr;
+
+            // The control array is terminated by a sentinel byte, which stops the skip at `end()`.
+            void _SkipEmptySlots()
+            {
+                while (*m_control < FlatHashMapDetail::kSentinel)
+                {
+                    m_control++;
+                    m_entry++;
+                }
+            }
+        };
+
+        using Iterator = IteratorBase<false>;
+        using ConstIterator = IteratorBase<true>;
+
+        FlatHashMap() = default;
+        explicit FlatHashMap(const Allocator& _allocator): m_allocator(_allocator) {}
+
+        FlatHashMap(const FlatHashMap& _other);
+        FlatHashMap& operator=(const FlatHashMap& _other);
+        FlatHashMap(FlatHashMap&& _other) noexcept;
+        FlatHashMap& operator=(FlatHashMap&& _other) noexcept;
+
+        ~FlatHashMap();
+
+        [[nodiscard]] Iterator Find(const Key& _key);
+        [[nodiscard]] ConstIterator Find(const Key& _key) const;
+        [[nodiscard]] bool Contains(const Key& _key) const { return Find(_key) != end(); }
+
+        /**
+         * @brief Constructs the value from `_args` if `_key` isn't in the map yet.
+         * @return The entry of the key, and whether it was inserted.
+         */
+        template <class K, class... Args>
+        eastl::pair<Iterator, bool> TryEmplace(K&& _key, Args&&... _args);
+
+        eastl::pair<Iterator, bool> Insert(const Key& _key, const Value& _value) { return TryEmplace(_key, _value); }
+        eastl::pair<Iterator, bool> Insert(Key&& _key, Value&& _value)
+        {
+            return TryEmplace(eastl::move(_key), eastl::move(_value));
+        }
+
+        /// @brief Inserts a default constructed value if the key isn't in the map yet.
+        Value& operator[](const Key& _key) { return TryEmplace(_key).first->second; }
+
+        bool Erase(const Key& _key);
+        void Erase(ConstIterator _it);
+
+        void Clear();
+
+        /// @brief Grows the table so `_count` entries can be stored without rehashing.
+        void Reserve(size_t _count);
+
+        [[nodiscard]] size_t Size() const { return m_size; }
+        [[nodiscard]] bool Empty() const { return m_size == 0; }
+        [[nodiscard]] size_t Capacity() const { return m_capacity; }
+
+        [[nodiscard]] const Allocator& GetAllocator() const { return m_allocator; }
+
+        Iterator begin();
+        Iterator end() { return Iterator(m_control + m_capacity, m_entries + m_capacity); }
+        ConstIterator begin() const { return const_cast<FlatHashMap*>(this)->begin(); }
+        ConstIterator end() const { return const_cast<FlatHashMap*>(this)->end(); }
+
+    private:
+        static constexpr size_t kMinCapacity = Group::kWidth - 1;
+
+        Allocator m_allocator {};
+        Hash m_hash {};
+        Equal m_equal {};
+
+        // One control byte per slot, followed by a sentinel and a copy of the first `Group::kWidth - 1` bytes, so
+        // groups can be loaded at any slot without wrapping around.
+        Control* m_control = nullptr;
+        ValueType* m_entries = nullptr;
+        size_t m_capacity = 0;
+        size_t m_size = 0;
+        size_t m_growthLeft = 0;
+
+        [[nodiscard]] static u64 _Mix(size_t _hash);
+        [[nodiscard]] static size_t _GrowthCapacity(size_t _capacity);
+        [[nodiscard]] static size_t _CapacityForCount(size_t _count);
+        [[nodiscard]] static size_t _ControlSize(size_t _capacity) { return _capacity + Group::kWidth; }
+        [[nodiscard]] static size_t _EntriesOffset(size_t _capacity);
+
+        [[nodiscard]] size_t _FindIndex(const Key& _key, u64 _hash) const;
+        [[nodiscard]] size_t _FindInsertIndex(u64 _hash) const;
+        void _SetControl(size_t _index, Control _value);
+        void _EraseAt(size_t _index);
+        void _Rehash(size_t _capacity);
+        void _Release();
+    };
+} // namespace KryneEngine
@@ -0,0 +1,455 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "FlatHashMap.hpp"
+
+#include <bit>
+#include <cstring>
+#include <new>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+
+namespace KryneEngine
+{
+    namespace FlatHashMapDetail
+    {
+        template <class T, u32 Shift>
+        u32 BitMask<T, Shift>::LowestBit() const
+        {
+            return TrailingZeros();
+        }
+
+        template <class T, u32 Shift>
+        u32 BitMask<T, Shift>::TrailingZeros() const
+        {
+            return std::countr_zero(m_mask) >> Shift;
+        }
+
+        template <class T, u32 Shift>
+        u32 BitMask<T, Shift>::LeadingZeros(u32 _width) const
+        {
+            constexpr u32 totalBits = sizeof(T) * 8;
+            return (std::countl_zero(m_mask) - (totalBits - (_width << Shift))) >> Shift;
+        }
+
+#if KE_FLAT_HASH_MAP_SSE2
+        inline Group::Group(const Control* _control)
+            : m_control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_control)))
+        {}
+
+        inline Group::Mask Group::Match(Control _h2) const
+        {
+            const __m128i match = _mm_set1_epi8(_h2);
+            return { static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(match, m_control))) };
+        }
+
+        inline Group::Mask Group::MatchEmpty() const
+        {
+            const __m128i empty = _mm_set1_epi8(kEmpty);
+            return { static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(empty, m_control))) };
+        }
+
+        inline Group::Mask Group::MatchEmptyOrDeleted() const
+        {
+            const __m128i sentinel = _mm_set1_epi8(kSentinel);
+            return { static_cast<u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(sentinel, m_control))) };
+        }
+#else
+        // Bytes are matched by setting their most significant bit, which assumes a little endian load.
+        static constexpr u64 kLsbs = 0x0101010101010101ull;
+        static constexpr u64 kMsbs = 0x8080808080808080ull;
+
+        inline Group::Group(const Control* _control)
+        {
+            memcpy(&m_control, _control, sizeof(m_control));
+        }
+
+        inline Group::Mask Group::Match(Control _h2) const
+        {
+            const u64 x = m_control ^ (kLsbs * static_cast<u8>(_h2));
+            return { (x - kLsbs) & ~x & kMsbs };
+        }
+
+        inline Group::Mask Group::MatchEmpty() const
+        {
+            // Only empty has its top bit set and its second lowest bit clear.
+            return { m_control & ~(m_control << 6) & kMsbs };
+        }
+
+        inline Group::Mask Group::MatchEmptyOrDeleted() const
+        {
+            // Sentinel is the only special value with its lowest bit set.
+            return { m_control & ~(m_control << 7) & kMsbs };
+        }
+#endif
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::FlatHashMap(const FlatHashMap& _other)
+        : m_allocator(_other.m_allocator)
+        , m_hash(_other.m_hash)
+        , m_equal(_other.m_equal)
+    {
+        Reserve(_other.m_size);
+        for (const ValueType& entry: _other)
+        {
+            TryEmplace(entry.first, entry.second);
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>&
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::operator=(const FlatHashMap& _other)
+    {
+        if (this != &_other)
+        {
+            // Release first, to make sure the original buffer is freed from the proper allocator
+            _Release();
+            m_allocator = _other.m_allocator;
+            m_hash = _other.m_hash;
+            m_equal = _other.m_equal;
+
+            Reserve(_other.m_size);
+            for (const ValueType& entry: _other)
+            {
+                TryEmplace(entry.first, entry.second);
+            }
+        }
+        return *this;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::FlatHashMap(FlatHashMap&& _other) noexcept
+        : m_allocator(_other.m_allocator)
+        , m_hash(eastl::move(_other.m_hash))
+        , m_equal(eastl::move(_other.m_equal))
+        , m_control(_other.m_control)
+        , m_entries(_other.m_entries)
+        , m_capacity(_other.m_capacity)
+        , m_size(_other.m_size)
+        , m_growthLeft(_other.m_growthLeft)
+    {
+        _other.m_control = nullptr;
+        _other.m_entries = nullptr;
+        _other.m_capacity = 0;
+        _other.m_size = 0;
+        _other.m_growthLeft = 0;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>&
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::operator=(FlatHashMap&& _other) noexcept
+    {
+        if (this != &_other)
+        {
+            _Release();
+            m_allocator = _other.m_allocator;
+            m_hash = eastl::move(_other.m_hash);
+            m_equal = eastl::move(_other.m_equal);
+            m_control = _other.m_control;
+            m_entries = _other.m_entries;
+            m_capacity = _other.m_capacity;
+            m_size = _other.m_size;
+            m_growthLeft = _other.m_growthLeft;
+
+            _other.m_control = nullptr;
+            _other.m_entries = nullptr;
+            _other.m_capacity = 0;
+            _other.m_size = 0;
+            _other.m_growthLeft = 0;
+        }
+        return *this;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::~FlatHashMap()
+    {
+        _Release();
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    typename FlatHashMap<Key, Value, Hash, Equal, Allocator>::Iterator
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::Find(const Key& _key)
+    {
+        const size_t index = _FindIndex(_key, _Mix(m_hash(_key)));
+        return Iterator(m_control + index, m_entries + index);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    typename FlatHashMap<Key, Value, Hash, Equal, Allocator>::ConstIterator
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::Find(const Key& _key) const
+    {
+        return const_cast<FlatHashMap*>(this)->Find(_key);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    template <class K, class... Args>
+    eastl::pair<typename FlatHashMap<Key, Value, Hash, Equal, Allocator>::Iterator, bool>
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::TryEmplace(K&& _key, Args&&... _args)
+    {
+        const u64 hash = _Mix(m_hash(_key));
+
+        size_t index = _FindIndex(_key, hash);
+        if (index != m_capacity)
+        {
+            return { Iterator(m_control + index, m_entries + index), false };
+        }
+
+        index = m_capacity == 0 ? 0 : _FindInsertIndex(hash);
+        if (m_growthLeft == 0 && (m_capacity == 0 || m_control[index] != FlatHashMapDetail::kDeleted)) [[unlikely]]
+        {
+            // Rehash in place when tombstones make up a large part of the used slots, grow otherwise.
+            const size_t capacity = m_capacity == 0
+                ? kMinCapacity
+                : (m_size <= _GrowthCapacity(m_capacity) / 2 ? m_capacity : m_capacity * 2 + 1);
+            _Rehash(capacity);
+            index = _FindInsertIndex(hash);
+        }
+
+        m_growthLeft -= m_control[index] == FlatHashMapDetail::kEmpty ? 1 : 0;
+        _SetControl(index, static_cast<Control>(hash & 0x7f));
+        new (m_entries + index) ValueType(
+            eastl::piecewise_construct,
+            eastl::forward_as_tuple(eastl::forward<K>(_key)),
+            eastl::forward_as_tuple(eastl::forward<Args>(_args)...));
+        m_size++;
+
+        return { Iterator(m_control + index, m_entries + index), true };
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    bool FlatHashMap<Key, Value, Hash, Equal, Allocator>::Erase(const Key& _key)
+    {
+        const size_t index = _FindIndex(_key, _Mix(m_hash(_key)));
+        if (index == m_capacity)
+        {
+            return false;
+        }
+        _EraseAt(index);
+        return true;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::Erase(ConstIterator _it)
+    {
+        KE_ASSERT(_it != end() && *_it.m_control >= 0);
+        _EraseAt(_it.m_entry - m_entries);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::Clear()
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+
+        if constexpr (!eastl::is_trivially_destructible_v<ValueType>)
+        {
+            for (ValueType& entry: *this)
+            {
+                entry.~ValueType();
+            }
+        }
+        memset(m_control, FlatHashMapDetail::kEmpty, _ControlSize(m_capacity));
+        m_control[m_capacity] = FlatHashMapDetail::kSentinel;
+        m_size = 0;
+        m_growthLeft = _GrowthCapacity(m_capacity);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::Reserve(size_t _count)
+    {
+        if (_count > m_size + m_growthLeft)
+        {
+            _Rehash(eastl::max(_CapacityForCount(_count), m_capacity));
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    typename FlatHashMap<Key, Value, Hash, Equal, Allocator>::Iterator
+    FlatHashMap<Key, Value, Hash, Equal, Allocator>::begin()
+    {
+        if (m_size == 0)
+        {
+            return end();
+        }
+        Iterator it(m_control, m_entries);
+        it._SkipEmptySlots();
+        return it;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    u64 FlatHashMap<Key, Value, Hash, Equal, Allocator>::_Mix(size_t _hash)
+    {
+        // Hashes like eastl::hash<u64> are the identity, so spread the entropy of the high bits down to the H2 bits.
+        const u64 hash = static_cast<u64>(_hash) * 0x9e3779b97f4a7c15ull;
+        return hash ^ (hash >> 32);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    size_t FlatHashMap<Key, Value, Hash, Equal, Allocator>::_GrowthCapacity(size_t _capacity)
+    {
+        // Always keep an empty slot, for probing to terminate.
+        return _capacity - eastl::max<size_t>(_capacity / 8, 1);
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    size_t FlatHashMap<Key, Value, Hash, Equal, Allocator>::_CapacityForCount(size_t _count)
+    {
+        size_t capacity = kMinCapacity;
+        while (_GrowthCapacity(capacity) < _count)
+        {
+            capacity = capacity * 2 + 1;
+        }
+        return capacity;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    size_t FlatHashMap<Key, Value, Hash, Equal, Allocator>::_EntriesOffset(size_t _capacity)
+    {
+        return Alignment::AlignUp<size_t>(_ControlSize(_capacity), alignof(ValueType));
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    size_t FlatHashMap<Key, Value, Hash, Equal, Allocator>::_FindIndex(const Key& _key, u64 _hash) const
+    {
+        if (m_capacity == 0)
+        {
+            return 0;
+        }
+
+        const Control h2 = static_cast<Control>(_hash & 0x7f);
+        size_t offset = (_hash >> 7) & m_capacity;
+        for (size_t probe = 1; ; probe++)
+        {
+            const Group group(m_control + offset);
+            for (auto match = group.Match(h2); match; ++match)
+            {
+                const size_t index = (offset + match.LowestBit()) & m_capacity;
+                if (m_equal(m_entries[index].first, _key)) [[likely]]
+                {
+                    return index;
+                }
+            }
+
+            if (group.MatchEmpty()) [[likely]]
+            {
+                return m_capacity;
+            }
+
+            KE_ASSERT(probe * Group::kWidth <= m_capacity + 1);
+            offset = (offset + probe * Group::kWidth) & m_capacity;
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    size_t FlatHashMap<Key, Value, Hash, Equal, Allocator>::_FindInsertIndex(u64 _hash) const
+    {
+        size_t offset = (_hash >> 7) & m_capacity;
+        for (size_t probe = 1; ; probe++)
+        {
+            const auto mask = Group(m_control + offset).MatchEmptyOrDeleted();
+            if (mask) [[likely]]
+            {
+                return (offset + mask.LowestBit()) & m_capacity;
+            }
+
+            KE_ASSERT(probe * Group::kWidth <= m_capacity + 1);
+            offset = (offset + probe * Group::kWidth) & m_capacity;
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::_SetControl(size_t _index, Control _value)
+    {
+        m_control[_index] = _value;
+        // Keep the cloned bytes after the sentinel up to date.
+        if (_index < Group::kWidth - 1)
+        {
+            m_control[m_capacity + 1 + _index] = _value;
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::_EraseAt(size_t _index)
+    {
+        m_entries[_index].~ValueType();
+        m_size--;
+
+        // If there was never a full group around this slot, no probe sequence went past it, so it can be marked as
+        // empty instead of leaving a tombstone.
+        const size_t indexBefore = (_index - Group::kWidth) & m_capacity;
+        const auto emptyAfter = Group(m_control + _index).MatchEmpty();
+        const auto emptyBefore = Group(m_control + indexBefore).MatchEmpty();
+        const bool wasNeverFull = emptyBefore && emptyAfter
+            && emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros(Group::kWidth) < Group::kWidth;
+
+        _SetControl(_index, wasNeverFull ? FlatHashMapDetail::kEmpty : FlatHashMapDetail::kDeleted);
+        m_growthLeft += wasNeverFull ? 1 : 0;
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::_Rehash(size_t _capacity)
+    {
+        const size_t entriesOffset = _EntriesOffset(_capacity);
+        const size_t allocationSize = entriesOffset + _capacity * sizeof(ValueType);
+        auto* buffer = static_cast<std::byte*>(m_allocator.allocate(allocationSize, alignof(ValueType)));
+        KE_ASSERT_FATAL_MSG(buffer != nullptr, "Failed to allocate flat hash map of capacity %zu", _capacity);
+
+        Control* oldControl = m_control;
+        ValueType* oldEntries = m_entries;
+        const size_t oldCapacity = m_capacity;
+
+        m_control = reinterpret_cast<Control*>(buffer);
+        m_entries = reinterpret_cast<ValueType*>(buffer + entriesOffset);
+        m_capacity = _capacity;
+        m_growthLeft = _GrowthCapacity(_capacity) - m_size;
+
+        memset(m_control, FlatHashMapDetail::kEmpty, _ControlSize(_capacity));
+        m_control[_capacity] = FlatHashMapDetail::kSentinel;
+
+        for (size_t i = 0; i < oldCapacity; i++)
+        {
+            if (oldControl[i] < 0)
+            {
+                continue;
+            }
+
+            ValueType& entry = oldEntries[i];
+            const u64 hash = _Mix(m_hash(entry.first));
+            const size_t index = _FindInsertIndex(hash);
+            _SetControl(index, static_cast<Control>(hash & 0x7f));
+            new (m_entries + index) ValueType(eastl::move(entry));
+            entry.~ValueType();
+        }
+
+        if (oldControl != nullptr)
+        {
+            m_allocator.deallocate(oldControl);
+        }
+    }
+
+    template <class Key, class Value, class Hash, class Equal, class Allocator>
+    void FlatHashMap<Key, Value, Hash, Equal, Allocator>::_Release()
+    {
+        if (m_control == nullptr)
+        {
+            return;
+        }
+
+        Clear();
+        m_allocator.deallocate(m_control);
+        m_control = nullptr;
+        m_entries = nullptr;
+        m_capacity = 0;
+        m_growthLeft = 0;
+    }
+
+} // namespace KryneEngine
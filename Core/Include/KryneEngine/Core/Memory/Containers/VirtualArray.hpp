@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Common/Types.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief A growable array backed by a single virtual memory reservation.
+     *
+     * @details
+     * The address range for `maxCount` elements is reserved once at construction, and physical pages are only
+     * committed as the array grows, by steps of the commit granularity. Elements are thus never moved: indexed
+     * access is a single offset from the base address, and pointers stay valid until the element is removed.
+     *
+     * Shrinking decommits the pages past the size, while keeping one granularity step of slack so alternating
+     * grows and shrinks don't result in a system call each time. `ShrinkToFit()` releases everything unused.
+     *
+     * Reservations only consume address space, so `maxCount` can be set generously. Running out of it, or failing
+     * to commit memory, is fatal.
+     */
+    template <class T>
+    class VirtualArray
+    {
+    public:
+        using Iterator = T*;
+        using ConstIterator = const T*;
+
+        static constexpr size_t kDefaultCommitGranularity = 64 * 1024;
+
+        VirtualArray() = default;
+
+        /**
+         * @param _maxCount Maximum number of elements the array can ever hold.
+         * @param _commitGranularity Commit step in bytes, rounded up to the page size.
+         */
+        explicit VirtualArray(size_t _maxCount, size_t _commitGranularity = kDefaultCommitGranularity);
+
+        ~VirtualArray();
+
+        VirtualArray(const VirtualArray&) = delete;
+        VirtualArray& operator=(const VirtualArray&) = delete;
+        VirtualArray(VirtualArray&& _other) noexcept;
+        VirtualArray& operator=(VirtualArray&& _other) noexcept;
+
+        T& PushBack(const T& _value);
+        T& PushBack(T&& _value);
+
+        template <class... Args>
+        T& EmplaceBack(Args&&... _args);
+
+        void PopBack();
+
+        /// @brief Default constructs the new elements, or destroys the removed ones.
+        void Resize(size_t _count);
+
+        /// @brief Commits memory for at least `_count` elements. Returns false if the commit failed.
+        bool Reserve(size_t _count);
+
+        void Clear() { Resize(0); }
+
+        /// @brief Decommits all the pages which don't hold any element.
+        void ShrinkToFit();
+
+        [[nodiscard]] size_t Size() const { return m_size; }
+        [[nodiscard]] bool Empty() const { return m_size == 0; }
+        [[nodiscard]] size_t Capacity() const { return m_committedBytes / sizeof(T); }
+        [[nodiscard]] size_t MaxSize() const { return m_reservedBytes / sizeof(T); }
+        [[nodiscard]] size_t GetCommittedBytes() const { return m_committedBytes; }
+
+        T& operator[](size_t _index);
+        const T& operator[](size_t _index) const;
+
+        T* Data() { return m_data; }
+        const T* Data() const { return m_data; }
+
+        Iterator begin() { return m_data; }
+        Iterator end() { return m_data + m_size; }
+        ConstIterator begin() const { return m_data; }
+        ConstIterator end() const { return m_data + m_size; }
+
+    private:
+        T* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_committedBytes = 0;
+        size_t m_reservedBytes = 0;
+        size_t m_commitGranularity = 0;
+
+        T* _GrowByOne();
+        void _Release();
+        void _DecommitAbove(size_t _keptBytes);
+    };
+} // namespace KryneEngine
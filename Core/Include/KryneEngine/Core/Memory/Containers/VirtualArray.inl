@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "VirtualArray.hpp"
+
+#include <EASTL/utility.h>
+#include <new>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "KryneEngine/Core/Platform/VirtualMemory.hpp"
+
+namespace KryneEngine
+{
+    template <class T>
+    VirtualArray<T>::VirtualArray(size_t _maxCount, size_t _commitGranularity)
+    {
+        m_commitGranularity = Alignment::AlignUp(eastl::max<size_t>(_commitGranularity, 1), VirtualMemory::GetPageSize());
+        const size_t reservedBytes = Alignment::AlignUp(
+            _maxCount * sizeof(T),
+            eastl::max(m_commitGranularity, VirtualMemory::GetReservationGranularity()));
+
+        m_data = static_cast<T*>(VirtualMemory::Reserve(reservedBytes));
+        IF_NOT_VERIFY_MSG(m_data != nullptr, "Failed to reserve %zu bytes of address space", reservedBytes)
+        {
+            return;
+        }
+        m_reservedBytes = reservedBytes;
+    }
+
+    template <class T>
+    VirtualArray<T>::~VirtualArray()
+    {
+        _Release();
+    }
+
+    template <class T>
+    VirtualArray<T>::VirtualArray(VirtualArray&& _other) noexcept
+        : m_data(_other.m_data)
+        , m_size(_other.m_size)
+        , m_committedBytes(_other.m_committedBytes)
+        , m_reservedBytes(_other.m_reservedBytes)
+        , m_commitGranularity(_other.m_commitGranularity)
+    {
+        _other.m_data = nullptr;
+        _other.m_size = 0;
+        _other.m_committedBytes = 0;
+        _other.m_reservedBytes = 0;
+    }
+
+    template <class T>
+    VirtualArray<T>& VirtualArray<T>::operator=(VirtualArray&& _other) noexcept
+    {
+        if (this != &_other)
+        {
+            _Release();
+            m_data = _other.m_data;
+            m_size = _other.m_size;
+            m_committedBytes = _other.m_committedBytes;
+            m_reservedBytes = _other.m_reservedBytes;
+            m_commitGranularity = _other.m_commitGranularity;
+
+            _other.m_data = nullptr;
+            _other.m_size = 0;
+            _other.m_committedBytes = 0;
+            _other.m_reservedBytes = 0;
+        }
+        return *this;
+    }
+
+    template <class T>
+    T& VirtualArray<T>::PushBack(const T& _value)
+    {
+        return *new (_GrowByOne()) T(_value);
+    }
+
+    template <class T>
+    T& VirtualArray<T>::PushBack(T&& _value)
+    {
+        return *new (_GrowByOne()) T(eastl::move(_value));
+    }
+
+    template <class T>
+    template <class... Args>
+    T& VirtualArray<T>::EmplaceBack(Args&&... _args)
+    {
+        return *new (_GrowByOne()) T(eastl::forward<Args>(_args)...);
+    }
+
+    template <class T>
+    void VirtualArray<T>::PopBack()
+    {
+        KE_ASSERT(m_size > 0);
+        m_data[--m_size].~T();
+        _DecommitAbove(Alignment::AlignUp(m_size * sizeof(T), m_commitGranularity) + m_commitGranularity);
+    }
+
+    template <class T>
+    void VirtualArray<T>::Resize(size_t _count)
+    {
+        if (_count > m_size)
+        {
+            KE_ASSERT_FATAL_MSG(Reserve(_count), "Failed to commit memory for %zu elements", _count);
+            for (size_t i = m_size; i < _count; i++)
+            {
+                new (&m_data[i]) T();
+            }
+        }
+        else
+        {
+            for (size_t i = _count; i < m_size; i++)
+            {
+                m_data[i].~T();
+            }
+            _DecommitAbove(Alignment::AlignUp(_count * sizeof(T), m_commitGranularity) + m_commitGranularity);
+        }
+        m_size = _count;
+    }
+
+    template <class T>
+    bool VirtualArray<T>::Reserve(size_t _count)
+    {
+        const size_t requiredBytes = _count * sizeof(T);
+        if (requiredBytes <= m_committedBytes)
+            return true;
+
+        VERIFY_OR_RETURN(requiredBytes <= m_reservedBytes, false);
+
+        const size_t committedBytes = eastl::min(Alignment::AlignUp(requiredBytes, m_commitGranularity), m_reservedBytes);
+        auto* start = reinterpret_cast<std::byte*>(m_data) + m_committedBytes;
+        if (!VirtualMemory::Commit(start, committedBytes - m_committedBytes))
+            return false;
+
+        m_committedBytes = committedBytes;
+        return true;
+    }
+
+    template <class T>
+    void VirtualArray<T>::ShrinkToFit()
+    {
+        _DecommitAbove(Alignment::AlignUp(m_size * sizeof(T), VirtualMemory::GetPageSize()));
+    }
+
+    template <class T>
+    T& VirtualArray<T>::operator[](size_t _index)
+    {
+        KE_ASSERT(_index < m_size);
+        return m_data[_index];
+    }
+
+    template <class T>
+    const T& VirtualArray<T>::operator[](size_t _index) const
+    {
+        KE_ASSERT(_index < m_size);
+        return m_data[_index];
+    }
+
+    template <class T>
+    T* VirtualArray<T>::_GrowByOne()
+    {
+        if ((m_size + 1) * sizeof(T) > m_committedBytes) [[unlikely]]
+        {
+            KE_ASSERT_FATAL_MSG(Reserve(m_size + 1), "Failed to commit memory for %zu elements", m_size + 1);
+        }
+        return &m_data[m_size++];
+    }
+
+    template <class T>
+    void VirtualArray<T>::_Release()
+    {
+        if (m_data == nullptr)
+            return;
+
+        for (size_t i = 0; i < m_size; i++)
+        {
+            m_data[i].~T();
+        }
+        VirtualMemory::Release(m_data, m_reservedBytes);
+        m_data = nullptr;
+        m_size = 0;
+        m_committedBytes = 0;
+        m_reservedBytes = 0;
+    }
+
+    template <class T>
+    void VirtualArray<T>::_DecommitAbove(size_t _keptBytes)
+    {
+        if (_keptBytes >= m_committedBytes)
+            return;
+
+        auto* start = reinterpret_cast<std::byte*>(m_data) + _keptBytes;
+        VirtualMemory::Decommit(start, m_committedBytes - _keptBytes);
+        m_committedBytes = _keptBytes;
+    }
+} // namespace KryneEngine
@@ -8,11 +8,14 @@
 
 #include <atomic>
 #include <EASTL/array.h>
+#include <EASTL/span.h>
 #include <EASTL/vector.h>
 #include "KryneEngine/Core/Threads/SpinLock.hpp"
 
 namespace KryneEngine
 {
+    class FibersManager;
+
     namespace GenPool
     {
         static constexpr size_t kIndexBits = 20;
@@ -74,8 +77,18 @@ namespace KryneEngine
      * @brief Thread safe generational pool.
      *
      * @details
-     * Reads are completely lock-free, writes are locked to limit unnecessary complexity. As this container is meant to
-     * be read very frequently during a frame and not to have many writes, this should provide great performance.
+     * Reads are completely lock-free. Allocations from fiber threads are served from a per-thread cache of free
+     * indices, which is refilled by batches of `kRefillBatchSize` indices, either recycled from the shared free list
+     * (under a single lock acquisition) or freshly reserved with a CAS on the pool size. Other threads go through the
+     * shared free list lock.
+     *
+     * Frees bump the generation with a CAS, so stale handles are rejected right away, but the index is only reused
+     * after the next `FlushDeferredFrees()`. Fiber threads keep their freed indices in their cache, tagged with the
+     * flush epoch they were freed in, and only recycle them once the epoch changed. A free running concurrently with
+     * `FlushDeferredFrees()` may be released by it.
+     *
+     * Up to `kMaxThreadCaches` fiber threads get a cache, allocated on their first operation on the pool. Indices
+     * held by a cache are not available to other threads until `FlushThreadCache()` is called from its thread.
      *
      * Compared to a non-thread safe design with a single contiguous array, there is a little overhead due to both the
      * two atomic loads (one for the segment, one for the generation) and the final index computation.
@@ -114,14 +127,50 @@ namespace KryneEngine
         eastl::vector<u32> m_availableIndicesDeferred;
 
         alignas(Threads::kCacheLineSize) SpinLock m_lock;
+        std::atomic<u64> m_flushEpoch { 0 };
+
+    public:
+        static constexpr u32 kMaxThreadCaches = 64;
+        static constexpr u32 kThreadCacheCapacity = 64;
+        static constexpr u32 kRefillBatchSize = kThreadCacheCapacity / 2;
+
+    private:
+        struct alignas(Threads::kCacheLineSize) ThreadCache
+        {
+            u64 m_pendingEpoch = 0;
+            u32 m_availableCount = 0;
+            u32 m_pendingCount = 0;
+            u32 m_available[kThreadCacheCapacity];
+            // Indices freed during `m_pendingEpoch`, which can't be reused before the next flush.
+            u32 m_pending[kThreadCacheCapacity];
+        };
+
+        // Each slot is only ever accessed by the fiber thread owning it.
+        ThreadCache* m_threadCaches[kMaxThreadCaches] {};
 
         void _Grow(size_t _index);
+        u32 _ReserveIndices(u32 _count, u32& _firstIndex);
+        GenPool::Handle _AcquireHandle(u32 _index);
+        bool _BumpGeneration(const GenPool::Handle& _handle, HotDataStruct* _hotCopy, ColdDataStruct* _coldCopy);
+
+        ThreadCache* _GetThreadCache();
+        void _Refill(ThreadCache& _cache);
+        void _PromotePending(ThreadCache& _cache);
+        void _PushFreed(ThreadCache* _cache, eastl::span<const u32> _indices);
 
         static size_t GetSegmentIndex(size_t _index);
         static size_t GetLocalIndex(size_t _index, size_t _segmentIndex);
         static ColdDataStruct* GetColdData(Segment _segment, size_t _segmentIndex) requires kHasColdData;
         static HotDataStruct* GetHotData(Segment _segment, size_t _localIndex, u32 _generation);
 
+        // One bit per entry, set while the entry is allocated, stored after the hot and cold data of each segment.
+        static size_t GetOccupancyOffset(size_t _segmentIndex);
+        static size_t GetOccupancyWordCount(size_t _segmentIndex);
+        static std::atomic<u64>* GetOccupancy(Segment _segment, size_t _segmentIndex);
+
+        template <class Func>
+        void _ForEachLiveInRange(size_t _segmentIndex, size_t _firstWord, size_t _endWord, Func& _func) const;
+
     public:
         explicit GenerationalPool(const Allocator &_allocator);
 
@@ -140,8 +189,48 @@ namespace KryneEngine
                   HotDataStruct *_hotCopy = nullptr,
                   ColdDataStruct *_coldCopy = nullptr);
 
+        /**
+         * @brief Allocates a handle for each entry of `_handles`.
+         * @return The number of allocated handles. Entries past it are set to `GenPool::kInvalidHandle` when the
+         * pool is full.
+         */
+        u32 AllocateN(eastl::span<GenPool::Handle> _handles);
+
+        /**
+         * @brief Frees a batch of handles, with a single lock acquisition at most.
+         * @return The number of handles which were valid and got freed.
+         */
+        u32 FreeN(eastl::span<const GenPool::Handle> _handles);
+
         void FlushDeferredFrees();
 
+        /// @brief Gives the indices cached by the calling fiber thread back to the shared free lists.
+        void FlushThreadCache();
+
+        /**
+         * @brief Calls `_func` on every allocated entry, in index order.
+         *
+         * @details
+         * Walks the occupancy bitsets a 64-bit word at a time, so empty ranges are skipped at a fraction of the cost
+         * of probing every index. `_func` is called with `(GenPool::Handle, HotDataStruct&)`, plus a
+         * `ColdDataStruct&` when the pool has cold data.
+         *
+         * Can run concurrently with other operations: entries allocated or freed during the iteration may or may not
+         * be visited, and freed entries stay readable until the next `FlushDeferredFrees()`.
+         */
+        template <class Func>
+        void ForEachLive(Func&& _func) const;
+
+        /**
+         * @brief Same as `ForEachLive()`, but splits the pool in ranges of `kParallelRangeSize` entries, dispatched
+         * as jobs over the fibers manager. `_func` is called concurrently, and the call returns once all ranges are
+         * done.
+         */
+        template <class Func>
+        void ForEachLiveParallel(FibersManager* _fibersManager, Func&& _func) const;
+
+        static constexpr size_t kParallelRangeSize = 4096;
+
         [[nodiscard]] size_t GetSize() const { return m_size.load(std::memory_order::relaxed); }
 
         [[nodiscard]] const Allocator& GetAllocator() const { return m_allocator; }
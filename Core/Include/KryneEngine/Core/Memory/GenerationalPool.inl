@@ -10,6 +10,8 @@
 
 #include "KryneEngine/Core/Common/Assert.hpp"
 #include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "KryneEngine/Core/Threads/FibersManager.hpp"
+#include "KryneEngine/Core/Threads/FiberThread.hpp"
 
 namespace KryneEngine
 {
@@ -32,6 +34,12 @@ namespace KryneEngine
             if (segment != nullptr)
                 m_allocator.deallocate(segment);
         }
+
+        for (ThreadCache* cache: m_threadCaches)
+        {
+            if (cache != nullptr)
+                m_allocator.deallocate(cache, sizeof(ThreadCache));
+        }
     }
 
     template<class HotDataStruct, class ColdDataStruct, class Allocator>
@@ -41,19 +49,57 @@ namespace KryneEngine
                       "Generational pool maximum growable size is %ull. Consider changing GenPool::IndexType to a bigger type.",
                       kMaxSize);
 
-        const size_t count = 1 << (kInitialSizePot + _index);
-        size_t allocationSize = sizeof(HotData) * count;
-        size_t alignment = alignof(HotData);
+        const size_t allocationSize = GetOccupancyOffset(_index) + GetOccupancyWordCount(_index) * sizeof(u64);
+        size_t alignment = eastl::max(alignof(HotData), alignof(std::atomic<u64>));
         if constexpr (kHasColdData)
         {
-            allocationSize = Alignment::AlignUp(allocationSize, alignof(ColdDataStruct)) + sizeof(ColdDataStruct) * count;
             alignment = eastl::max(alignment, alignof(ColdDataStruct));
         }
 
         auto segment = static_cast<Segment>(m_allocator.allocate(allocationSize, alignment));
         memset(segment, 0, allocationSize);
 
-        m_segments[_index].store(segment, std::memory_order::release);
+        // Several threads can reserve indices in a missing segment at once, only the first one gets to publish it.
+        Segment expected = nullptr;
+        if (!m_segments[_index].compare_exchange_strong(expected, segment, std::memory_order::acq_rel))
+        {
+            m_allocator.deallocate(segment);
+        }
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    u32 GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_ReserveIndices(u32 _count, u32& _firstIndex)
+    {
+        size_t size = m_size.load(std::memory_order::relaxed);
+        size_t end;
+        do
+        {
+            end = eastl::min<size_t>(size + _count, kMaxSize);
+            if (end == size)
+                return 0;
+
+            // Segments are grown before the size is published, so any index below the size can be read.
+            for (size_t segmentIndex = GetSegmentIndex(size); segmentIndex <= GetSegmentIndex(end - 1); segmentIndex++)
+            {
+                if (m_segments[segmentIndex].load(std::memory_order::acquire) == nullptr)
+                    _Grow(segmentIndex);
+            }
+        }
+        while (!m_size.compare_exchange_weak(size, end, std::memory_order::release, std::memory_order::relaxed));
+
+        _firstIndex = static_cast<u32>(size);
+        return static_cast<u32>(end - size);
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    GenPool::Handle GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_AcquireHandle(u32 _index)
+    {
+        const size_t segmentIndex = GetSegmentIndex(_index);
+        const size_t localIndex = GetLocalIndex(_index, segmentIndex);
+        Segment segment = m_segments[segmentIndex].load(std::memory_order::acquire);
+
+        GetOccupancy(segment, segmentIndex)[localIndex / 64].fetch_or(1ull << (localIndex % 64), std::memory_order::release);
+        return { _index, std::atomic_ref(segment[localIndex].m_generation).load(std::memory_order::relaxed) };
     }
 
     template <class HotDataStruct, class ColdDataStruct, class Allocator>
@@ -78,6 +124,32 @@ namespace KryneEngine
         return reinterpret_cast<ColdDataStruct*>(reinterpret_cast<std::byte*>(_segment) + offset);
     }
 
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    size_t GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::GetOccupancyOffset(size_t _segmentIndex)
+    {
+        const size_t count = 1 << (_segmentIndex + kInitialSizePot);
+        size_t offset = sizeof(HotData) * count;
+        if constexpr (kHasColdData)
+        {
+            offset = Alignment::AlignUp(offset, alignof(ColdDataStruct)) + sizeof(ColdDataStruct) * count;
+        }
+        return Alignment::AlignUp(offset, alignof(std::atomic<u64>));
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    size_t GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::GetOccupancyWordCount(size_t _segmentIndex)
+    {
+        return Alignment::AlignUp<size_t>(1 << (_segmentIndex + kInitialSizePot), 64) / 64;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    std::atomic<u64>* GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::GetOccupancy(
+        Segment _segment,
+        size_t _segmentIndex)
+    {
+        return reinterpret_cast<std::atomic<u64>*>(reinterpret_cast<std::byte*>(_segment) + GetOccupancyOffset(_segmentIndex));
+    }
+
     template <class HotDataStruct, class ColdDataStruct, class Allocator>
     HotDataStruct* GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::GetHotData(
         Segment _segment,
@@ -132,40 +204,154 @@ namespace KryneEngine
     template<class HotDataStruct, class ColdDataStruct, class Allocator>
     GenPool::Handle GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::Allocate()
     {
-        const auto lock = m_lock.AutoLock();
-
-        u32 index;
-        size_t segmentIndex;
-        if (!m_availableIndices.empty())
+        ThreadCache* cache = _GetThreadCache();
+        if (cache != nullptr)
         {
-            // Pop the top of the index stack
-            index = m_availableIndices.back();
-            m_availableIndices.pop_back();
-            segmentIndex = GetSegmentIndex(index);
+            if (cache->m_availableCount == 0)
+                _Refill(*cache);
+            if (cache->m_availableCount != 0)
+                return _AcquireHandle(cache->m_available[--cache->m_availableCount]);
         }
         else
         {
-            index = m_size.fetch_add(1, std::memory_order::acquire);
-            VERIFY_OR_RETURN(index < kMaxSize, GenPool::kInvalidHandle);
-
-            segmentIndex = GetSegmentIndex(index);
-            if (m_segments[segmentIndex].load(std::memory_order::acquire) == nullptr)
-                _Grow(segmentIndex);
+            const auto lock = m_lock.AutoLock();
+            if (!m_availableIndices.empty())
+            {
+                // Pop the top of the index stack
+                const u32 index = m_availableIndices.back();
+                m_availableIndices.pop_back();
+                return _AcquireHandle(index);
+            }
         }
 
-        const size_t localIndex = GetLocalIndex(index, segmentIndex);
-        Segment segment = m_segments[segmentIndex].load(std::memory_order::acquire);
-
-        return { index, std::atomic_ref(segment[localIndex].m_generation).load(std::memory_order::relaxed) };
+        u32 index;
+        VERIFY_OR_RETURN(_ReserveIndices(1, index) == 1, GenPool::kInvalidHandle);
+        return _AcquireHandle(index);
     }
 
     template<class HotDataStruct, class ColdDataStruct, class Allocator>
     bool GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::Free(const GenPool::Handle &_handle,
                                                                HotDataStruct *_hotCopy,
                                                                ColdDataStruct *_coldCopy)
+    {
+        if (!_BumpGeneration(_handle, _hotCopy, _coldCopy))
+            return false;
+
+        const u32 index = _handle.m_index;
+        _PushFreed(_GetThreadCache(), { &index, 1 });
+        return true;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    u32 GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::AllocateN(eastl::span<GenPool::Handle> _handles)
+    {
+        u32 count = 0;
+
+        ThreadCache* cache = _GetThreadCache();
+        if (cache != nullptr)
+        {
+            _PromotePending(*cache);
+            while (count < _handles.size() && cache->m_availableCount != 0)
+            {
+                _handles[count++] = _AcquireHandle(cache->m_available[--cache->m_availableCount]);
+            }
+        }
+
+        if (count < _handles.size())
+        {
+            const auto lock = m_lock.AutoLock();
+            while (count < _handles.size() && !m_availableIndices.empty())
+            {
+                _handles[count++] = _AcquireHandle(m_availableIndices.back());
+                m_availableIndices.pop_back();
+            }
+        }
+
+        if (count < _handles.size())
+        {
+            u32 firstIndex = 0;
+            const u32 reservedCount = _ReserveIndices(_handles.size() - count, firstIndex);
+            for (u32 i = 0; i < reservedCount; i++)
+            {
+                _handles[count++] = _AcquireHandle(firstIndex + i);
+            }
+        }
+
+        IF_NOT_VERIFY_MSG(count == _handles.size(), "Generational pool is full")
+        {
+            for (u32 i = count; i < _handles.size(); i++)
+            {
+                _handles[i] = GenPool::kInvalidHandle;
+            }
+        }
+        return count;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    u32 GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::FreeN(eastl::span<const GenPool::Handle> _handles)
+    {
+        ThreadCache* cache = _GetThreadCache();
+
+        // Free by batches, so the freed indices can be pushed without any allocation.
+        u32 indices[kRefillBatchSize];
+        u32 indexCount = 0;
+        u32 freedCount = 0;
+        for (const GenPool::Handle& handle: _handles)
+        {
+            if (!_BumpGeneration(handle, nullptr, nullptr))
+                continue;
+
+            indices[indexCount++] = handle.m_index;
+            if (indexCount == kRefillBatchSize)
+            {
+                _PushFreed(cache, { indices, indexCount });
+                freedCount += indexCount;
+                indexCount = 0;
+            }
+        }
+        _PushFreed(cache, { indices, indexCount });
+        return freedCount + indexCount;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::FlushDeferredFrees()
     {
         const auto lock = m_lock.AutoLock();
+        m_availableIndices.insert(m_availableIndices.end(), m_availableIndicesDeferred.begin(), m_availableIndicesDeferred.end());
+        m_availableIndicesDeferred.clear();
 
+        // Thread caches release their own pending indices once they see the epoch change.
+        m_flushEpoch.fetch_add(1, std::memory_order::release);
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::FlushThreadCache()
+    {
+        ThreadCache* cache = _GetThreadCache();
+        if (cache == nullptr)
+            return;
+
+        _PromotePending(*cache);
+
+        const auto lock = m_lock.AutoLock();
+        m_availableIndices.insert(
+            m_availableIndices.end(),
+            cache->m_available,
+            cache->m_available + cache->m_availableCount);
+        m_availableIndicesDeferred.insert(
+            m_availableIndicesDeferred.end(),
+            cache->m_pending,
+            cache->m_pending + cache->m_pendingCount);
+        cache->m_availableCount = 0;
+        cache->m_pendingCount = 0;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    bool GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_BumpGeneration(
+        const GenPool::Handle& _handle,
+        HotDataStruct* _hotCopy,
+        ColdDataStruct* _coldCopy)
+    {
         VERIFY_OR_RETURN(_handle.m_index < m_size.load(std::memory_order::acquire), false);
 
         const size_t segmentIndex = GetSegmentIndex(_handle.m_index);
@@ -179,7 +365,9 @@ namespace KryneEngine
         {
             return false;
         }
+        GetOccupancy(segment, segmentIndex)[localIndex / 64].fetch_and(~(1ull << (localIndex % 64)), std::memory_order::relaxed);
 
+        // The index can't be reused before the next flush, so the data can still be copied out safely.
         if (_hotCopy != nullptr)
         {
             if constexpr (GenPool::IsValidIntrusiveGeneration<HotDataStruct>)
@@ -196,17 +384,227 @@ namespace KryneEngine
             }
         }
 
-        // Place back to the top of the index stack
-        m_availableIndicesDeferred.push_back(_handle.m_index);
-
         return true;
     }
 
     template <class HotDataStruct, class ColdDataStruct, class Allocator>
-    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::FlushDeferredFrees()
+    typename GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::ThreadCache*
+        GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_GetThreadCache()
+    {
+        if (!FiberThread::IsFiberThread())
+            return nullptr;
+
+        const FiberThread::ThreadIndex threadIndex = FiberThread::GetCurrentFiberThreadIndex();
+        if (threadIndex >= kMaxThreadCaches)
+            return nullptr;
+
+        ThreadCache*& cache = m_threadCaches[threadIndex];
+        if (cache == nullptr) [[unlikely]]
+        {
+            void* memory = m_allocator.allocate(sizeof(ThreadCache), alignof(ThreadCache));
+            if (memory == nullptr)
+                return nullptr;
+
+            cache = new (memory) ThreadCache();
+            cache->m_pendingEpoch = m_flushEpoch.load(std::memory_order::acquire);
+        }
+        return cache;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_Refill(ThreadCache& _cache)
     {
+        _PromotePending(_cache);
+        if (_cache.m_availableCount != 0)
+            return;
+
+        {
+            const auto lock = m_lock.AutoLock();
+            const u32 count = eastl::min<u32>(kRefillBatchSize, m_availableIndices.size());
+            const auto first = m_availableIndices.end() - count;
+            eastl::copy(first, m_availableIndices.end(), _cache.m_available);
+            m_availableIndices.erase(first, m_availableIndices.end());
+            _cache.m_availableCount = count;
+        }
+        if (_cache.m_availableCount != 0)
+            return;
+
+        u32 firstIndex = 0;
+        const u32 reservedCount = _ReserveIndices(kRefillBatchSize, firstIndex);
+
+        // Stored in reverse, so fresh indices are handed out in increasing order.
+        for (u32 i = 0; i < reservedCount; i++)
+        {
+            _cache.m_available[i] = firstIndex + reservedCount - 1 - i;
+        }
+        _cache.m_availableCount = reservedCount;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_PromotePending(ThreadCache& _cache)
+    {
+        const u64 epoch = m_flushEpoch.load(std::memory_order::acquire);
+        if (epoch == _cache.m_pendingEpoch)
+            return;
+        _cache.m_pendingEpoch = epoch;
+
+        const u32 movedCount = eastl::min(_cache.m_pendingCount, kThreadCacheCapacity - _cache.m_availableCount);
+        eastl::copy(_cache.m_pending, _cache.m_pending + movedCount, _cache.m_available + _cache.m_availableCount);
+        _cache.m_availableCount += movedCount;
+
+        if (movedCount < _cache.m_pendingCount)
+        {
+            const auto lock = m_lock.AutoLock();
+            m_availableIndices.insert(
+                m_availableIndices.end(),
+                _cache.m_pending + movedCount,
+                _cache.m_pending + _cache.m_pendingCount);
+        }
+        _cache.m_pendingCount = 0;
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_PushFreed(
+        ThreadCache* _cache,
+        eastl::span<const u32> _indices)
+    {
+        if (_indices.empty())
+            return;
+
+        if (_cache != nullptr)
+        {
+            // Bring the pending list to the current epoch first, as the indices are freed during it.
+            _PromotePending(*_cache);
+            if (_cache->m_pendingCount + _indices.size() <= kThreadCacheCapacity)
+            {
+                eastl::copy(_indices.begin(), _indices.end(), _cache->m_pending + _cache->m_pendingCount);
+                _cache->m_pendingCount += _indices.size();
+                return;
+            }
+        }
+
+        // Place back to the top of the deferred index stack
         const auto lock = m_lock.AutoLock();
-        m_availableIndices.insert(m_availableIndices.end(), m_availableIndicesDeferred.begin(), m_availableIndicesDeferred.end());
-        m_availableIndicesDeferred.clear();
+        m_availableIndicesDeferred.insert(m_availableIndicesDeferred.end(), _indices.begin(), _indices.end());
+    }
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    template <class Func>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::_ForEachLiveInRange(
+        size_t _segmentIndex,
+        size_t _firstWord,
+        size_t _endWord,
+        Func& _func) const
+    {
+        Segment segment = m_segments[_segmentIndex].load(std::memory_order::acquire);
+        const std::atomic<u64>* occupancy = GetOccupancy(segment, _segmentIndex);
+        const size_t segmentStart = (1 << (_segmentIndex + kInitialSizePot)) - kInitialSize;
+
+        for (size_t wordIndex = _firstWord; wordIndex < _endWord; wordIndex++)
+        {
+            u64 word = occupancy[wordIndex].load(std::memory_order::acquire);
+            while (word != 0)
+            {
+                const size_t localIndex = wordIndex * 64 + BitUtils::GetLeastSignificantBit(word);
+                word &= word - 1;
+
+                HotData& hotData = segment[localIndex];
+                const GenPool::Handle handle {
+                    static_cast<u32>(segmentStart + localIndex),
+                    std::atomic_ref(hotData.m_generation).load(std::memory_order::relaxed),
+                };
+
+                HotDataStruct* hot;
+                if constexpr (GenPool::IsValidIntrusiveGeneration<HotDataStruct>)
+                    hot = &hotData;
+                else
+                    hot = &hotData.m_userHotData;
+
+                if constexpr (kHasColdData)
+                    _func(handle, *hot, GetColdData(segment, _segmentIndex)[localIndex]);
+                else
+                    _func(handle, *hot);
+            }
+        }
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    template <class Func>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::ForEachLive(Func&& _func) const
+    {
+        const size_t size = m_size.load(std::memory_order::acquire);
+        for (size_t segmentIndex = 0; segmentIndex < kSegmentCount; segmentIndex++)
+        {
+            const size_t segmentStart = (1 << (segmentIndex + kInitialSizePot)) - kInitialSize;
+            if (segmentStart >= size)
+                break;
+
+            // Entries past the pool size were never allocated, so their bits are always clear.
+            _ForEachLiveInRange(segmentIndex, 0, GetOccupancyWordCount(segmentIndex), _func);
+        }
+    }
+
+    template <class HotDataStruct, class ColdDataStruct, class Allocator>
+    template <class Func>
+    void GenerationalPool<HotDataStruct, ColdDataStruct, Allocator>::ForEachLiveParallel(
+        FibersManager* _fibersManager,
+        Func&& _func) const
+    {
+        struct RangeJob
+        {
+            const GenerationalPool* m_pool;
+            eastl::remove_reference_t<Func>* m_func;
+            u32 m_segmentIndex;
+            u32 m_firstWord;
+            u32 m_endWord;
+        };
+
+        constexpr size_t rangeWordCount = kParallelRangeSize / 64;
+
+        eastl::vector<RangeJob> jobs(m_allocator);
+        const size_t size = m_size.load(std::memory_order::acquire);
+        for (size_t segmentIndex = 0; segmentIndex < kSegmentCount; segmentIndex++)
+        {
+            const size_t segmentStart = (1 << (segmentIndex + kInitialSizePot)) - kInitialSize;
+            if (segmentStart >= size)
+                break;
+
+            // Smaller segments make a single range, bigger ones are split, so all jobs get a similar amount of work.
+            const size_t wordCount = GetOccupancyWordCount(segmentIndex);
+            for (size_t firstWord = 0; firstWord < wordCount; firstWord += rangeWordCount)
+            {
+                jobs.push_back(RangeJob {
+                    .m_pool = this,
+                    .m_func = &_func,
+                    .m_segmentIndex = static_cast<u32>(segmentIndex),
+                    .m_firstWord = static_cast<u32>(firstWord),
+                    .m_endWord = static_cast<u32>(eastl::min(firstWord + rangeWordCount, wordCount)),
+                });
+            }
+        }
+
+        constexpr auto executeJob = [](void* _userData)
+        {
+            const auto* job = static_cast<RangeJob*>(_userData);
+            job->m_pool->_ForEachLiveInRange(job->m_segmentIndex, job->m_firstWord, job->m_endWord, *job->m_func);
+        };
+
+        if (_fibersManager == nullptr)
+        {
+            for (RangeJob& job: jobs)
+                executeJob(&job);
+            return;
+        }
+
+        // Execute the last range in this thread/fiber, schedule the other ones for dispatch.
+        if (jobs.size() > 1)
+        {
+            const SyncCounterId counter = _fibersManager->InitAndBatchJobs(jobs.size() - 1, executeJob, jobs.data());
+            executeJob(&jobs.back());
+            _fibersManager->WaitForCounterAndReset(counter);
+        }
+        else if (!jobs.empty())
+        {
+            executeJob(&jobs.back());
+        }
     }
 } // KryneEngine
\ No newline at end of file
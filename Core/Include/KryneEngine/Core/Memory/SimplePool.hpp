@@ -46,6 +46,17 @@ namespace KryneEngine
         s32 AddRef(SimplePoolHandle _handle) requires RefCounting;
         [[nodiscard]] s32 GetRefCount(SimplePoolHandle _handle) const requires RefCounting;
 
+        /**
+         * @brief Calls `_func` on every allocated entry, in index order.
+         *
+         * @details
+         * Walks the occupancy bitset a 64-bit word at a time, skipping empty ranges. `_func` is called with
+         * `(SimplePoolHandle, HotDataStruct&)`, plus a `ColdDataStruct&` when the pool has cold data.
+         * Entries must not be allocated or freed during the iteration.
+         */
+        template <class Func>
+        void ForEachLive(Func&& _func) const;
+
         [[nodiscard]] const Allocator& GetAllocator() const { return m_allocator; }
         void SetAllocator(const Allocator& _allocator) { m_allocator = _allocator; }
 
@@ -54,6 +65,8 @@ namespace KryneEngine
 
         void Resize(size_t _toSize);
 
+        static constexpr size_t GetOccupancyWordCount(size_t _size) { return (_size + 63) / 64; }
+
     private:
         union HotDataItem;
 
@@ -61,6 +74,8 @@ namespace KryneEngine
         HotDataItem* m_hotData = nullptr;
         ColdDataStruct* m_coldData = nullptr;
         std::atomic<s32>* m_refCounts = nullptr;
+        // One bit per entry, set while the entry is allocated.
+        u64* m_occupancy = nullptr;
         size_t m_size = 0;
         SimplePoolHandle m_nextFreeIndex = 0;
     };
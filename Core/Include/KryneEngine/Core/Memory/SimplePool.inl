@@ -9,6 +9,7 @@
 #include "SimplePool.hpp"
 
 #include <KryneEngine/Core/Common/Assert.hpp>
+#include <KryneEngine/Core/Common/BitUtils.hpp>
 
 namespace KryneEngine
 {
@@ -57,6 +58,8 @@ namespace KryneEngine
         {
             m_allocator.deallocate(m_refCounts, m_size * sizeof(*m_refCounts));
         }
+
+        m_allocator.deallocate(m_occupancy, GetOccupancyWordCount(m_size) * sizeof(u64));
     }
 
     template <class HotDataStruct, class ColdDataStruct, bool RefCounting, class Allocator>
@@ -69,6 +72,7 @@ namespace KryneEngine
 
         const SimplePoolHandle result = m_nextFreeIndex;
         m_nextFreeIndex = m_hotData[result].m_nextFreeIndex;
+        m_occupancy[result / 64] |= 1ull << (result % 64);
 
         if (RefCounting)
         {
@@ -121,6 +125,7 @@ namespace KryneEngine
         {
             m_hotData[_handle].m_nextFreeIndex = m_nextFreeIndex;
             m_nextFreeIndex = _handle;
+            m_occupancy[_handle / 64] &= ~(1ull << (_handle % 64));
         }
 
         return reset;
@@ -170,6 +175,27 @@ namespace KryneEngine
         return m_refCounts[_handle].load(std::memory_order::acquire);
     }
 
+    template <class HotDataStruct, class ColdDataStruct, bool RefCounting, class Allocator>
+    template <class Func>
+    void SimplePool<HotDataStruct, ColdDataStruct, RefCounting, Allocator>::ForEachLive(Func&& _func) const
+    {
+        const size_t wordCount = GetOccupancyWordCount(m_size);
+        for (size_t wordIndex = 0; wordIndex < wordCount; wordIndex++)
+        {
+            u64 word = m_occupancy[wordIndex];
+            while (word != 0)
+            {
+                const SimplePoolHandle handle = wordIndex * 64 + BitUtils::GetLeastSignificantBit(word);
+                word &= word - 1;
+
+                if constexpr (kHasColdData)
+                    _func(handle, m_hotData[handle].m_hotData, m_coldData[handle]);
+                else
+                    _func(handle, m_hotData[handle].m_hotData);
+            }
+        }
+    }
+
     template <class HotDataStruct, class ColdDataStruct, bool RefCounting, class Allocator>
     void SimplePool<HotDataStruct, ColdDataStruct, RefCounting, Allocator>::Resize(size_t _toSize)
     {
@@ -226,6 +252,21 @@ namespace KryneEngine
             m_refCounts = newRefCountArray;
         }
 
+        {
+            const size_t oldWordCount = GetOccupancyWordCount(m_size);
+            const size_t newWordCount = GetOccupancyWordCount(_toSize);
+            auto* newOccupancy = static_cast<u64*>(m_allocator.allocate(newWordCount * sizeof(u64), alignof(u64)));
+
+            if (m_occupancy != nullptr)
+            {
+                memcpy(newOccupancy, m_occupancy, oldWordCount * sizeof(u64));
+                m_allocator.deallocate(m_occupancy, oldWordCount * sizeof(u64));
+            }
+            memset(newOccupancy + oldWordCount, 0, (newWordCount - oldWordCount) * sizeof(u64));
+
+            m_occupancy = newOccupancy;
+        }
+
         m_size = _toSize;
     }
 }
\ No newline at end of file
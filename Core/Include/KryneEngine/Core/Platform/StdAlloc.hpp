@@ -15,4 +15,7 @@ namespace KryneEngine::StdAlloc
     void* MemAlign(size_t _size, size_t _alignment);
 
     void Free(void* _ptr);
+
+    /// @brief Returns the usable size of an allocation, or 0 if the platform can't report it (Windows).
+    size_t GetAllocationSize(void* _ptr);
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace KryneEngine::VirtualMemory
+{
+    /// @brief Granularity of commits and decommits.
+    size_t GetPageSize();
+
+    /// @brief Granularity of reservations, which can be bigger than the page size (64KiB on Windows).
+    size_t GetReservationGranularity();
+
+    /// @brief Reserves an address range, without any physical memory backing it. Returns `nullptr` on failure.
+    void* Reserve(size_t _size);
+
+    /// @brief Backs a page aligned sub-range of a reservation with zeroed physical memory.
+    bool Commit(void* _ptr, size_t _size);
+
+    /// @brief Gives the physical memory of a page aligned sub-range back to the system, keeping it reserved.
+    void Decommit(void* _ptr, size_t _size);
+
+    void Release(void* _ptr, size_t _size);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Common/Types.hpp"
+
+namespace KryneEngine::Threads
+{
+    /**
+     * @brief Small process-wide indices attributed to live threads, to index per-thread data in fixed size arrays.
+     *
+     * @details
+     * A thread acquires its slot on its first call to `GetThreadSlot()`, and releases it when it exits, so the slot
+     * can be reused by a thread created later. Data indexed by a recycled slot is inherited by its new owner: the
+     * release on thread exit synchronizes with the acquisition by the next thread.
+     *
+     * When all the slots are in use, threads get `kNoThreadSlot` and try again on their next call.
+     */
+    constexpr u32 kMaxThreadSlots = 64;
+    constexpr u32 kNoThreadSlot = ~0u;
+
+    namespace Internal
+    {
+        inline thread_local u32 t_threadSlot = kNoThreadSlot;
+
+        u32 AcquireThreadSlot();
+    }
+
+    /// @brief Returns the slot of the calling thread, acquiring it if needed, or `kNoThreadSlot` if none is free.
+    [[nodiscard]] inline u32 GetThreadSlot()
+    {
+        const u32 slot = Internal::t_threadSlot;
+        return slot < kMaxThreadSlots ? slot : Internal::AcquireThreadSlot();
+    }
+
+    /// @brief Returns the slot of the calling thread if it has one, without trying to acquire it.
+    [[nodiscard]] inline u32 PeekThreadSlot()
+    {
+        const u32 slot = Internal::t_threadSlot;
+        return slot < kMaxThreadSlots ? slot : kNoThreadSlot;
+    }
+}
@@ -0,0 +1,186 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Common/StringInterning.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Memory/Containers/FlatHashMap.inl"
+#include "KryneEngine/Core/Platform/StdAlloc.hpp"
+#include "KryneEngine/Core/Threads/RwSpinLock.hpp"
+
+namespace KryneEngine::StringInterning
+{
+    namespace
+    {
+        constexpr size_t kShardCountPot = 4;
+        constexpr size_t kShardCount = 1 << kShardCountPot;
+        constexpr size_t kChunkSize = 64 * 1024;
+
+        // Chunks are never freed, so they don't need to be linked together.
+        struct Chunk
+        {
+            size_t m_size;
+            size_t m_used;
+
+            [[nodiscard]] char* GetData() { return reinterpret_cast<char*>(this + 1); }
+        };
+
+        struct alignas(Threads::kCacheLineSize) Shard
+        {
+            RwSpinLock m_lock;
+            FlatHashMap<u64, const char*> m_index;
+            Chunk* m_currentChunk = nullptr;
+            u64 m_internCount = 0;
+            size_t m_stringBytes = 0;
+            size_t m_arenaBytes = 0;
+            size_t m_deduplicatedBytes = 0;
+
+            Chunk* AllocateChunk(size_t _dataSize)
+            {
+                auto* chunk = static_cast<Chunk*>(StdAlloc::Malloc(sizeof(Chunk) + _dataSize));
+                KE_ASSERT_FATAL_MSG(chunk != nullptr, "Failed to allocate string interning chunk");
+                *chunk = { _dataSize, 0 };
+                m_arenaBytes += sizeof(Chunk) + _dataSize;
+                return chunk;
+            }
+
+            char* Allocate(size_t _size)
+            {
+                // Large strings get a dedicated chunk, and don't retire the current one.
+                if (_size > kChunkSize / 4)
+                {
+                    return AllocateChunk(_size)->GetData();
+                }
+
+                if (m_currentChunk == nullptr || m_currentChunk->m_size - m_currentChunk->m_used < _size)
+                {
+                    m_currentChunk = AllocateChunk(kChunkSize - sizeof(Chunk));
+                }
+
+                char* data = m_currentChunk->GetData() + m_currentChunk->m_used;
+                m_currentChunk->m_used += _size;
+                return data;
+            }
+        };
+
+        // Only the hit counters are updated under the shared lock.
+        struct alignas(Threads::kCacheLineSize) ShardCounters
+        {
+            std::atomic<u64> m_internCount = 0;
+            std::atomic<size_t> m_deduplicatedBytes = 0;
+        };
+
+        struct Table
+        {
+            Shard m_shards[kShardCount];
+            ShardCounters m_hitCounters[kShardCount];
+        };
+
+        // Never destroyed, so interned strings stay valid for static objects destroyed at exit.
+        Table& GetTable()
+        {
+            alignas(Table) static std::byte storage[sizeof(Table)];
+            static Table* table = new (storage) Table();
+            return *table;
+        }
+
+        size_t GetShardIndex(u64 _hash)
+        {
+            return _hash >> (64 - kShardCountPot);
+        }
+
+        void CheckCollision([[maybe_unused]] const char* _interned, [[maybe_unused]] eastl::string_view _string)
+        {
+#if !defined(KE_FINAL)
+            KE_ASSERT_MSG(
+                eastl::string_view(_interned) == _string,
+                "Hash collision between interned strings '%s' and '%.*s'",
+                _interned,
+                static_cast<int>(_string.size()),
+                _string.data());
+#endif
+        }
+    }
+
+    const char* Intern(eastl::string_view _string, u64 _hash)
+    {
+        if (_string.empty())
+        {
+            return "";
+        }
+
+        Table& table = GetTable();
+        const size_t shardIndex = GetShardIndex(_hash);
+        Shard& shard = table.m_shards[shardIndex];
+
+        {
+            const auto lock = shard.m_lock.AutoReadLock();
+            const auto it = shard.m_index.Find(_hash);
+            if (it != shard.m_index.end())
+            {
+                CheckCollision(it->second, _string);
+                ShardCounters& counters = table.m_hitCounters[shardIndex];
+                counters.m_internCount.fetch_add(1, std::memory_order_relaxed);
+                counters.m_deduplicatedBytes.fetch_add(_string.size() + 1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+
+        const auto lock = shard.m_lock.AutoWriteLock();
+        shard.m_internCount++;
+
+        // Another thread might have interned the string in between.
+        const auto [it, inserted] = shard.m_index.TryEmplace(_hash, nullptr);
+        if (!inserted)
+        {
+            CheckCollision(it->second, _string);
+            shard.m_deduplicatedBytes += _string.size() + 1;
+            return it->second;
+        }
+
+        char* copy = shard.Allocate(_string.size() + 1);
+        memcpy(copy, _string.data(), _string.size());
+        copy[_string.size()] = '\0';
+        shard.m_stringBytes += _string.size() + 1;
+
+        it->second = copy;
+        return copy;
+    }
+
+    const char* Find(u64 _hash)
+    {
+        Shard& shard = GetTable().m_shards[GetShardIndex(_hash)];
+        const auto lock = shard.m_lock.AutoReadLock();
+        const auto it = shard.m_index.Find(_hash);
+        return it == shard.m_index.end() ? nullptr : it->second;
+    }
+
+    Stats GetStats()
+    {
+        Table& table = GetTable();
+
+        Stats stats {};
+        for (size_t i = 0; i < kShardCount; i++)
+        {
+            Shard& shard = table.m_shards[i];
+            const ShardCounters& counters = table.m_hitCounters[i];
+
+            const auto lock = shard.m_lock.AutoReadLock();
+            stats.m_stringCount += shard.m_index.Size();
+            stats.m_internCount += shard.m_internCount + counters.m_internCount.load(std::memory_order_relaxed);
+            stats.m_stringBytes += shard.m_stringBytes;
+            stats.m_arenaBytes += shard.m_arenaBytes;
+            stats.m_indexBytes += shard.m_index.Capacity() * (sizeof(u64) + sizeof(const char*) + 1);
+            stats.m_deduplicatedBytes += shard.m_deduplicatedBytes
+                + counters.m_deduplicatedBytes.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+}
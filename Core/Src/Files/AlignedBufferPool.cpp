@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Files/AlignedBufferPool.hpp"
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+
+namespace KryneEngine
+{
+    AlignedBufferPool::AlignedBufferPool(
+        AllocatorInstance _allocator,
+        u64 _bufferSize,
+        u64 _alignment,
+        u32 _maxRetainedBuffers)
+            : m_allocator(_allocator)
+            , m_bufferSize(Alignment::AlignUp(_bufferSize, _alignment))
+            , m_alignment(_alignment)
+            , m_maxRetainedBuffers(_maxRetainedBuffers)
+            , m_freeBuffers(_allocator)
+    {}
+
+    AlignedBufferPool::~AlignedBufferPool()
+    {
+        for (u8* buffer: m_freeBuffers)
+        {
+            m_allocator.deallocate(buffer, m_bufferSize);
+        }
+    }
+
+    u8* AlignedBufferPool::Acquire()
+    {
+        {
+            const auto lock = m_lock.AutoLock();
+            if (!m_freeBuffers.empty())
+            {
+                u8* buffer = m_freeBuffers.back();
+                m_freeBuffers.pop_back();
+                return buffer;
+            }
+        }
+
+        auto* buffer = static_cast<u8*>(m_allocator.allocate(m_bufferSize, m_alignment));
+        KE_ASSERT_MSG(buffer != nullptr, "Failed to allocate aligned IO buffer");
+        return buffer;
+    }
+
+    void AlignedBufferPool::Release(u8* _buffer)
+    {
+        if (_buffer == nullptr)
+            return;
+
+        {
+            const auto lock = m_lock.AutoLock();
+            if (m_freeBuffers.size() < m_maxRetainedBuffers)
+            {
+                m_freeBuffers.push_back(_buffer);
+                return;
+            }
+        }
+
+        m_allocator.deallocate(_buffer, m_bufferSize);
+    }
+} // KryneEngine
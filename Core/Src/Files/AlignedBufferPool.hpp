@@ -0,0 +1,48 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Memory/Allocators/Allocator.hpp"
+#include "KryneEngine/Core/Threads/SpinLock.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief Thread-safe pool of fixed-size, aligned buffers.
+     *
+     * @details
+     * Used as bounce buffers for unbuffered IO, which requires block-aligned memory. Buffers are allocated lazily, and
+     * at most `_maxRetainedBuffers` are kept around once released; extra buffers are freed right away.
+     */
+    class AlignedBufferPool
+    {
+    public:
+        AlignedBufferPool(AllocatorInstance _allocator, u64 _bufferSize, u64 _alignment, u32 _maxRetainedBuffers);
+        ~AlignedBufferPool();
+
+        AlignedBufferPool(const AlignedBufferPool&) = delete;
+        AlignedBufferPool& operator=(const AlignedBufferPool&) = delete;
+
+        [[nodiscard]] u8* Acquire();
+        void Release(u8* _buffer);
+
+        [[nodiscard]] u64 GetBufferSize() const { return m_bufferSize; }
+        [[nodiscard]] u64 GetAlignment() const { return m_alignment; }
+
+    private:
+        AllocatorInstance m_allocator;
+        u64 m_bufferSize;
+        u64 m_alignment;
+        u32 m_maxRetainedBuffers;
+
+        eastl::vector<u8*> m_freeBuffers;
+        SpinLock m_lock;
+    };
+} // KryneEngine
@@ -6,8 +6,10 @@
 
 #include "File.hpp"
 
+#include "KryneEngine/Core/Math/Hashing.hpp"
 #include "KryneEngine/Core/Threads/FibersManager.hpp"
 #include "KryneEngine/Core/Threads/FiberThread.hpp"
+#include "Files/FileSystemHelper.hpp"
 #include "Files/IoQueryManager.hpp"
 
 namespace KryneEngine
@@ -47,6 +49,52 @@ namespace KryneEngine
                 _handlerFunc(query);
             }
         }
+
+        struct HashSidecar
+        {
+            static constexpr u32 kMagic = 0x48534B45; // 'EKSH'
+
+            u32 m_magic = kMagic;
+            u32 m_padding = 0;
+            u64 m_fileSize = 0;
+            u64 m_lastWriteTime = 0;
+            u64 m_contentHash = 0;
+
+            bool operator==(const HashSidecar& _other) const = default;
+        };
+
+        eastl::string GetHashSidecarPath(const eastl::string& _path)
+        {
+            return _path + ".hash";
+        }
+
+        bool ReadHashSidecar(const eastl::string& _path, HashSidecar& _sidecar)
+        {
+            const eastl::string sidecarPath = GetHashSidecarPath(_path);
+            if (FileSystemHelper::GetFileSize(sidecarPath) != sizeof(HashSidecar))
+            {
+                return false;
+            }
+
+            File sidecarFile(sidecarPath);
+            const MemoryRangeMapping& mapping = sidecarFile.Read(sizeof(HashSidecar));
+            if (mapping.m_size != sizeof(HashSidecar))
+            {
+                return false;
+            }
+
+            memcpy(&_sidecar, mapping.m_buffer, sizeof(HashSidecar));
+            return _sidecar.m_magic == HashSidecar::kMagic;
+        }
+
+        HashSidecar MakeHashSidecar(const eastl::string& _path, u64 _contentHash)
+        {
+            HashSidecar sidecar {};
+            sidecar.m_fileSize = FileSystemHelper::GetFileSize(_path);
+            sidecar.m_lastWriteTime = FileSystemHelper::GetLastWriteTime(_path);
+            sidecar.m_contentHash = _contentHash;
+            return sidecar;
+        }
     }
 
     File::File(const eastl::string_view &_path)
@@ -73,7 +121,7 @@ namespace KryneEngine
             const auto handleQueryResult = [this](const IoQueryManager::Query& _query)
             {
                 m_file = _query.m_file;
-                m_fileSize = _query.m_size;
+                m_fileSize = _query.m_fileSize;
             };
 
             SendIoQuery(processQuery, handleQueryResult);
@@ -175,45 +223,54 @@ namespace KryneEngine
         SendIoQuery(processQuery, handleQueryResult);
     }
 
-    bool File::IsIdentical(u64 _bufferSize, u8 *_buffer)
+    bool File::IsIdentical(u64 _bufferSize, u8 *_buffer, bool _useHashSidecar)
     {
-        if (m_file != nullptr && m_fileSize != _bufferSize)
-        {
-            return false;
-        }
-
-        Read();
-
-        if (m_fileReadMapping.m_size != _bufferSize)
+        if (_useHashSidecar)
         {
-            return false;
+            const u64 contentHash = Hashing::Hash64(reinterpret_cast<const char*>(_buffer), _bufferSize);
+            return _IsIdentical(_bufferSize, _buffer, &contentHash, nullptr);
         }
-
-        return memcmp(m_fileReadMapping.m_buffer, _buffer, _bufferSize) == 0;
+        return _IsIdentical(_bufferSize, _buffer, nullptr, nullptr);
     }
 
-    bool File::WriteIfNotIdentical(u64 _bufferSize, u8 *_buffer, bool _closeAfterWrite)
+    bool File::WriteIfNotIdentical(u64 _bufferSize, u8 *_buffer, bool _closeAfterWrite, bool _useHashSidecar)
     {
-        const auto identical = IsIdentical(_bufferSize, _buffer);
+        const u64 contentHash = _useHashSidecar
+            ? Hashing::Hash64(reinterpret_cast<const char*>(_buffer), _bufferSize)
+            : 0;
+
+        bool sidecarUpToDate = false;
+        const auto identical = _IsIdentical(
+            _bufferSize,
+            _buffer,
+            _useHashSidecar ? &contentHash : nullptr,
+            &sidecarUpToDate);
         if (!identical)
         {
             Close(); // Close first, to enforce reopen with previous content erasure.
             Write({ _bufferSize, 0, _buffer },_closeAfterWrite);
         }
+
+        // If the file is kept open, its last write time might still change when closed. The sidecar will then be
+        // considered outdated, and a full comparison will be done next time.
+        if (_useHashSidecar && (!identical || !sidecarUpToDate))
+        {
+            _WriteHashSidecar(contentHash);
+        }
         return !identical;
     }
 
-    bool File::WriteIfNotIdentical(const eastl::string_view &_path, u64 _bufferSize, u8 *_buffer)
+    bool File::WriteIfNotIdentical(const eastl::string_view &_path, u64 _bufferSize, u8 *_buffer, bool _useHashSidecar)
     {
         File file(_path);
-        return file.WriteIfNotIdentical(_bufferSize, _buffer);
+        return file.WriteIfNotIdentical(_bufferSize, _buffer, true, _useHashSidecar);
     }
 
     void File::_FreeReadMapping(bool _resetIndices)
     {
         if (m_fileReadMapping.m_buffer != nullptr)
         {
-            delete m_fileReadMapping.m_buffer;
+            IoQueryManager::FreeQueryData(m_fileReadMapping.m_buffer);
             m_fileReadMapping.m_buffer = nullptr;
             m_allocatedMemorySize = 0;
         }
@@ -231,4 +288,85 @@ namespace KryneEngine
         m_fileSize = UINT64_MAX;
         _FreeReadMapping(true);
     }
+
+    bool File::_IsIdentical(u64 _bufferSize, const u8* _buffer, const u64* _contentHash, bool* _sidecarUpToDate)
+    {
+        // Different sizes can be detected without reading the file, with a single stat if it isn't opened yet.
+        const s64 fileSize = m_file != nullptr
+            ? static_cast<s64>(m_fileSize)
+            : FileSystemHelper::GetFileSize(m_path);
+        if (fileSize < 0 || static_cast<u64>(fileSize) != _bufferSize)
+        {
+            return false;
+        }
+
+        if (_contentHash != nullptr)
+        {
+            HashSidecar sidecar;
+            if (ReadHashSidecar(m_path, sidecar)
+                && sidecar.m_fileSize == static_cast<u64>(fileSize)
+                && sidecar.m_lastWriteTime == FileSystemHelper::GetLastWriteTime(m_path))
+            {
+                if (_sidecarUpToDate != nullptr)
+                {
+                    *_sidecarUpToDate = true;
+                }
+                return sidecar.m_contentHash == *_contentHash;
+            }
+        }
+
+        return _CompareContent(_bufferSize, _buffer);
+    }
+
+    bool File::_CompareContent(u64 _bufferSize, const u8* _buffer)
+    {
+        if (_bufferSize == 0)
+        {
+            return true;
+        }
+
+        // Stream the file through a single chunk buffer, to exit on the first difference without reading the rest.
+        const u64 chunkSize = eastl::min(kCompareChunkSize, _bufferSize);
+        u8* chunk = new u8[chunkSize];
+
+        bool identical = true;
+        for (u64 offset = 0; offset < _bufferSize && identical; offset += chunkSize)
+        {
+            const u64 size = eastl::min(chunkSize, _bufferSize - offset);
+
+            const auto processQuery = [&](IoQueryManager::Query& _query)
+            {
+                _query.m_path = m_path.c_str();
+                _query.m_file = m_file;
+                _query.m_size = size;
+                _query.m_offset = static_cast<s64>(offset);
+                _query.m_data = chunk;
+                _query.m_type = IoQueryManager::Query::Type::Read;
+            };
+
+            const auto handleQueryResult = [&](const IoQueryManager::Query& _query)
+            {
+                // Handle case where file was not opened.
+                if (m_file == nullptr)
+                {
+                    m_file = _query.m_file;
+                    m_fileSize = _query.m_fileSize;
+                }
+
+                identical = _query.m_size == size && memcmp(chunk, _buffer + offset, size) == 0;
+            };
+
+            SendIoQuery(processQuery, handleQueryResult);
+        }
+
+        delete[] chunk;
+        return identical;
+    }
+
+    void File::_WriteHashSidecar(u64 _contentHash)
+    {
+        HashSidecar sidecar = MakeHashSidecar(m_path, _contentHash);
+        File sidecarFile(GetHashSidecarPath(m_path));
+        sidecarFile.Write({ sizeof(HashSidecar), 0, reinterpret_cast<u8*>(&sidecar) }, true);
+    }
 } // KryneEngine
\ No newline at end of file
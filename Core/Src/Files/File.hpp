@@ -29,9 +29,24 @@ namespace KryneEngine
         /// @note If file was not opened yet, it will be in write mode (i.e. it will erase previous content).
         void Write(const MemoryRangeMapping& _mappedData, bool _closeAfter = false);
 
-        bool IsIdentical(u64 _bufferSize, u8* _buffer);
-        bool WriteIfNotIdentical(u64 _bufferSize, u8* _buffer, bool _closeAfterWrite = true);
-        static bool WriteIfNotIdentical(const eastl::string_view& _path, u64 _bufferSize, u8* _buffer);
+        /// Size of the chunks read when comparing the file content with a buffer.
+        static constexpr u64 kCompareChunkSize = 256ull << 10;
+
+        /**
+         * @brief Compares the file content with a buffer, stopping at the first difference.
+         *
+         * @param _useHashSidecar If true, and the `<path>.hash` sidecar file matches the current file size and last
+         * write time, the content hash it stores is compared instead, without reading the file.
+         */
+        bool IsIdentical(u64 _bufferSize, u8* _buffer, bool _useHashSidecar = false);
+
+        /// @param _useHashSidecar See `IsIdentical()`. The sidecar is also kept up-to-date.
+        bool WriteIfNotIdentical(u64 _bufferSize, u8* _buffer, bool _closeAfterWrite = true, bool _useHashSidecar = false);
+        static bool WriteIfNotIdentical(
+            const eastl::string_view& _path,
+            u64 _bufferSize,
+            u8* _buffer,
+            bool _useHashSidecar = false);
 
     private:
         eastl::string m_path;
@@ -43,5 +58,9 @@ namespace KryneEngine
 
         void _FreeReadMapping(bool _resetIndices = false);
         void _CloseFile();
+
+        bool _IsIdentical(u64 _bufferSize, const u8* _buffer, const u64* _contentHash, bool* _sidecarUpToDate);
+        bool _CompareContent(u64 _bufferSize, const u8* _buffer);
+        void _WriteHashSidecar(u64 _contentHash);
     };
 } // KryneEngine
\ No newline at end of file
@@ -0,0 +1,202 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Files/FileHandleCache.hpp"
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+
+namespace KryneEngine
+{
+    FileHandleCache::FileHandleCache(AllocatorInstance _allocator, u32 _maxOpenHandles)
+        : m_entries(_allocator)
+        , m_orphans(_allocator)
+        , m_maxOpenHandles(_maxOpenHandles)
+    {}
+
+    FileHandleCache::~FileHandleCache()
+    {
+        KE_ASSERT_MSG(m_orphans.empty(), "Some cached file handles are still in use");
+
+        for (const auto& [key, entry]: m_entries)
+        {
+            KE_ASSERT_MSG(entry.m_refCount == 0, "Some cached file handles are still in use");
+            NativeFile::Close(entry.m_handle);
+        }
+    }
+
+    FileHandleCache::CachedHandle FileHandleCache::Acquire(const eastl::string_view& _path)
+    {
+        const u64 key = StringHash::Hash64(_path);
+
+        NativeFile::Handle cachedHandle = NativeFile::kInvalidHandle;
+        {
+            const auto lock = m_mutex.AutoLock();
+
+            const auto it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                it->second.m_refCount++;
+                it->second.m_lastUse = ++m_useCounter;
+                cachedHandle = it->second.m_handle;
+            }
+        }
+
+        if (cachedHandle != NativeFile::kInvalidHandle)
+        {
+            // The size is queried on each acquisition rather than cached, as the file might have been written to since
+            // it was opened, through a path that doesn't invalidate this cache (sync queries, other processes...).
+            // The descriptor is referenced, so it can't be closed in the meantime.
+            return { cachedHandle, NativeFile::GetSize(cachedHandle), key };
+        }
+
+        // Open outside the lock, to avoid blocking other users on a syscall.
+        // `_path` isn't guaranteed to be null-terminated.
+        const eastl::string path(_path);
+        const NativeFile::Handle handle = NativeFile::Open(path.c_str(), NativeFile::OpenFlags::Read);
+        if (handle == NativeFile::kInvalidHandle)
+        {
+            return {};
+        }
+        const s64 fileSize = NativeFile::GetSize(handle);
+
+        const auto lock = m_mutex.AutoLock();
+
+        // Another thread might have opened the same file in the meantime.
+        const auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            NativeFile::Close(handle);
+            it->second.m_refCount++;
+            it->second.m_lastUse = ++m_useCounter;
+            return { it->second.m_handle, fileSize, key };
+        }
+
+        if (m_entries.size() >= m_maxOpenHandles)
+        {
+            _EvictUnused(m_maxOpenHandles > 0 ? m_maxOpenHandles - 1 : 0);
+        }
+
+        m_entries.emplace(key, Entry { handle, ++m_useCounter, 1 });
+        return { handle, fileSize, key };
+    }
+
+    void FileHandleCache::Release(const CachedHandle& _handle)
+    {
+        if (!_handle.IsValid())
+            return;
+
+        const auto lock = m_mutex.AutoLock();
+
+        const auto it = m_entries.find(_handle.m_key);
+        if (it != m_entries.end() && it->second.m_handle == _handle.m_handle)
+        {
+            KE_ASSERT(it->second.m_refCount > 0);
+            it->second.m_refCount--;
+
+            if (m_entries.size() > m_maxOpenHandles)
+            {
+                _EvictUnused(m_maxOpenHandles);
+            }
+            return;
+        }
+
+        for (auto orphanIt = m_orphans.begin(); orphanIt != m_orphans.end(); ++orphanIt)
+        {
+            if (orphanIt->m_handle == _handle.m_handle)
+            {
+                if (--orphanIt->m_refCount == 0)
+                {
+                    NativeFile::Close(orphanIt->m_handle);
+                    m_orphans.erase_unsorted(orphanIt);
+                }
+                return;
+            }
+        }
+
+        KE_ERROR("Released a file handle that doesn't belong to this cache");
+    }
+
+    void FileHandleCache::Invalidate(const eastl::string_view& _path)
+    {
+        Invalidate(StringHash::Hash64(_path));
+    }
+
+    void FileHandleCache::Invalidate(u64 _pathHash)
+    {
+        const auto lock = m_mutex.AutoLock();
+
+        const auto it = m_entries.find(_pathHash);
+        if (it == m_entries.end())
+            return;
+
+        if (it->second.m_refCount == 0)
+        {
+            NativeFile::Close(it->second.m_handle);
+        }
+        else
+        {
+            m_orphans.push_back(it->second);
+        }
+        m_entries.erase(it);
+    }
+
+    void FileHandleCache::InvalidateAll()
+    {
+        const auto lock = m_mutex.AutoLock();
+
+        for (const auto& [key, entry]: m_entries)
+        {
+            if (entry.m_refCount == 0)
+            {
+                NativeFile::Close(entry.m_handle);
+            }
+            else
+            {
+                m_orphans.push_back(entry);
+            }
+        }
+        m_entries.clear();
+    }
+
+    void FileHandleCache::SetMaxOpenHandles(u32 _maxOpenHandles)
+    {
+        const auto lock = m_mutex.AutoLock();
+        m_maxOpenHandles = _maxOpenHandles;
+        _EvictUnused(m_maxOpenHandles);
+    }
+
+    size_t FileHandleCache::GetOpenHandleCount() const
+    {
+        const auto lock = m_mutex.AutoLock();
+        return m_entries.size() + m_orphans.size();
+    }
+
+    void FileHandleCache::_EvictUnused(size_t _targetCount)
+    {
+        // Linear search for the least recently used entry. The cache is kept small (it's bound by the OS descriptor
+        // limit), so this stays cheap compared to the syscalls it saves.
+        while (m_entries.size() > _targetCount)
+        {
+            auto lruIt = m_entries.end();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if (it->second.m_refCount == 0 && (lruIt == m_entries.end() || it->second.m_lastUse < lruIt->second.m_lastUse))
+                {
+                    lruIt = it;
+                }
+            }
+
+            if (lruIt == m_entries.end())
+            {
+                // All remaining entries are in use.
+                return;
+            }
+
+            NativeFile::Close(lruIt->second.m_handle);
+            m_entries.erase(lruIt);
+        }
+    }
+} // KryneEngine
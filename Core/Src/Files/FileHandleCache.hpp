@@ -0,0 +1,88 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <EASTL/hash_map.h>
+#include <EASTL/vector.h>
+
+#include "Files/NativeFile.hpp"
+#include "KryneEngine/Core/Common/StringHelpers.hpp"
+#include "KryneEngine/Core/Threads/LightweightMutex.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief Thread-safe LRU cache of native file descriptors opened for reading, keyed by path.
+     *
+     * @details
+     * Avoids paying an open/close syscall pair for every query when streaming many chunks from the same file.
+     * Cached descriptors are meant to be used with position-independent reads (`NativeFile::ReadAt`), so they can be
+     * shared between concurrent users.
+     *
+     * Handles are reference counted while acquired, and only unused handles can be evicted. If all handles are in use,
+     * the cache temporarily goes above its limit, and shrinks back on release.
+     * Invalidated entries are removed from the cache right away, but their descriptor is only closed once released.
+     *
+     * File sizes aren't cached, they are queried from the descriptor on each acquisition, so in-place writes are always
+     * visible. Files replaced or deleted on disk must still be invalidated, as cached descriptors keep referring to the
+     * previous file.
+     *
+     * @note Paths are compared as provided, so a file should always be referred to with the same path string.
+     */
+    class FileHandleCache
+    {
+    public:
+        static constexpr u32 kDefaultMaxOpenHandles = 64;
+
+        struct CachedHandle
+        {
+            NativeFile::Handle m_handle = NativeFile::kInvalidHandle;
+            s64 m_fileSize = -1;
+            u64 m_key = 0;
+
+            [[nodiscard]] bool IsValid() const { return m_handle != NativeFile::kInvalidHandle; }
+        };
+
+        explicit FileHandleCache(AllocatorInstance _allocator, u32 _maxOpenHandles = kDefaultMaxOpenHandles);
+        ~FileHandleCache();
+
+        FileHandleCache(const FileHandleCache&) = delete;
+        FileHandleCache& operator=(const FileHandleCache&) = delete;
+
+        /// @brief Retrieves an open descriptor for `_path`, opening it if it's not cached yet.
+        /// @returns An invalid handle if the file couldn't be opened. Valid handles must be given back with `Release()`.
+        [[nodiscard]] CachedHandle Acquire(const eastl::string_view& _path);
+        void Release(const CachedHandle& _handle);
+
+        void Invalidate(const eastl::string_view& _path);
+        void Invalidate(u64 _pathHash);
+        void InvalidateAll();
+
+        void SetMaxOpenHandles(u32 _maxOpenHandles);
+        [[nodiscard]] u32 GetMaxOpenHandles() const { return m_maxOpenHandles; }
+        [[nodiscard]] size_t GetOpenHandleCount() const;
+
+    private:
+        struct Entry
+        {
+            NativeFile::Handle m_handle;
+            u64 m_lastUse;
+            u32 m_refCount;
+        };
+
+        eastl::hash_map<u64, Entry> m_entries;
+
+        // Invalidated entries still in use, closed once their last user releases them.
+        eastl::vector<Entry> m_orphans;
+
+        u64 m_useCounter = 0;
+        u32 m_maxOpenHandles;
+        mutable LightweightMutex m_mutex;
+
+        void _EvictUnused(size_t _targetCount);
+    };
+} // KryneEngine
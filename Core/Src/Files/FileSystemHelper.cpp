@@ -20,6 +20,13 @@ namespace KryneEngine::FileSystemHelper
         return std::filesystem::exists(_path.data());
     }
 
+    s64 GetFileSize(const eastl::string_view &_path)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(_path.data(), error);
+        return error ? -1 : static_cast<s64>(size);
+    }
+
     u64 SystemTimeToMillisecondsFromEpoch(const std::filesystem::file_time_type &_timePoint)
     {
         const auto duration = _timePoint.time_since_epoch();
@@ -15,6 +15,9 @@ namespace KryneEngine::FileSystemHelper
 
     [[nodiscard]] bool IsDirectory(const eastl::string_view& _path);
 
+    /// @returns The size of the file in bytes, or -1 if it doesn't exist or isn't a regular file.
+    [[nodiscard]] s64 GetFileSize(const eastl::string_view& _path);
+
     [[nodiscard]] u64 SystemTimeToMillisecondsFromEpoch(const std::filesystem::file_time_type& _timePoint);
 
     [[nodiscard]] u64 GetLastWriteTime(const eastl::string_view& _path);
@@ -79,6 +79,7 @@ namespace KryneEngine
                     {
                         hadChange = true;
                         m_watchedDirectories[status + offset].Update();
+                        _DispatchChanges();
                     }
 
                     if (offset + count < handles.size())
@@ -158,6 +159,7 @@ namespace KryneEngine
                         m_watchedDirectories[index].Update();
                     }
                 }
+                _DispatchChanges();
 
                 for (const s32 dirFD: dirFDs)
                 {
@@ -180,4 +182,32 @@ namespace KryneEngine
         m_shouldStop = true;
         m_watcherThread.join();
     }
+
+    u32 FileWatcher::RegisterFileChangeCallback(eastl::function<void(const StringHash&)>&& _callback)
+    {
+        const auto lock = m_callbackMutex.AutoLock();
+
+        const u32 id = m_fileChangeListenerCounter++;
+        m_fileChangeListeners.emplace(id, eastl::move(_callback));
+        return id;
+    }
+
+    void FileWatcher::UnregisterFileChangeCallback(u32 _id)
+    {
+        const auto lock = m_callbackMutex.AutoLock();
+        m_fileChangeListeners.erase(_id);
+    }
+
+    void FileWatcher::_DispatchChanges()
+    {
+        WatchedDirectory::FsChange change { StringHash(0ull) };
+        while (m_changesQueue.try_dequeue(change))
+        {
+            const auto lock = m_callbackMutex.AutoLock();
+            for (const auto& pair: m_fileChangeListeners)
+            {
+                pair.second(change.m_path);
+            }
+        }
+    }
 } // KryneEngine
\ No newline at end of file
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include "EASTL/functional.h"
 #include "EASTL/span.h"
 #include <Files/WatchedDirectory.hpp>
+#include "KryneEngine/Core/Threads/LightweightMutex.hpp"
 
 namespace KryneEngine
 {
@@ -19,6 +21,10 @@ namespace KryneEngine
 
         ~FileWatcher();
 
+        /// @note Callbacks are called from the watcher thread.
+        [[nodiscard]] u32 RegisterFileChangeCallback(eastl::function<void(const StringHash&)>&& _callback);
+        void UnregisterFileChangeCallback(u32 _id);
+
     private:
         eastl::vector<WatchedDirectory> m_watchedDirectories;
         std::thread m_watcherThread;
@@ -26,5 +32,11 @@ namespace KryneEngine
         moodycamel::ConcurrentQueue<WatchedDirectory::FsChange> m_changesQueue;
         volatile bool m_shouldStop = false;
 
+        LightweightMutex m_callbackMutex;
+        eastl::vector_map<u32, eastl::function<void(const StringHash&)>> m_fileChangeListeners;
+        u32 m_fileChangeListenerCounter = 0;
+
+        void _DispatchChanges();
+
     };
 } // KryneEngine
\ No newline at end of file
@@ -4,45 +4,118 @@
  * @date 10/03/2023.
  */
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 
 #include "Files/IoQueryManager.hpp"
+#include "Files/AlignedBufferPool.hpp"
 #include "Files/FileSystemHelper.hpp"
+#include "Files/FileWatcher.hpp"
+#include "Files/IoTelemetry.hpp"
+#include "Files/NativeFile.hpp"
+#include "Files/WriteBehindQueue.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
 #include "KryneEngine/Core/Threads/FibersManager.hpp"
 
 namespace KryneEngine
 {
-    IoQueryManager::IoQueryManager(FibersManager *_fibersManager)
+#if !defined(KE_FINAL)
+    namespace
+    {
+        std::atomic<bool> g_simulateUnbufferedOpenFailure { false };
+    }
+#endif
+
+    IoQueryManager::IoQueryManager(FibersManager *_fibersManager, u32 _maxCachedFileHandles)
+        : m_handleCache(AllocatorInstance(), _maxCachedFileHandles)
     {
         _fibersManager->m_ioManager = this;
 
+        m_writeBehindQueue = new WriteBehindQueue(AllocatorInstance());
+
         m_thread = std::thread([this, _fibersManager]() {
             while (!m_shouldStop)
             {
                 _ProcessIoQueries(_fibersManager);
+                m_writeBehindQueue->Update(_fibersManager);
 
                 std::unique_lock<std::mutex> lock(m_waitMutex);
-                m_waitConditionVariable.wait(lock); // Allow spurious wakeup
+                if (m_writeBehindQueue->HasPendingWrites())
+                {
+                    // Wake up in time to flush pending writes.
+                    m_waitConditionVariable.wait_until(lock, m_writeBehindQueue->GetNextFlushTime());
+                }
+                else
+                {
+                    m_waitConditionVariable.wait(lock); // Allow spurious wakeup
+                }
             }
+
+            m_writeBehindQueue->CloseAll(_fibersManager);
         });
     }
 
     IoQueryManager::~IoQueryManager()
     {
+        ListenToFileWatcher(nullptr);
+
         m_shouldStop = true;
         m_waitConditionVariable.notify_one();
         m_thread.join();
+
+        delete m_writeBehindQueue;
     }
 
     void IoQueryManager::MakeQueryAsync(IoQueryManager::Query *_query)
     {
+        _query->m_enqueueTime = IoTelemetry::GetTimestamp();
+        GetTelemetry().OnQueryEnqueued();
+
         m_queriesQueue.enqueue(_query);
         m_waitConditionVariable.notify_one();
     }
 
     void IoQueryManager::MakeQuerySync(IoQueryManager::Query *_query)
     {
-        _HandleQuery(_query, nullptr);
+        _HandleQuery(_query, nullptr, nullptr);
+    }
+
+    void IoQueryManager::FreeQueryData(u8* _data)
+    {
+        AllocatorInstance().deallocate(_data);
+    }
+
+#if !defined(KE_FINAL)
+    void IoQueryManager::SimulateUnbufferedOpenFailure(bool _enabled)
+    {
+        g_simulateUnbufferedOpenFailure.store(_enabled, std::memory_order_relaxed);
+    }
+#endif
+
+    IoTelemetry& IoQueryManager::GetTelemetry()
+    {
+        static IoTelemetry telemetry;
+        return telemetry;
+    }
+
+    void IoQueryManager::ListenToFileWatcher(FileWatcher* _fileWatcher)
+    {
+        if (m_fileWatcher != nullptr)
+        {
+            m_fileWatcher->UnregisterFileChangeCallback(m_fileWatcherCallbackId);
+        }
+
+        m_fileWatcher = _fileWatcher;
+
+        if (m_fileWatcher != nullptr)
+        {
+            m_fileWatcherCallbackId = m_fileWatcher->RegisterFileChangeCallback(
+                [this](const StringHash& _path)
+                {
+                    m_handleCache.Invalidate(_path.m_hash);
+                });
+        }
     }
 
     void IoQueryManager::_ProcessIoQueries(FibersManager *_fibersManager)
@@ -50,27 +123,118 @@ namespace KryneEngine
         Query* query = nullptr;
         while(m_queriesQueue.try_dequeue(query))
         {
-            _HandleQuery(query, _fibersManager);
+            GetTelemetry().OnQueryDequeued();
+            _HandleQuery(query, _fibersManager, this);
+        }
+    }
+
+    u8* IoQueryManager::_AllocateQueryData(u64 _size)
+    {
+        // Always aligned, so the buffer is valid for direct reads and all buffers share the same release path.
+        return static_cast<u8*>(AllocatorInstance().allocate(_size, NativeFile::kUnbufferedAlignment));
+    }
+
+    void IoQueryManager::_HandleQuery(
+        IoQueryManager::Query *_query,
+        FibersManager *_fibersManager,
+        IoQueryManager* _manager)
+    {
+        _query->m_startTime = IoTelemetry::GetTimestamp();
+
+        // Only async queries have access to the handle cache and the write-behind queue.
+        FileHandleCache* handleCache = _manager != nullptr ? &_manager->m_handleCache : nullptr;
+        WriteBehindQueue* writeBehindQueue = _manager != nullptr ? _manager->m_writeBehindQueue : nullptr;
+
+        const bool isPathOnlyQuery = _query->m_path != nullptr && _query->m_file == nullptr;
+
+        if (writeBehindQueue != nullptr
+            && (_query->m_type == Query::Type::Barrier
+                || (_query->m_type == Query::Type::Write
+                    && _query->m_writeMode == Query::WriteMode::WriteBehind
+                    && isPathOnlyQuery)))
+        {
+            // Completion is deferred until the requested durability is reached.
+            writeBehindQueue->Process(_query, _fibersManager);
+            return;
+        }
+
+        if (_query->m_type == Query::Type::Barrier)
+        {
+            // No write-behind data to flush.
+            _FinishQuery(_query, _fibersManager);
+            return;
+        }
+
+        if (writeBehindQueue != nullptr && _query->m_path != nullptr)
+        {
+            // Keep other accesses to the file ordered after pending write-behind data.
+            writeBehindQueue->Flush(_query->m_path, _fibersManager);
+        }
+
+        const bool canUseHandleCache = handleCache != nullptr && isPathOnlyQuery && !_query->m_destroyOnOpen;
+
+        const bool handledAsDirectRead = _query->m_type == Query::Type::Read
+            && _ShouldUseDirectRead(_query)
+            && _HandleDirectRead(_query);
+
+        if (!handledAsDirectRead)
+        {
+            if (_query->m_type == Query::Type::Read && _query->m_useHandleCache && canUseHandleCache)
+            {
+                _HandleCachedRead(_query, handleCache);
+            }
+            else
+            {
+                _HandleBufferedQuery(_query);
+            }
+        }
+
+        _FinishQuery(_query, _fibersManager);
+    }
+
+    void IoQueryManager::_FinishQuery(IoQueryManager::Query* _query, FibersManager* _fibersManager)
+    {
+        _query->m_completeTime = IoTelemetry::GetTimestamp();
+        GetTelemetry().OnQueryCompleted(*_query, _query->m_completeTime);
+
+        // Update sync counter if provided.
+        if (_query->m_syncCounterId != kInvalidSyncCounterId && KE_VERIFY(_fibersManager != nullptr))
+        {
+            _fibersManager->m_syncCounterPool.DecrementCounterValue(_query->m_syncCounterId);
+        }
+
+        // Delete query from heap.
+        // This can happen if a thread wants to do a send-and-forget query.
+        //   Ex: A fiber thread wants to close a file, but won't wait for the operation (too long and costly for such a simple op).
+        if (_query->m_deleteQuery)
+        {
+            delete _query;
         }
     }
 
-    void IoQueryManager::_HandleQuery(IoQueryManager::Query *_query, FibersManager *_fibersManager)
+    void IoQueryManager::_HandleBufferedQuery(IoQueryManager::Query* _query)
     {
         const auto offset = _query->m_offset;
         s64 fileSize = -1;
 
         if (_query->m_file == nullptr)
         {
-            VERIFY_OR_RETURN_VOID(_query->m_path != nullptr);
+            IF_NOT_VERIFY(_query->m_path != nullptr)
+            {
+                _query->m_size = 0;
+                return;
+            }
 
-            IF_NOT_VERIFY_MSG(FileSystemHelper::Exists(_query->m_path), "No such file")
+            IF_NOT_VERIFY_MSG(_query->m_destroyOnOpen || FileSystemHelper::Exists(_query->m_path), "No such file")
             {
+                _query->m_size = 0;
                 return;
             }
 
             _query->m_file = fopen(_query->m_path, _query->m_destroyOnOpen ? "wb+" : "rb+");
             IF_NOT_VERIFY_MSG(_query->m_file != nullptr, "Error while opening file")
             {
+                _query->m_size = 0;
                 return;
             }
 
@@ -96,18 +260,20 @@ namespace KryneEngine
             {
                 const u64 readSize = fileSize < 0 ? _query->m_size : eastl::min<u64>(_query->m_size, fileSize);
 
-                if (_query->m_data != nullptr && KE_VERIFY(fileSize >= 0))
+                if (_query->m_data == nullptr && KE_VERIFY(fileSize >= 0))
                 {
-                    _query->m_data = new u8[readSize];
+                    _query->m_data = _AllocateQueryData(readSize);
                 }
 
-                _query->m_size = fread(_query->m_data, sizeof(u8), readSize, _query->m_file);
+                _query->m_size = _query->m_data != nullptr
+                    ? fread(_query->m_data, sizeof(u8), readSize, _query->m_file)
+                    : 0;
             }
             else
             {
-                
                 IF_NOT_VERIFY(_query->m_data != nullptr)
                 {
+                    _query->m_size = 0;
                     return;
                 }
 
@@ -121,19 +287,171 @@ namespace KryneEngine
             fclose(_query->m_file);
             _query->m_file = nullptr;
         }
+    }
 
-        // Update sync counter if provided.
-        if (_query->m_syncCounterId != kInvalidSyncCounterId && KE_VERIFY(_fibersManager != nullptr))
+    void IoQueryManager::_HandleCachedRead(IoQueryManager::Query* _query, FileHandleCache* _handleCache)
+    {
+        const u64 offset = _query->m_offset;
+
+        const FileHandleCache::CachedHandle handle = _handleCache->Acquire(_query->m_path);
+        IF_NOT_VERIFY_MSG(handle.IsValid(), "Error while opening file")
         {
-            _fibersManager->m_syncCounterPool.DecrementCounterValue(_query->m_syncCounterId);
+            _query->m_size = 0;
+            return;
         }
 
-        // Delete query from heap.
-        // This can happen if a thread wants to do a send-and-forget query.
-        //   Ex: A fiber thread wants to close a file, but won't wait for the operation (too long and costly for such a simple op).
-        if (_query->m_deleteQuery)
+        const u64 fileSize = eastl::max<s64>(handle.m_fileSize, 0);
+        const u64 start = eastl::min(offset, fileSize);
+        const u64 readSize = eastl::min(_query->m_size, fileSize - start);
+
+        if (_query->m_data == nullptr)
         {
-            delete _query;
+            _query->m_data = _AllocateQueryData(readSize);
+        }
+
+        const s64 read = NativeFile::ReadAt(handle.m_handle, _query->m_data, readSize, start);
+        _handleCache->Release(handle);
+
+        _query->m_size = eastl::max<s64>(read, 0);
+        _query->m_fileSize = fileSize;
+    }
+
+    bool IoQueryManager::_ShouldUseDirectRead(const IoQueryManager::Query* _query)
+    {
+        // Direct reads rely on their own descriptor, which can't be handed back as a `FILE*`.
+        if (_query->m_file != nullptr || _query->m_path == nullptr || _query->m_destroyOnOpen || _query->m_size == 0)
+        {
+            return false;
+        }
+
+        switch (_query->m_readMode)
+        {
+        case Query::ReadMode::Buffered:
+            return false;
+        case Query::ReadMode::Direct:
+            return true;
+        case Query::ReadMode::Auto:
+            if (!_query->m_closeFile)
+            {
+                // The caller expects the opened file to be kept around, which only buffered reads provide.
+                return false;
+            }
+            if (_query->m_size != UINT64_MAX)
+            {
+                return _query->m_size >= kDirectReadThreshold;
+            }
+            else
+            {
+                // Whole file read, size is only known from the file system.
+                const s64 fileSize = FileSystemHelper::GetFileSize(_query->m_path);
+                return fileSize > _query->m_offset
+                    && static_cast<u64>(fileSize - _query->m_offset) >= kDirectReadThreshold;
+            }
+        }
+        return false;
+    }
+
+    bool IoQueryManager::_HandleDirectRead(IoQueryManager::Query* _query)
+    {
+        constexpr u64 alignment = NativeFile::kUnbufferedAlignment;
+
+        const u64 offset = _query->m_offset;
+
+        NativeFile::Handle handle = NativeFile::Open(
+            _query->m_path,
+            NativeFile::OpenFlags::Read | NativeFile::OpenFlags::Unbuffered);
+#if !defined(KE_FINAL)
+        if (g_simulateUnbufferedOpenFailure.load(std::memory_order_relaxed))
+        {
+            NativeFile::Close(handle);
+            handle = NativeFile::kInvalidHandle;
+        }
+#endif
+        if (handle == NativeFile::kInvalidHandle && _query->m_readMode == Query::ReadMode::Auto)
+        {
+            // Some file systems (tmpfs, some FUSE or network mounts) reject unbuffered access altogether.
+            return false;
+        }
+        IF_NOT_VERIFY_MSG(handle != NativeFile::kInvalidHandle, "Error while opening file")
+        {
+            _query->m_size = 0;
+            return true;
+        }
+
+        const u64 fileSize = eastl::max<s64>(NativeFile::GetSize(handle), 0);
+        const u64 start = eastl::min(offset, fileSize);
+        u64 end = start + eastl::min(_query->m_size, fileSize - start);
+
+        if (_query->m_data == nullptr)
+        {
+            _query->m_data = _AllocateQueryData(end - start);
+        }
+
+        u64 cursor = start;
+
+        // Fast path: the aligned part of the range can be read straight into the destination buffer.
+        if (Alignment::IsAligned(start, alignment)
+            && Alignment::IsAligned(reinterpret_cast<uintptr_t>(_query->m_data), static_cast<uintptr_t>(alignment)))
+        {
+            const u64 directSize = Alignment::AlignDown(end - start, alignment);
+            if (directSize > 0)
+            {
+                const s64 read = NativeFile::ReadAt(handle, _query->m_data, directSize, start);
+                if (read > 0)
+                {
+                    cursor += read;
+                }
+                if (static_cast<u64>(read) != directSize)
+                {
+                    // Error or end of file reached.
+                    end = cursor;
+                }
+            }
         }
+
+        // Unaligned head & tail (or the full range if the destination isn't aligned) go through bounce buffers.
+        if (cursor < end)
+        {
+            AlignedBufferPool& bufferPool = _GetDirectReadBufferPool();
+            u8* bounceBuffer = bufferPool.Acquire();
+
+            while (cursor < end)
+            {
+                const u64 alignedCursor = Alignment::AlignDown(cursor, alignment);
+                const u64 chunkSize = eastl::min(
+                    bufferPool.GetBufferSize(),
+                    Alignment::AlignUp(end - alignedCursor, alignment));
+
+                const s64 read = NativeFile::ReadAt(handle, bounceBuffer, chunkSize, alignedCursor);
+                if (read <= static_cast<s64>(cursor - alignedCursor))
+                {
+                    // Error or end of file reached.
+                    break;
+                }
+
+                const u64 copySize = eastl::min<u64>(alignedCursor + read, end) - cursor;
+                memcpy(_query->m_data + (cursor - start), bounceBuffer + (cursor - alignedCursor), copySize);
+                cursor += copySize;
+            }
+
+            bufferPool.Release(bounceBuffer);
+        }
+
+        NativeFile::Close(handle);
+
+        _query->m_size = cursor - start;
+        _query->m_fileSize = fileSize;
+        return true;
+    }
+
+    AlignedBufferPool& IoQueryManager::_GetDirectReadBufferPool()
+    {
+        // Function-local, so it is shared by async and sync queries, and doesn't depend on static init order.
+        static AlignedBufferPool pool(
+            AllocatorInstance(),
+            kDirectReadBufferSize,
+            NativeFile::kUnbufferedAlignment,
+            kDirectReadMaxRetainedBuffers);
+        return pool;
     }
 } // KryneEngine
\ No newline at end of file
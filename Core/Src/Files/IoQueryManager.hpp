@@ -6,34 +6,98 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include "Files/FileHandleCache.hpp"
 #include "KryneEngine/Core/Common/Types.hpp"
 #include "KryneEngine/Core/Threads/SyncCounterPool.hpp"
 
 namespace KryneEngine
 {
+    class AlignedBufferPool;
     class FibersManager;
+    class FileWatcher;
+    class IoTelemetry;
+    class WriteBehindQueue;
 
     class IoQueryManager
     {
+        friend WriteBehindQueue;
+
     public:
-        explicit IoQueryManager(FibersManager* _fibersManager);
+        explicit IoQueryManager(
+            FibersManager* _fibersManager,
+            u32 _maxCachedFileHandles = FileHandleCache::kDefaultMaxOpenHandles);
 
         ~IoQueryManager();
 
+        /// Reads at least this big are done unbuffered when using `Query::ReadMode::Auto`.
+        static constexpr u64 kDirectReadThreshold = 16ull << 20;
+
+        /// Size of the block-aligned bounce buffers used by unbuffered reads.
+        static constexpr u64 kDirectReadBufferSize = 4ull << 20;
+
+        /// Maximum number of bounce buffers kept alive between unbuffered reads.
+        static constexpr u32 kDirectReadMaxRetainedBuffers = 4;
+
+        /// Write-behind data of a file is flushed once it reaches this size.
+        static constexpr u64 kWriteBehindFlushSize = 1ull << 20;
+
+        /// Write-behind data of a file is flushed once it has been pending for this long.
+        static constexpr std::chrono::milliseconds kWriteBehindFlushDelay { 50 };
+
         struct Query
         {
             enum class Type: u8 {
                 Read,
-                Write
+                Write,
+                /// Flush and sync pending write-behind data of `m_path`, or of all files if no path is provided.
+                Barrier,
+            };
+
+            /**
+             * @details
+             * Direct reads bypass the OS page cache, to avoid evicting useful data and paying for an extra copy when
+             * streaming big files. They use their own file descriptor, so they are only possible when the query
+             * provides a path and no already opened `m_file`, and the file is never handed back to the caller.
+             */
+            enum class ReadMode: u8 {
+                /// Use a direct read if the read size reaches `kDirectReadThreshold` and the file is closed after the
+                /// read (`m_closeFile`). Falls back to a buffered read if the file system rejects unbuffered access.
+                Auto,
+                Buffered,
+                Direct,
+            };
+
+            /**
+             * @details
+             * Write-behind queries are copied and coalesced with other pending writes to the same file, and written
+             * once a size or time threshold is reached. They are only possible for async queries that provide a path
+             * and no already opened `m_file`. Sync queries fall back to immediate writes.
+             */
+            enum class WriteMode: u8 {
+                Immediate,
+                WriteBehind,
+            };
+
+            /// Durability a write-behind query must reach before being completed.
+            enum class Durability: u8 {
+                /// Completed once the data has been handed to the OS.
+                None,
+                /// Completed once a barrier query on the same file synced it to storage (fsync).
+                SyncOnBarrier,
+                /// Completed once the file is closed (using `m_closeFile`), after syncing its data (fdatasync).
+                SyncOnClose,
             };
 
             const char* m_path = nullptr;
 
             FILE* m_file = nullptr;
 
+            /// If `nullptr` on a read query, a buffer is allocated by the manager, see `FreeQueryData()`.
             u8* m_data = nullptr;
 
+            /// Updated on completion to the number of bytes actually transferred, or 0 if the query failed.
             u64 m_size = UINT64_MAX;
 
             union
@@ -44,15 +108,62 @@ namespace KryneEngine
 
             SyncCounterId m_syncCounterId = kInvalidSyncCounterId;
             Type m_type = Type::Read;
+            ReadMode m_readMode = ReadMode::Auto;
+            WriteMode m_writeMode = WriteMode::Immediate;
+            Durability m_durability = Durability::None;
             bool m_destroyOnOpen = false;
             bool m_closeFile = false;
             bool m_deleteQuery = false;
+
+            /**
+             * @brief Read through the manager's cache of open file descriptors, using position-independent reads.
+             *
+             * @details
+             * Only applies to async read queries with a path and no `m_file`, and the file is never handed back to the
+             * caller. Direct reads take precedence. Sync queries don't have access to the cache and fall back to
+             * regular buffered reads.
+             */
+            bool m_useHandleCache = false;
+
+            /// Timestamps in nanoseconds, see `IoTelemetry::GetTimestamp()`. The enqueue time is 0 for sync queries.
+            u64 m_enqueueTime = 0;
+            u64 m_startTime = 0;
+            u64 m_completeTime = 0;
         };
 
         void MakeQueryAsync(Query* _query);
         static void MakeQuerySync(Query* _query);
 
+        /**
+         * @brief Frees a read buffer allocated by the manager.
+         *
+         * @details
+         * Buffers are allocated for read queries that don't provide `m_data`. They are aligned to
+         * `NativeFile::kUnbufferedAlignment` so direct reads can target them, and can't be freed with `delete[]`.
+         */
+        static void FreeQueryData(u8* _data);
+
+#if !defined(KE_FINAL)
+        /// Debug helper making unbuffered opens fail, to exercise the buffered fallback of `ReadMode::Auto`.
+        static void SimulateUnbufferedOpenFailure(bool _enabled);
+#endif
+
+        [[nodiscard]] FileHandleCache& GetFileHandleCache() { return m_handleCache; }
+
+        /// @brief Statistics of all queries, async and sync.
+        [[nodiscard]] static IoTelemetry& GetTelemetry();
+
+        /**
+         * @brief Invalidate cached file handles when the file watcher reports a change.
+         * @param _fileWatcher The watcher to listen to, or `nullptr` to stop listening.
+         */
+        void ListenToFileWatcher(FileWatcher* _fileWatcher);
+
     private:
+        FileHandleCache m_handleCache;
+        WriteBehindQueue* m_writeBehindQueue;
+        FileWatcher* m_fileWatcher = nullptr;
+        u32 m_fileWatcherCallbackId = 0;
 
         moodycamel::ConcurrentQueue<Query*> m_queriesQueue;
 
@@ -63,6 +174,16 @@ namespace KryneEngine
 
         void _ProcessIoQueries(FibersManager *_fibersManager);
 
-        static void _HandleQuery(Query* _query, FibersManager* _fibersManager);
+        [[nodiscard]] static u8* _AllocateQueryData(u64 _size);
+
+        static void _HandleQuery(Query* _query, FibersManager* _fibersManager, IoQueryManager* _manager);
+        static void _FinishQuery(Query* _query, FibersManager* _fibersManager);
+        static void _HandleBufferedQuery(Query* _query);
+        static void _HandleCachedRead(Query* _query, FileHandleCache* _handleCache);
+
+        [[nodiscard]] static bool _ShouldUseDirectRead(const Query* _query);
+        /// Returns false if the file couldn't be opened unbuffered in `ReadMode::Auto`, to fall back to a buffered read.
+        [[nodiscard]] static bool _HandleDirectRead(Query* _query);
+        [[nodiscard]] static AlignedBufferPool& _GetDirectReadBufferPool();
     };
 } // KryneEngine
\ No newline at end of file
@@ -0,0 +1,197 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Files/IoTelemetry.hpp"
+
+#include <chrono>
+
+#include "KryneEngine/Core/Common/BitUtils.hpp"
+#include "KryneEngine/Core/Profiling/TracyHeader.hpp"
+
+namespace KryneEngine
+{
+    void LatencyHistogram::Record(u64 _value)
+    {
+        m_buckets[GetBucketIndex(_value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(_value, std::memory_order_relaxed);
+
+        u64 min = m_min.load(std::memory_order_relaxed);
+        while (_value < min && !m_min.compare_exchange_weak(min, _value, std::memory_order_relaxed)) {}
+
+        u64 max = m_max.load(std::memory_order_relaxed);
+        while (_value > max && !m_max.compare_exchange_weak(max, _value, std::memory_order_relaxed)) {}
+    }
+
+    void LatencyHistogram::Reset()
+    {
+        for (auto& bucket: m_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_min.store(UINT64_MAX, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    LatencyHistogram::Stats LatencyHistogram::ComputeStats() const
+    {
+        // Buckets are read without synchronization with concurrent records, so percentiles use the sum of the buckets
+        // as the reference count.
+        eastl::array<u64, kBucketCount> buckets;
+        u64 count = 0;
+        for (u32 i = 0; i < kBucketCount; i++)
+        {
+            buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+            count += buckets[i];
+        }
+
+        Stats stats {};
+        if (count == 0)
+        {
+            return stats;
+        }
+
+        stats.m_count = count;
+        stats.m_min = m_min.load(std::memory_order_relaxed);
+        stats.m_max = m_max.load(std::memory_order_relaxed);
+        stats.m_mean = m_sum.load(std::memory_order_relaxed) / eastl::max<u64>(m_count.load(std::memory_order_relaxed), 1);
+
+        const auto computePercentile = [&](u64 _perThousand)
+        {
+            const u64 target = eastl::max<u64>((count * _perThousand + 999) / 1000, 1);
+            u64 cumulated = 0;
+            for (u32 i = 0; i < kBucketCount; i++)
+            {
+                cumulated += buckets[i];
+                if (cumulated >= target)
+                {
+                    return eastl::min(GetBucketUpperBound(i), stats.m_max);
+                }
+            }
+            return stats.m_max;
+        };
+
+        stats.m_p50 = computePercentile(500);
+        stats.m_p90 = computePercentile(900);
+        stats.m_p99 = computePercentile(990);
+        stats.m_p999 = computePercentile(999);
+        return stats;
+    }
+
+    u32 LatencyHistogram::GetBucketIndex(u64 _value)
+    {
+        if (_value < kSubBucketCount)
+        {
+            return static_cast<u32>(_value);
+        }
+
+        const u32 msb = eastl::min<u32>(BitUtils::GetMostSignificantBit(_value), kMaxValueBits);
+        const u32 shift = msb - kSubBucketBits;
+        const u32 subBucket = eastl::min<u64>(_value >> shift, 2 * kSubBucketCount - 1) - kSubBucketCount;
+        return (shift + 1) * kSubBucketCount + subBucket;
+    }
+
+    u64 LatencyHistogram::GetBucketUpperBound(u32 _index)
+    {
+        if (_index < kSubBucketCount)
+        {
+            return _index;
+        }
+
+        const u32 shift = _index / kSubBucketCount - 1;
+        const u64 subBucket = _index % kSubBucketCount;
+        return ((kSubBucketCount + subBucket + 1) << shift) - 1;
+    }
+
+    u64 IoTelemetry::GetTimestamp()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void IoTelemetry::OnQueryEnqueued()
+    {
+        const u32 depth = m_queueDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        u32 peak = m_peakQueueDepth.load(std::memory_order_relaxed);
+        while (depth > peak && !m_peakQueueDepth.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {}
+
+        TracyPlot("IO queue depth", static_cast<s64>(depth));
+    }
+
+    void IoTelemetry::OnQueryDequeued()
+    {
+        const u32 depth = m_queueDepth.fetch_sub(1, std::memory_order_relaxed) - 1;
+        TracyPlot("IO queue depth", static_cast<s64>(depth));
+    }
+
+    void IoTelemetry::OnQueryCompleted(const IoQueryManager::Query& _query, u64 _completeTime)
+    {
+        static_assert(kQueryTypeCount == static_cast<size_t>(QueryType::Barrier) + 1);
+
+        QueryTypeCounters& counters = m_queryTypes[static_cast<size_t>(_query.m_type)];
+        counters.m_queryCount.fetch_add(1, std::memory_order_relaxed);
+
+        // Sizes are updated to the transferred byte count on completion, so failed queries don't count.
+        if (_query.m_type != QueryType::Barrier)
+        {
+            const u64 totalBytes = counters.m_bytes.fetch_add(_query.m_size, std::memory_order_relaxed) + _query.m_size;
+            if (_query.m_type == QueryType::Read)
+            {
+                TracyPlot("IO bytes read", static_cast<s64>(totalBytes));
+            }
+            else
+            {
+                TracyPlot("IO bytes written", static_cast<s64>(totalBytes));
+            }
+        }
+
+        // Sync queries are never enqueued.
+        if (_query.m_enqueueTime != 0)
+        {
+            counters.m_queueLatency.Record(_query.m_startTime - _query.m_enqueueTime);
+        }
+
+        const u64 serviceLatency = _completeTime - _query.m_startTime;
+        counters.m_serviceLatency.Record(serviceLatency);
+        TracyPlot("IO service latency (us)", static_cast<s64>(serviceLatency / 1000));
+    }
+
+    IoTelemetry::Snapshot IoTelemetry::TakeSnapshot() const
+    {
+        Snapshot snapshot {};
+        for (size_t i = 0; i < kQueryTypeCount; i++)
+        {
+            const QueryTypeCounters& counters = m_queryTypes[i];
+            Snapshot::QueryTypeStats& stats = snapshot.m_queryTypes[i];
+
+            stats.m_queryCount = counters.m_queryCount.load(std::memory_order_relaxed);
+            stats.m_bytes = counters.m_bytes.load(std::memory_order_relaxed);
+            stats.m_queueLatency = counters.m_queueLatency.ComputeStats();
+            stats.m_serviceLatency = counters.m_serviceLatency.ComputeStats();
+        }
+
+        snapshot.m_bytesRead = snapshot[QueryType::Read].m_bytes;
+        snapshot.m_bytesWritten = snapshot[QueryType::Write].m_bytes;
+        snapshot.m_queueDepth = m_queueDepth.load(std::memory_order_relaxed);
+        snapshot.m_peakQueueDepth = m_peakQueueDepth.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    void IoTelemetry::Reset()
+    {
+        for (QueryTypeCounters& counters: m_queryTypes)
+        {
+            counters.m_queryCount.store(0, std::memory_order_relaxed);
+            counters.m_bytes.store(0, std::memory_order_relaxed);
+            counters.m_queueLatency.Reset();
+            counters.m_serviceLatency.Reset();
+        }
+        m_peakQueueDepth.store(m_queueDepth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+} // KryneEngine
@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <EASTL/array.h>
+
+#include "Files/IoQueryManager.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief Lock-free latency histogram, with HDR-style log-linear buckets.
+     *
+     * @details
+     * Values are split in power-of-two ranges, each divided in `2^kSubBucketBits` linear sub-buckets, which bounds the
+     * relative error of the reported percentiles to ~3%, whatever the magnitude. Values above `2^kMaxValueBits` are
+     * clamped.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr u32 kSubBucketBits = 5;
+        static constexpr u32 kMaxValueBits = 42; // ~73 minutes in nanoseconds
+        static constexpr u32 kSubBucketCount = 1u << kSubBucketBits;
+        static constexpr u32 kBucketCount = (kMaxValueBits - kSubBucketBits + 2) * kSubBucketCount;
+
+        struct Stats
+        {
+            u64 m_count = 0;
+            u64 m_min = 0;
+            u64 m_max = 0;
+            u64 m_mean = 0;
+            u64 m_p50 = 0;
+            u64 m_p90 = 0;
+            u64 m_p99 = 0;
+            u64 m_p999 = 0;
+        };
+
+        void Record(u64 _value);
+        void Reset();
+
+        [[nodiscard]] Stats ComputeStats() const;
+
+        [[nodiscard]] static u32 GetBucketIndex(u64 _value);
+        [[nodiscard]] static u64 GetBucketUpperBound(u32 _index);
+
+    private:
+        eastl::array<std::atomic<u64>, kBucketCount> m_buckets {};
+        std::atomic<u64> m_count = 0;
+        std::atomic<u64> m_sum = 0;
+        std::atomic<u64> m_min = UINT64_MAX;
+        std::atomic<u64> m_max = 0;
+    };
+
+    /**
+     * @brief Process-wide IO statistics, fed by `IoQueryManager`.
+     *
+     * @details
+     * Latencies are measured in nanoseconds, from the query timestamps:
+     * - Queue latency: time spent in the async queue, from `MakeQueryAsync()` to the IO thread picking it up.
+     * - Service latency: time from the start of processing to completion. For write-behind queries, this includes
+     *   the time waiting for the requested durability.
+     *
+     * Queue depth and throughput are also sent to Tracy as plots, to be looked at over time.
+     */
+    class IoTelemetry
+    {
+    public:
+        using QueryType = IoQueryManager::Query::Type;
+        static constexpr size_t kQueryTypeCount = 3;
+
+        struct Snapshot
+        {
+            struct QueryTypeStats
+            {
+                u64 m_queryCount = 0;
+                u64 m_bytes = 0;
+                LatencyHistogram::Stats m_queueLatency {};
+                LatencyHistogram::Stats m_serviceLatency {};
+            };
+
+            eastl::array<QueryTypeStats, kQueryTypeCount> m_queryTypes {};
+            u64 m_bytesRead = 0;
+            u64 m_bytesWritten = 0;
+            u32 m_queueDepth = 0;
+            u32 m_peakQueueDepth = 0;
+
+            [[nodiscard]] const QueryTypeStats& operator[](QueryType _type) const
+            {
+                return m_queryTypes[static_cast<size_t>(_type)];
+            }
+        };
+
+        [[nodiscard]] static u64 GetTimestamp();
+
+        void OnQueryEnqueued();
+        void OnQueryDequeued();
+        void OnQueryCompleted(const IoQueryManager::Query& _query, u64 _completeTime);
+
+        [[nodiscard]] Snapshot TakeSnapshot() const;
+
+        /// @brief Resets all counters and histograms, except the current queue depth.
+        void Reset();
+
+    private:
+        struct QueryTypeCounters
+        {
+            std::atomic<u64> m_queryCount = 0;
+            std::atomic<u64> m_bytes = 0;
+            LatencyHistogram m_queueLatency;
+            LatencyHistogram m_serviceLatency;
+        };
+
+        eastl::array<QueryTypeCounters, kQueryTypeCount> m_queryTypes {};
+        std::atomic<u32> m_queueDepth = 0;
+        std::atomic<u32> m_peakQueueDepth = 0;
+    };
+} // KryneEngine
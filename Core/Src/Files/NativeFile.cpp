@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Files/NativeFile.hpp"
+
+#if defined(_WIN32)
+#   include "KryneEngine/Core/Platform/Windows.h"
+#else
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace KryneEngine::NativeFile
+{
+#if defined(_WIN32)
+    namespace
+    {
+        // ReadFile/WriteFile take a DWORD size, so bigger accesses need to be split.
+        // Keep the chunk aligned, so unbuffered accesses stay valid.
+        constexpr u64 kMaxAccessChunk = 1ull << 30;
+
+        inline HANDLE ToWin32(Handle _handle) { return reinterpret_cast<HANDLE>(_handle); }
+
+        inline OVERLAPPED MakeOverlapped(u64 _offset)
+        {
+            OVERLAPPED overlapped {};
+            overlapped.Offset = static_cast<DWORD>(_offset & 0xFFFF'FFFF);
+            overlapped.OffsetHigh = static_cast<DWORD>(_offset >> 32);
+            return overlapped;
+        }
+    }
+
+    Handle Open(const char* _path, OpenFlags _flags)
+    {
+        DWORD access = 0;
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Read))
+            access |= GENERIC_READ;
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Write))
+            access |= GENERIC_WRITE;
+
+        DWORD disposition;
+        if (BitUtils::EnumHasAll(_flags, OpenFlags::Create | OpenFlags::Truncate))
+            disposition = CREATE_ALWAYS;
+        else if (BitUtils::EnumHasAny(_flags, OpenFlags::Create))
+            disposition = OPEN_ALWAYS;
+        else if (BitUtils::EnumHasAny(_flags, OpenFlags::Truncate))
+            disposition = TRUNCATE_EXISTING;
+        else
+            disposition = OPEN_EXISTING;
+
+        DWORD attributes = FILE_ATTRIBUTE_NORMAL;
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Unbuffered))
+            attributes |= FILE_FLAG_NO_BUFFERING;
+
+        const HANDLE handle = CreateFileA(
+            _path,
+            access,
+            FILE_SHARE_READ | FILE_SHARE_WRITE,
+            nullptr,
+            disposition,
+            attributes,
+            nullptr);
+        return reinterpret_cast<Handle>(handle);
+    }
+
+    void Close(Handle _handle)
+    {
+        if (_handle != kInvalidHandle)
+            CloseHandle(ToWin32(_handle));
+    }
+
+    s64 GetSize(Handle _handle)
+    {
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(ToWin32(_handle), &size))
+            return -1;
+        return size.QuadPart;
+    }
+
+    s64 ReadAt(Handle _handle, void* _buffer, u64 _size, u64 _offset)
+    {
+        u64 total = 0;
+        while (total < _size)
+        {
+            const DWORD chunk = static_cast<DWORD>(eastl::min(_size - total, kMaxAccessChunk));
+            OVERLAPPED overlapped = MakeOverlapped(_offset + total);
+            DWORD read = 0;
+            if (!ReadFile(ToWin32(_handle), static_cast<u8*>(_buffer) + total, chunk, &read, &overlapped))
+            {
+                if (GetLastError() == ERROR_HANDLE_EOF)
+                    break;
+                return -1;
+            }
+            total += read;
+            if (read < chunk)
+                break;
+        }
+        return static_cast<s64>(total);
+    }
+
+    s64 WriteAt(Handle _handle, const void* _buffer, u64 _size, u64 _offset)
+    {
+        u64 total = 0;
+        while (total < _size)
+        {
+            const DWORD chunk = static_cast<DWORD>(eastl::min(_size - total, kMaxAccessChunk));
+            OVERLAPPED overlapped = MakeOverlapped(_offset + total);
+            DWORD written = 0;
+            if (!WriteFile(ToWin32(_handle), static_cast<const u8*>(_buffer) + total, chunk, &written, &overlapped))
+                return -1;
+            total += written;
+        }
+        return static_cast<s64>(total);
+    }
+
+    bool Sync(Handle _handle, bool /* _dataOnly */)
+    {
+        return FlushFileBuffers(ToWin32(_handle)) != 0;
+    }
+#else
+    Handle Open(const char* _path, OpenFlags _flags)
+    {
+        int flags;
+        const bool read = BitUtils::EnumHasAny(_flags, OpenFlags::Read);
+        const bool write = BitUtils::EnumHasAny(_flags, OpenFlags::Write);
+        if (read && write)
+            flags = O_RDWR;
+        else if (write)
+            flags = O_WRONLY;
+        else
+            flags = O_RDONLY;
+
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Create))
+            flags |= O_CREAT;
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Truncate))
+            flags |= O_TRUNC;
+#if defined(O_DIRECT)
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Unbuffered))
+            flags |= O_DIRECT;
+#endif
+#if defined(O_CLOEXEC)
+        flags |= O_CLOEXEC;
+#endif
+
+        const int fd = open(_path, flags, 0644);
+        if (fd < 0)
+            return kInvalidHandle;
+
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+        // Darwin has no O_DIRECT, the page cache is disabled per descriptor instead.
+        if (BitUtils::EnumHasAny(_flags, OpenFlags::Unbuffered))
+            fcntl(fd, F_NOCACHE, 1);
+#endif
+
+        return fd;
+    }
+
+    void Close(Handle _handle)
+    {
+        if (_handle != kInvalidHandle)
+            close(static_cast<int>(_handle));
+    }
+
+    s64 GetSize(Handle _handle)
+    {
+        struct stat fileStat {};
+        if (fstat(static_cast<int>(_handle), &fileStat) != 0)
+            return -1;
+        return fileStat.st_size;
+    }
+
+    s64 ReadAt(Handle _handle, void* _buffer, u64 _size, u64 _offset)
+    {
+        u64 total = 0;
+        while (total < _size)
+        {
+            const ssize_t read = pread(
+                static_cast<int>(_handle),
+                static_cast<u8*>(_buffer) + total,
+                _size - total,
+                static_cast<off_t>(_offset + total));
+            if (read < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return -1;
+            }
+            if (read == 0)
+                break;
+            total += read;
+        }
+        return static_cast<s64>(total);
+    }
+
+    s64 WriteAt(Handle _handle, const void* _buffer, u64 _size, u64 _offset)
+    {
+        u64 total = 0;
+        while (total < _size)
+        {
+            const ssize_t written = pwrite(
+                static_cast<int>(_handle),
+                static_cast<const u8*>(_buffer) + total,
+                _size - total,
+                static_cast<off_t>(_offset + total));
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return -1;
+            }
+            total += written;
+        }
+        return static_cast<s64>(total);
+    }
+
+    bool Sync(Handle _handle, bool _dataOnly)
+    {
+        const int fd = static_cast<int>(_handle);
+#if defined(__APPLE__)
+        // fsync() doesn't flush the drive cache on Darwin, F_FULLFSYNC is required for actual durability.
+        if (!_dataOnly && fcntl(fd, F_FULLFSYNC) == 0)
+            return true;
+        return fsync(fd) == 0;
+#else
+        return (_dataOnly ? fdatasync(fd) : fsync(fd)) == 0;
+#endif
+    }
+#endif
+}
@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include "KryneEngine/Core/Common/BitUtils.hpp"
+#include "KryneEngine/Core/Common/Types.hpp"
+
+/**
+ * @brief Thin wrappers around the OS file descriptors.
+ *
+ * @details
+ * `FILE*` streams are buffered and carry a file position, which makes them unsuitable for unbuffered reads or for
+ * concurrent position-independent accesses. These helpers expose the native descriptors (POSIX fds, or Win32 `HANDLE`
+ * values) with pread/pwrite-style operations instead.
+ */
+namespace KryneEngine::NativeFile
+{
+    /// A POSIX file descriptor or a Win32 `HANDLE`, depending on the platform.
+    using Handle = intptr_t;
+
+    /// Matches both `-1` POSIX fds and `INVALID_HANDLE_VALUE`.
+    static constexpr Handle kInvalidHandle = -1;
+
+    /// Conservative alignment for unbuffered accesses, matching the logical block size of most storage devices.
+    static constexpr u64 kUnbufferedAlignment = 4096;
+
+    enum class OpenFlags: u8
+    {
+        None        = 0,
+        Read        = 1 << 0,
+        Write       = 1 << 1,
+        Create      = 1 << 2,
+        Truncate    = 1 << 3,
+        /// Bypass the OS page cache (`O_DIRECT`, `F_NOCACHE` or `FILE_FLAG_NO_BUFFERING`).
+        /// Offsets, sizes and buffers must then be aligned to `kUnbufferedAlignment`.
+        Unbuffered  = 1 << 4,
+    };
+    KE_ENUM_IMPLEMENT_BITWISE_OPERATORS(OpenFlags)
+
+    [[nodiscard]] Handle Open(const char* _path, OpenFlags _flags);
+    void Close(Handle _handle);
+
+    /// @returns The file size in bytes, or -1 on error.
+    [[nodiscard]] s64 GetSize(Handle _handle);
+
+    /**
+     * @brief Reads at an absolute offset, without using or updating any file position.
+     * @returns The number of bytes read, or -1 on error. A short count means the end of the file was reached.
+     */
+    s64 ReadAt(Handle _handle, void* _buffer, u64 _size, u64 _offset);
+
+    /**
+     * @brief Writes at an absolute offset, without using or updating any file position.
+     * @returns The number of bytes written, or -1 on error.
+     */
+    s64 WriteAt(Handle _handle, const void* _buffer, u64 _size, u64 _offset);
+
+    /**
+     * @brief Flushes the file to the storage device.
+     * @param _dataOnly If true, metadata that isn't required to read back the data is not flushed (`fdatasync`).
+     */
+    bool Sync(Handle _handle, bool _dataOnly);
+}
@@ -0,0 +1,318 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "Files/WriteBehindQueue.hpp"
+
+#include <cstring>
+#include <EASTL/algorithm.h>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+
+namespace KryneEngine
+{
+    WriteBehindQueue::WriteBehindQueue(AllocatorInstance _allocator)
+        : m_allocator(_allocator)
+        , m_files(_allocator)
+    {}
+
+    WriteBehindQueue::~WriteBehindQueue()
+    {
+        KE_ASSERT_MSG(m_files.empty(), "Write-behind files should be closed before destroying the queue");
+    }
+
+    void WriteBehindQueue::Process(Query* _query, FibersManager* _fibersManager)
+    {
+        if (_query->m_type == Query::Type::Barrier)
+        {
+            if (_query->m_path != nullptr)
+            {
+                const auto it = m_files.find(StringHash::Hash64(_query->m_path));
+                if (it != m_files.end())
+                {
+                    _FlushFile(it->second, _fibersManager);
+                    _SyncFile(it->second, false, _fibersManager);
+                }
+            }
+            else
+            {
+                for (auto& [key, file]: m_files)
+                {
+                    _FlushFile(file, _fibersManager);
+                    _SyncFile(file, false, _fibersManager);
+                }
+            }
+
+            IoQueryManager::_FinishQuery(_query, _fibersManager);
+            return;
+        }
+
+        KE_ASSERT(_query->m_type == Query::Type::Write);
+
+        const u64 key = StringHash::Hash64(_query->m_path);
+        PendingFile* file = _FindOrOpenFile(key, _query);
+        IF_NOT_VERIFY_MSG(file != nullptr, "Error while opening file")
+        {
+            _query->m_size = 0;
+            IoQueryManager::_FinishQuery(_query, _fibersManager);
+            return;
+        }
+
+        if (_query->m_size > 0)
+        {
+            IF_NOT_VERIFY_MSG(_query->m_data != nullptr && _query->m_size != UINT64_MAX, "Invalid write-behind data")
+            {
+                _query->m_size = 0;
+                IoQueryManager::_FinishQuery(_query, _fibersManager);
+                return;
+            }
+
+            _InsertWrite(*file, _query->m_offset, _query->m_data, _query->m_size);
+        }
+        file->m_waitingQueries.push_back(_query);
+
+        if (_query->m_closeFile)
+        {
+            // The query might be completed and freed when closing the file, so it can't be accessed anymore.
+            _CloseFile(*file, _fibersManager);
+            m_files.erase(key);
+        }
+        else if (file->m_pendingBytes >= IoQueryManager::kWriteBehindFlushSize || _query->m_size == 0)
+        {
+            // Empty writes have nothing to wait for.
+            _FlushFile(*file, _fibersManager);
+        }
+    }
+
+    void WriteBehindQueue::Flush(const eastl::string_view& _path, FibersManager* _fibersManager)
+    {
+        const auto it = m_files.find(StringHash::Hash64(_path));
+        if (it != m_files.end())
+        {
+            _FlushFile(it->second, _fibersManager);
+        }
+    }
+
+    void WriteBehindQueue::Update(FibersManager* _fibersManager)
+    {
+        if (m_pendingFileCount == 0)
+        {
+            return;
+        }
+
+        const Clock::time_point now = Clock::now();
+        for (auto& [key, file]: m_files)
+        {
+            if (file.m_pendingBytes > 0 && now - file.m_oldestPendingWrite >= IoQueryManager::kWriteBehindFlushDelay)
+            {
+                _FlushFile(file, _fibersManager);
+            }
+        }
+    }
+
+    void WriteBehindQueue::CloseAll(FibersManager* _fibersManager)
+    {
+        for (auto& [key, file]: m_files)
+        {
+            _CloseFile(file, _fibersManager);
+        }
+        m_files.clear();
+    }
+
+    WriteBehindQueue::Clock::time_point WriteBehindQueue::GetNextFlushTime() const
+    {
+        Clock::time_point nextFlush = Clock::time_point::max();
+        for (const auto& [key, file]: m_files)
+        {
+            if (file.m_pendingBytes > 0)
+            {
+                nextFlush = eastl::min(
+                    nextFlush,
+                    file.m_oldestPendingWrite + std::chrono::duration_cast<Clock::duration>(IoQueryManager::kWriteBehindFlushDelay));
+            }
+        }
+        return nextFlush;
+    }
+
+    WriteBehindQueue::PendingFile* WriteBehindQueue::_FindOrOpenFile(u64 _key, const Query* _query)
+    {
+        const auto it = m_files.find(_key);
+        if (it != m_files.end())
+        {
+            return &it->second;
+        }
+
+        // Truncation only applies when the file isn't opened yet, to never drop pending data.
+        NativeFile::OpenFlags flags = NativeFile::OpenFlags::Write | NativeFile::OpenFlags::Create;
+        if (_query->m_destroyOnOpen)
+        {
+            flags |= NativeFile::OpenFlags::Truncate;
+        }
+
+        const NativeFile::Handle handle = NativeFile::Open(_query->m_path, flags);
+        if (handle == NativeFile::kInvalidHandle)
+        {
+            return nullptr;
+        }
+
+        PendingFile& file = m_files[_key];
+        file.m_path = eastl::string(_query->m_path, m_allocator);
+        file.m_handle = handle;
+        file.m_extents.set_allocator(m_allocator);
+        file.m_waitingQueries.set_allocator(m_allocator);
+        return &file;
+    }
+
+    void WriteBehindQueue::_InsertWrite(PendingFile& _file, u64 _offset, const u8* _data, u64 _size)
+    {
+        const u64 begin = _offset;
+        const u64 end = _offset + _size;
+
+        if (_file.m_pendingBytes == 0)
+        {
+            _file.m_oldestPendingWrite = Clock::now();
+            m_pendingFileCount++;
+        }
+
+        // Find the range of extents overlapping or adjacent to the new write.
+        auto first = eastl::lower_bound(
+            _file.m_extents.begin(),
+            _file.m_extents.end(),
+            begin,
+            [](const Extent& _extent, u64 _begin) { return _extent.GetEnd() < _begin; });
+        auto last = first;
+        while (last != _file.m_extents.end() && last->m_offset <= end)
+        {
+            ++last;
+        }
+
+        if (first == last)
+        {
+            Extent extent { begin, eastl::vector<u8>(m_allocator) };
+            extent.m_data.assign(_data, _data + _size);
+            _file.m_extents.insert(first, eastl::move(extent));
+            _file.m_pendingBytes += _size;
+            return;
+        }
+
+        u64 previousBytes = 0;
+        for (auto it = first; it != last; ++it)
+        {
+            previousBytes += it->m_data.size();
+        }
+
+        const u64 mergedEnd = eastl::max(end, (last - 1)->GetEnd());
+        if (last - first == 1 && first->m_offset <= begin)
+        {
+            // Appending to or overwriting a single extent (typical of logs), grow it in place.
+            first->m_data.resize(mergedEnd - first->m_offset);
+            memcpy(first->m_data.data() + (begin - first->m_offset), _data, _size);
+        }
+        else
+        {
+            const u64 mergedBegin = eastl::min(begin, first->m_offset);
+            eastl::vector<u8> merged(mergedEnd - mergedBegin, m_allocator);
+            for (auto it = first; it != last; ++it)
+            {
+                memcpy(merged.data() + (it->m_offset - mergedBegin), it->m_data.data(), it->m_data.size());
+            }
+            memcpy(merged.data() + (begin - mergedBegin), _data, _size);
+
+            first->m_offset = mergedBegin;
+            first->m_data = eastl::move(merged);
+            _file.m_extents.erase(first + 1, last);
+        }
+
+        _file.m_pendingBytes += first->m_data.size() - previousBytes;
+    }
+
+    void WriteBehindQueue::_FlushFile(PendingFile& _file, FibersManager* _fibersManager)
+    {
+        bool failed = false;
+        for (const Extent& extent: _file.m_extents)
+        {
+            const s64 written = NativeFile::WriteAt(_file.m_handle, extent.m_data.data(), extent.m_data.size(), extent.m_offset);
+            failed |= written != static_cast<s64>(extent.m_data.size());
+        }
+        IF_NOT_VERIFY_MSG(!failed, "Error while writing file")
+        {
+            _MarkFailed(_file);
+        }
+
+        if (_file.m_pendingBytes > 0)
+        {
+            m_pendingFileCount--;
+            _file.m_pendingBytes = 0;
+        }
+        _file.m_extents.clear();
+
+        _CompleteQueries(_file, Query::Durability::None, _fibersManager);
+    }
+
+    void WriteBehindQueue::_SyncFile(PendingFile& _file, bool _dataOnly, FibersManager* _fibersManager)
+    {
+        IF_NOT_VERIFY_MSG(NativeFile::Sync(_file.m_handle, _dataOnly), "Error while syncing file")
+        {
+            _MarkFailed(_file);
+        }
+
+        _CompleteQueries(_file, Query::Durability::SyncOnBarrier, _fibersManager);
+    }
+
+    void WriteBehindQueue::_CloseFile(PendingFile& _file, FibersManager* _fibersManager)
+    {
+        _FlushFile(_file, _fibersManager);
+
+        bool needsSync = false;
+        bool needsFullSync = false;
+        for (const Query* query: _file.m_waitingQueries)
+        {
+            needsSync |= query->m_durability != Query::Durability::None;
+            needsFullSync |= query->m_durability == Query::Durability::SyncOnBarrier;
+        }
+
+        if (needsSync)
+        {
+            IF_NOT_VERIFY_MSG(NativeFile::Sync(_file.m_handle, !needsFullSync), "Error while syncing file")
+            {
+                _MarkFailed(_file);
+            }
+        }
+
+        NativeFile::Close(_file.m_handle);
+        _file.m_handle = NativeFile::kInvalidHandle;
+
+        _CompleteQueries(_file, Query::Durability::SyncOnClose, _fibersManager);
+    }
+
+    void WriteBehindQueue::_MarkFailed(PendingFile& _file)
+    {
+        // All waiting queries had their data in the failed operation.
+        for (Query* query: _file.m_waitingQueries)
+        {
+            query->m_size = 0;
+        }
+    }
+
+    void WriteBehindQueue::_CompleteQueries(
+        PendingFile& _file,
+        Query::Durability _maxDurability,
+        FibersManager* _fibersManager)
+    {
+        auto out = _file.m_waitingQueries.begin();
+        for (Query* query: _file.m_waitingQueries)
+        {
+            if (query->m_durability > _maxDurability)
+            {
+                *out++ = query;
+            }
+            else
+            {
+                IoQueryManager::_FinishQuery(query, _fibersManager);
+            }
+        }
+        _file.m_waitingQueries.erase(out, _file.m_waitingQueries.end());
+    }
+} // KryneEngine
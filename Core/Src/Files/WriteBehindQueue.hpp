@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <EASTL/hash_map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include "Files/IoQueryManager.hpp"
+#include "Files/NativeFile.hpp"
+
+namespace KryneEngine
+{
+    /**
+     * @brief Coalesces write-behind queries per file, and completes them once their durability level is reached.
+     *
+     * @details
+     * Only ever used from the IO thread, so it isn't thread-safe.
+     *
+     * Written data is copied into per-file extents, sorted by offset. Overlapping and adjacent writes are merged into
+     * a single extent (later writes win), so each flush issues one positional write per contiguous range.
+     * A file is flushed once its pending data reaches `IoQueryManager::kWriteBehindFlushSize`, once its oldest pending
+     * write is older than `IoQueryManager::kWriteBehindFlushDelay`, or when another query accesses the same path.
+     */
+    class WriteBehindQueue
+    {
+    public:
+        using Query = IoQueryManager::Query;
+        using Clock = std::chrono::steady_clock;
+
+        explicit WriteBehindQueue(AllocatorInstance _allocator);
+        ~WriteBehindQueue();
+
+        WriteBehindQueue(const WriteBehindQueue&) = delete;
+        WriteBehindQueue& operator=(const WriteBehindQueue&) = delete;
+
+        /// @brief Handles a write-behind write or a barrier query. The query is completed by the queue.
+        void Process(Query* _query, FibersManager* _fibersManager);
+
+        /// @brief Writes the pending data of `_path` to the OS, if any.
+        void Flush(const eastl::string_view& _path, FibersManager* _fibersManager);
+
+        /// @brief Flushes files which pending data reached the time threshold.
+        void Update(FibersManager* _fibersManager);
+
+        /// @brief Flushes and closes all files, completing all remaining queries.
+        void CloseAll(FibersManager* _fibersManager);
+
+        [[nodiscard]] bool HasPendingWrites() const { return m_pendingFileCount > 0; }
+        [[nodiscard]] Clock::time_point GetNextFlushTime() const;
+
+    private:
+        struct Extent
+        {
+            u64 m_offset;
+            eastl::vector<u8> m_data;
+
+            [[nodiscard]] u64 GetEnd() const { return m_offset + m_data.size(); }
+        };
+
+        struct PendingFile
+        {
+            eastl::string m_path;
+            NativeFile::Handle m_handle = NativeFile::kInvalidHandle;
+            eastl::vector<Extent> m_extents;
+            eastl::vector<Query*> m_waitingQueries;
+            u64 m_pendingBytes = 0;
+            Clock::time_point m_oldestPendingWrite {};
+        };
+
+        AllocatorInstance m_allocator;
+        eastl::hash_map<u64, PendingFile> m_files;
+        u32 m_pendingFileCount = 0;
+
+        PendingFile* _FindOrOpenFile(u64 _key, const Query* _query);
+        void _InsertWrite(PendingFile& _file, u64 _offset, const u8* _data, u64 _size);
+
+        void _FlushFile(PendingFile& _file, FibersManager* _fibersManager);
+        void _SyncFile(PendingFile& _file, bool _dataOnly, FibersManager* _fibersManager);
+        void _CloseFile(PendingFile& _file, FibersManager* _fibersManager);
+
+        static void _MarkFailed(PendingFile& _file);
+        static void _CompleteQueries(PendingFile& _file, Query::Durability _maxDurability, FibersManager* _fibersManager);
+    };
+} // KryneEngine
@@ -0,0 +1,645 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Math/Bvh.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Math/XSimdUtils.hpp"
+#include "KryneEngine/Core/Profiling/TracyHeader.hpp"
+#include "KryneEngine/Core/Threads/FibersManager.hpp"
+
+namespace KryneEngine::Math
+{
+    namespace
+    {
+        constexpr u32 kBinCount = 16;
+
+        // Cost of a traversal step, relative to the cost of a primitive test.
+        constexpr float kTraversalCost = 1.f;
+
+        // Below this primitive count, the build is not worth splitting across jobs.
+        constexpr u32 kParallelBuildThreshold = 16 * 1024;
+
+        // Plain bounds used during the build, to keep the binning loops free of vector function calls.
+        struct Bounds
+        {
+            float m_min[3] { FLT_MAX, FLT_MAX, FLT_MAX };
+            float m_max[3] { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+            void Expand(const float* _point)
+            {
+                for (u32 axis = 0; axis < 3; axis++)
+                {
+                    m_min[axis] = eastl::min(m_min[axis], _point[axis]);
+                    m_max[axis] = eastl::max(m_max[axis], _point[axis]);
+                }
+            }
+
+            void Merge(const Bounds& _other)
+            {
+                for (u32 axis = 0; axis < 3; axis++)
+                {
+                    m_min[axis] = eastl::min(m_min[axis], _other.m_min[axis]);
+                    m_max[axis] = eastl::max(m_max[axis], _other.m_max[axis]);
+                }
+            }
+
+            [[nodiscard]] float SurfaceArea() const
+            {
+                const float x = m_max[0] - m_min[0];
+                const float y = m_max[1] - m_min[1];
+                const float z = m_max[2] - m_min[2];
+                return 2.f * (x * y + y * z + z * x);
+            }
+        };
+
+        // Binary node, as built before being collapsed into wide nodes.
+        struct BinaryNode
+        {
+            Bounds m_bounds;
+            // Index of the first of the two adjacent children for inner nodes, or of the first primitive for leaves.
+            u32 m_first = 0;
+            // 0 for inner nodes.
+            u32 m_count = 0;
+        };
+
+        struct BuildContext
+        {
+            const Bounds* m_bounds;
+            // 3 coordinates per primitive
+            const float* m_centroids;
+            u32* m_indices;
+            u32 m_maxLeafSize;
+        };
+
+        struct Range
+        {
+            u32 m_begin;
+            u32 m_end;
+
+            [[nodiscard]] u32 Size() const { return m_end - m_begin; }
+        };
+
+        Bounds ComputeBounds(const BuildContext& _context, Range _range)
+        {
+            Bounds bounds;
+            for (u32 i = _range.m_begin; i < _range.m_end; i++)
+            {
+                bounds.Merge(_context.m_bounds[_context.m_indices[i]]);
+            }
+            return bounds;
+        }
+
+        /**
+         * @brief Looks for the best binned SAH split of the range, and partitions its primitives accordingly.
+         * @return `false` if the range should be a leaf.
+         */
+        bool SplitRange(const BuildContext& _context, Range _range, const Bounds& _bounds, u32& split_)
+        {
+            const u32 count = _range.Size();
+            if (count <= 1)
+            {
+                return false;
+            }
+
+            Bounds centroidBounds;
+            for (u32 i = _range.m_begin; i < _range.m_end; i++)
+            {
+                centroidBounds.Expand(_context.m_centroids + _context.m_indices[i] * 3);
+            }
+
+            // Small ranges don't need more bins than primitives.
+            const u32 binCount = eastl::min(kBinCount, count);
+            const auto computeBin = [&](u32 _primitive, u32 _axis, float _scale)
+            {
+                const float offset = _context.m_centroids[_primitive * 3 + _axis] - centroidBounds.m_min[_axis];
+                return eastl::min(static_cast<u32>(offset * _scale), binCount - 1);
+            };
+
+            const float parentArea = _bounds.SurfaceArea();
+            const float inverseParentArea = parentArea > 0.f ? 1.f / parentArea : 1.f;
+
+            float bestCost = FLT_MAX;
+            u32 bestAxis = 3;
+            u32 bestBin = 0;
+            for (u32 axis = 0; axis < 3; axis++)
+            {
+                const float extent = centroidBounds.m_max[axis] - centroidBounds.m_min[axis];
+                if (extent <= 0.f)
+                {
+                    continue;
+                }
+                const float scale = static_cast<float>(binCount) / extent;
+
+                Bounds binBounds[kBinCount];
+                u32 binCounts[kBinCount] {};
+                for (u32 i = _range.m_begin; i < _range.m_end; i++)
+                {
+                    const u32 primitive = _context.m_indices[i];
+                    const u32 bin = computeBin(primitive, axis, scale);
+                    binCounts[bin]++;
+                    binBounds[bin].Merge(_context.m_bounds[primitive]);
+                }
+
+                // Left side costs of the splits after each bin, then sweep from the right to get the totals.
+                float leftCosts[kBinCount - 1];
+                Bounds accumulatedBounds;
+                u32 accumulatedCount = 0;
+                for (u32 bin = 0; bin < binCount - 1; bin++)
+                {
+                    accumulatedBounds.Merge(binBounds[bin]);
+                    accumulatedCount += binCounts[bin];
+                    leftCosts[bin] = accumulatedCount > 0
+                        ? accumulatedBounds.SurfaceArea() * static_cast<float>(accumulatedCount)
+                        : 0.f;
+                }
+
+                accumulatedBounds = {};
+                accumulatedCount = 0;
+                for (u32 bin = binCount - 1; bin > 0; bin--)
+                {
+                    accumulatedBounds.Merge(binBounds[bin]);
+                    accumulatedCount += binCounts[bin];
+                    if (accumulatedCount == 0 || accumulatedCount == count)
+                    {
+                        continue;
+                    }
+
+                    const float cost = kTraversalCost
+                        + (leftCosts[bin - 1] + accumulatedBounds.SurfaceArea() * static_cast<float>(accumulatedCount))
+                            * inverseParentArea;
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin - 1;
+                    }
+                }
+            }
+
+            const bool fitsInLeaf = count <= _context.m_maxLeafSize;
+            if (fitsInLeaf && bestCost >= static_cast<float>(count))
+            {
+                return false;
+            }
+
+            u32* begin = _context.m_indices + _range.m_begin;
+            u32* end = _context.m_indices + _range.m_end;
+
+            if (bestAxis < 3)
+            {
+                const float scale =
+                    static_cast<float>(binCount) / (centroidBounds.m_max[bestAxis] - centroidBounds.m_min[bestAxis]);
+                split_ = static_cast<u32>(
+                    std::partition(begin, end, [&](u32 _primitive)
+                    {
+                        return computeBin(_primitive, bestAxis, scale) <= bestBin;
+                    }) - _context.m_indices);
+                return true;
+            }
+
+            // All centroids are at the same position, there is no better split than cutting the range in half.
+            if (fitsInLeaf)
+            {
+                return false;
+            }
+            split_ = _range.m_begin + count / 2;
+            return true;
+        }
+
+        /// @brief Builds the subtree of a range, with its root at index 0 of `_nodes`.
+        void BuildSubtree(const BuildContext& _context, Range _range, eastl::vector<BinaryNode>& _nodes)
+        {
+            struct Pending
+            {
+                Range m_range;
+                u32 m_node;
+            };
+            eastl::vector<Pending> stack;
+
+            _nodes.clear();
+            _nodes.push_back({ ComputeBounds(_context, _range) });
+            stack.push_back({ _range, 0 });
+
+            while (!stack.empty())
+            {
+                const Pending pending = stack.back();
+                stack.pop_back();
+
+                u32 split;
+                if (!SplitRange(_context, pending.m_range, _nodes[pending.m_node].m_bounds, split))
+                {
+                    _nodes[pending.m_node].m_first = pending.m_range.m_begin;
+                    _nodes[pending.m_node].m_count = pending.m_range.Size();
+                    continue;
+                }
+
+                const Range left { pending.m_range.m_begin, split };
+                const Range right { split, pending.m_range.m_end };
+                const u32 first = _nodes.size();
+                _nodes[pending.m_node].m_first = first;
+                _nodes.push_back({ ComputeBounds(_context, left) });
+                _nodes.push_back({ ComputeBounds(_context, right) });
+                stack.push_back({ left, first });
+                stack.push_back({ right, first + 1 });
+            }
+        }
+
+        struct SubtreeJob
+        {
+            const BuildContext* m_context;
+            Range m_range;
+            // Index of the subtree root in the top level nodes.
+            u32 m_rootIndex;
+            eastl::vector<BinaryNode> m_nodes;
+        };
+
+        void BuildSubtreeJob(void* _userData)
+        {
+            auto* job = static_cast<SubtreeJob*>(_userData);
+            BuildSubtree(*job->m_context, job->m_range, job->m_nodes);
+        }
+
+        Bvh::Node MakeEmptyNode()
+        {
+            Bvh::Node node;
+            for (u32 i = 0; i < Bvh::kWidth; i++)
+            {
+                node.m_minX[i] = node.m_minY[i] = node.m_minZ[i] = FLT_MAX;
+                node.m_maxX[i] = node.m_maxY[i] = node.m_maxZ[i] = -FLT_MAX;
+                node.m_children[i] = Bvh::kInvalidIndex;
+                node.m_counts[i] = 0;
+            }
+            return node;
+        }
+
+        /// @brief Collapses the binary tree into wide nodes, by opening the largest inner children first.
+        void CollapseTree(const eastl::vector<BinaryNode>& _binaryNodes, eastl::vector<Bvh::Node>& _nodes)
+        {
+            struct Pending
+            {
+                u32 m_binaryNode;
+                u32 m_node;
+            };
+            eastl::vector<Pending> stack;
+
+            _nodes.push_back(MakeEmptyNode());
+            stack.push_back({ 0, 0 });
+
+            while (!stack.empty())
+            {
+                const Pending pending = stack.back();
+                stack.pop_back();
+
+                u32 children[Bvh::kWidth];
+                u32 childCount = 0;
+                const BinaryNode& binaryNode = _binaryNodes[pending.m_binaryNode];
+                if (binaryNode.m_count > 0)
+                {
+                    // Only happens when the whole tree is a single leaf.
+                    children[childCount++] = pending.m_binaryNode;
+                }
+                else
+                {
+                    children[childCount++] = binaryNode.m_first;
+                    children[childCount++] = binaryNode.m_first + 1;
+                }
+
+                while (childCount < Bvh::kWidth)
+                {
+                    u32 largest = Bvh::kInvalidIndex;
+                    float largestArea = -1.f;
+                    for (u32 i = 0; i < childCount; i++)
+                    {
+                        const BinaryNode& child = _binaryNodes[children[i]];
+                        const float area = child.m_bounds.SurfaceArea();
+                        if (child.m_count == 0 && area > largestArea)
+                        {
+                            largest = i;
+                            largestArea = area;
+                        }
+                    }
+                    if (largest == Bvh::kInvalidIndex)
+                    {
+                        break;
+                    }
+
+                    const u32 first = _binaryNodes[children[largest]].m_first;
+                    children[largest] = first;
+                    children[childCount++] = first + 1;
+                }
+
+                Bvh::Node node = MakeEmptyNode();
+                for (u32 i = 0; i < childCount; i++)
+                {
+                    const BinaryNode& child = _binaryNodes[children[i]];
+                    node.m_minX[i] = child.m_bounds.m_min[0];
+                    node.m_minY[i] = child.m_bounds.m_min[1];
+                    node.m_minZ[i] = child.m_bounds.m_min[2];
+                    node.m_maxX[i] = child.m_bounds.m_max[0];
+                    node.m_maxY[i] = child.m_bounds.m_max[1];
+                    node.m_maxZ[i] = child.m_bounds.m_max[2];
+
+                    if (child.m_count > 0)
+                    {
+                        node.m_children[i] = child.m_first;
+                        node.m_counts[i] = child.m_count;
+                    }
+                    else
+                    {
+                        node.m_children[i] = _nodes.size();
+                        _nodes.push_back(MakeEmptyNode());
+                        stack.push_back({ children[i], node.m_children[i] });
+                    }
+                }
+                _nodes[pending.m_node] = node;
+            }
+        }
+    }
+
+    void Bvh::Build(eastl::span<const BoundingBox> _primitives, FibersManager* _fibersManager, u32 _maxLeafSize)
+    {
+        KE_ZoneScopedFunction("Bvh::Build");
+
+        Clear();
+        if (_primitives.empty())
+        {
+            return;
+        }
+
+        KE_ASSERT(_maxLeafSize > 0);
+        KE_ASSERT(_primitives.size() < kInvalidIndex);
+        const u32 primitiveCount = _primitives.size();
+
+        eastl::vector<Bounds> bounds(primitiveCount);
+        eastl::vector<float> centroids(primitiveCount * 3);
+        m_primitiveIndices.resize(primitiveCount);
+        for (u32 i = 0; i < primitiveCount; i++)
+        {
+            const BoundingBox& primitive = _primitives[i];
+            bounds[i] = {
+                { primitive.m_min.x, primitive.m_min.y, primitive.m_min.z },
+                { primitive.m_max.x, primitive.m_max.y, primitive.m_max.z },
+            };
+            for (u32 axis = 0; axis < 3; axis++)
+            {
+                centroids[i * 3 + axis] = (bounds[i].m_min[axis] + bounds[i].m_max[axis]) * 0.5f;
+            }
+            m_primitiveIndices[i] = i;
+        }
+
+        const BuildContext context {
+            bounds.data(),
+            centroids.data(),
+            m_primitiveIndices.data(),
+            _maxLeafSize,
+        };
+
+        // The top of the tree is split serially, until there are enough subtrees to keep all the fibers busy.
+        // Each subtree is then built by its own job, on its own disjoint primitive range.
+        eastl::vector<BinaryNode> binaryNodes;
+        eastl::vector<SubtreeJob> jobs;
+        binaryNodes.push_back({});
+        {
+            const u32 subtreeTarget = _fibersManager != nullptr && primitiveCount >= kParallelBuildThreshold
+                ? _fibersManager->GetFiberThreadCount() * 4u
+                : 1u;
+            const u32 maxSubtreeSize = eastl::max(primitiveCount / eastl::max(subtreeTarget, 1u), kParallelBuildThreshold / 4);
+
+            eastl::vector<eastl::pair<Range, u32>> pending;
+            pending.push_back({ Range { 0, primitiveCount }, 0 });
+            binaryNodes[0].m_bounds = ComputeBounds(context, { 0, primitiveCount });
+            while (!pending.empty())
+            {
+                const auto [range, nodeIndex] = pending.back();
+                pending.pop_back();
+
+                u32 split;
+                if (subtreeTarget == 1 || range.Size() <= maxSubtreeSize)
+                {
+                    jobs.push_back({ &context, range, nodeIndex });
+                }
+                else if (SplitRange(context, range, binaryNodes[nodeIndex].m_bounds, split))
+                {
+                    const Range left { range.m_begin, split };
+                    const Range right { split, range.m_end };
+                    const u32 first = binaryNodes.size();
+                    binaryNodes[nodeIndex].m_first = first;
+                    binaryNodes.push_back({ ComputeBounds(context, left) });
+                    binaryNodes.push_back({ ComputeBounds(context, right) });
+                    pending.push_back({ left, first });
+                    pending.push_back({ right, first + 1 });
+                }
+                else
+                {
+                    binaryNodes[nodeIndex].m_first = range.m_begin;
+                    binaryNodes[nodeIndex].m_count = range.Size();
+                }
+            }
+        }
+
+        if (_fibersManager != nullptr && jobs.size() > 1)
+        {
+            // Build the last subtree on the calling fiber, like the render graph does with its jobs.
+            const SyncCounterId counter = _fibersManager->InitAndBatchJobs(jobs.size() - 1, BuildSubtreeJob, jobs.data());
+            BuildSubtreeJob(&jobs.back());
+            _fibersManager->WaitForCounterAndReset(counter);
+        }
+        else
+        {
+            for (SubtreeJob& job: jobs)
+            {
+                BuildSubtreeJob(&job);
+            }
+        }
+
+        // Graft the subtrees: their root replaces the top level placeholder, other nodes are appended.
+        for (const SubtreeJob& job: jobs)
+        {
+            const u32 offset = binaryNodes.size() - 1;
+            const auto relocate = [offset](BinaryNode _node)
+            {
+                if (_node.m_count == 0)
+                {
+                    _node.m_first += offset;
+                }
+                return _node;
+            };
+
+            binaryNodes[job.m_rootIndex] = relocate(job.m_nodes[0]);
+            for (size_t i = 1; i < job.m_nodes.size(); i++)
+            {
+                binaryNodes.push_back(relocate(job.m_nodes[i]));
+            }
+        }
+
+        CollapseTree(binaryNodes, m_nodes);
+
+        m_primitiveBounds.reserve(primitiveCount);
+        for (const u32 primitive: m_primitiveIndices)
+        {
+            m_primitiveBounds.push_back(_primitives[primitive]);
+        }
+    }
+
+    void Bvh::Clear()
+    {
+        m_nodes.clear();
+        m_primitiveIndices.clear();
+        m_primitiveBounds.clear();
+    }
+
+    namespace
+    {
+        using Batch = xsimd::batch<float, XsimdArch128>;
+
+        // Runs the child test on the 4 children at once when the architecture allows it, one at a time otherwise.
+        template <class Test>
+        u32 TestChildren(const Bvh::Node& _node, Test&& _test)
+        {
+            u32 mask = 0;
+            if constexpr (Batch::size == Bvh::kWidth)
+            {
+                mask = _test(0, std::type_identity<Batch>{}).mask();
+            }
+            else
+            {
+                for (u32 i = 0; i < Bvh::kWidth; i++)
+                {
+                    mask |= (_test(i, std::type_identity<float>{}) ? 1u : 0u) << i;
+                }
+            }
+
+            for (u32 i = 0; i < Bvh::kWidth; i++)
+            {
+                if (_node.m_children[i] == Bvh::kInvalidIndex)
+                {
+                    mask &= ~(1u << i);
+                }
+            }
+            return mask;
+        }
+
+        template <class V>
+        V Load(const float* _ptr)
+        {
+            if constexpr (std::is_same_v<V, float>)
+            {
+                return *_ptr;
+            }
+            else
+            {
+                return V::load_unaligned(_ptr);
+            }
+        }
+
+        template <class V>
+        void Store(float* _ptr, const V& _value)
+        {
+            if constexpr (std::is_same_v<V, float>)
+            {
+                *_ptr = _value;
+            }
+            else
+            {
+                _value.store_unaligned(_ptr);
+            }
+        }
+
+        template <class V>
+        V Min(const V& _a, const V& _b)
+        {
+            if constexpr (std::is_same_v<V, float>)
+            {
+                return eastl::min(_a, _b);
+            }
+            else
+            {
+                return xsimd::min(_a, _b);
+            }
+        }
+
+        template <class V>
+        V Max(const V& _a, const V& _b)
+        {
+            if constexpr (std::is_same_v<V, float>)
+            {
+                return eastl::max(_a, _b);
+            }
+            else
+            {
+                return xsimd::max(_a, _b);
+            }
+        }
+    }
+
+    u32 Bvh::_OverlapChildren(const Node& _node, const BoundingBox& _box)
+    {
+        return TestChildren(_node, [&]<class V>(u32 _i, std::type_identity<V>)
+        {
+            return (Load<V>(_node.m_minX + _i) <= V(_box.m_max.x)) & (Load<V>(_node.m_maxX + _i) >= V(_box.m_min.x))
+                & (Load<V>(_node.m_minY + _i) <= V(_box.m_max.y)) & (Load<V>(_node.m_maxY + _i) >= V(_box.m_min.y))
+                & (Load<V>(_node.m_minZ + _i) <= V(_box.m_max.z)) & (Load<V>(_node.m_maxZ + _i) >= V(_box.m_min.z));
+        });
+    }
+
+    u32 Bvh::_IntersectChildren(const Node& _node, const RayData& _ray, float _maxDistance, float (&distances_)[kWidth])
+    {
+        return TestChildren(_node, [&]<class V>(u32 _i, std::type_identity<V>)
+        {
+            const auto slab = [&](const float* _min, const float* _max, float _origin, float _inverseDirection, V& near_, V& far_)
+            {
+                const V t0 = (Load<V>(_min + _i) - V(_origin)) * V(_inverseDirection);
+                const V t1 = (Load<V>(_max + _i) - V(_origin)) * V(_inverseDirection);
+                near_ = Max(near_, Min(t0, t1));
+                far_ = Min(far_, Max(t0, t1));
+            };
+
+            V near(0.f);
+            V far(_maxDistance);
+            slab(_node.m_minX, _node.m_maxX, _ray.m_origin.x, _ray.m_inverseDirection.x, near, far);
+            slab(_node.m_minY, _node.m_maxY, _ray.m_origin.y, _ray.m_inverseDirection.y, near, far);
+            slab(_node.m_minZ, _node.m_maxZ, _ray.m_origin.z, _ray.m_inverseDirection.z, near, far);
+
+            Store(distances_ + _i, near);
+            return near <= far;
+        });
+    }
+
+    u32 Bvh::_ChildrenDistancesSquared(
+        const Node& _node,
+        const float3& _point,
+        float _maxDistanceSquared,
+        float (&distancesSquared_)[kWidth])
+    {
+        return TestChildren(_node, [&]<class V>(u32 _i, std::type_identity<V>)
+        {
+            const auto axisDistance = [&](const float* _min, const float* _max, float _coordinate)
+            {
+                const V coordinate(_coordinate);
+                return Max(Max(Load<V>(_min + _i) - coordinate, coordinate - Load<V>(_max + _i)), V(0.f));
+            };
+
+            const V dx = axisDistance(_node.m_minX, _node.m_maxX, _point.x);
+            const V dy = axisDistance(_node.m_minY, _node.m_maxY, _point.y);
+            const V dz = axisDistance(_node.m_minZ, _node.m_maxZ, _point.z);
+            const V distanceSquared = dx * dx + dy * dy + dz * dz;
+
+            Store(distancesSquared_ + _i, distanceSquared);
+            return distanceSquared <= V(_maxDistanceSquared);
+        });
+    }
+
+    bool Bvh::_Overlaps(const BoundingBox& _a, const BoundingBox& _b)
+    {
+        return _a.m_min.x <= _b.m_max.x && _a.m_max.x >= _b.m_min.x
+            && _a.m_min.y <= _b.m_max.y && _a.m_max.y >= _b.m_min.y
+            && _a.m_min.z <= _b.m_max.z && _a.m_max.z >= _b.m_min.z;
+    }
+}
@@ -6,6 +6,8 @@
 
 #include "KryneEngine/Core/Math/Float16.hpp"
 
+#include "Math/SimdKernels/SimdKernels.hpp"
+
 #if defined(__ARM_NEON) && defined(__ARM_FP16_FORMAT_IEEE)
 #   include <arm_neon.h>
 #   define KE_ARM_NEON
@@ -144,4 +146,14 @@ namespace KryneEngine::Math
         return static_cast<u32>(ConvertToFloat16(a)) | (static_cast<u32>(ConvertToFloat16(b)) << 16);
 #endif
     }
+
+    void Float16::ConvertToFloat16(const float* _input, u16* _output, size_t _count)
+    {
+        SimdKernels::GetActiveKernels().m_convertToFloat16(_input, _output, _count);
+    }
+
+    void Float16::ConvertFromFloat16(const u16* _input, float* _output, size_t _count)
+    {
+        SimdKernels::GetActiveKernels().m_convertFromFloat16(_input, _output, _count);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Math/Frustum.hpp"
+
+#include <bit>
+#include <cmath>
+
+// For the plane tests, shared with the batched kernels
+#include "Math/SimdKernels/SimdKernels.inl"
+
+namespace KryneEngine::Math
+{
+    using SimdKernels::PlaneCoefficients;
+
+    static_assert(Frustum::Count == SimdKernels::kPlaneCount);
+
+    namespace
+    {
+        void LoadPlanes(const Frustum& _frustum, PlaneCoefficients (&_planes)[Frustum::Count])
+        {
+            for (size_t i = 0; i < Frustum::Count; i++)
+            {
+                const Plane& plane = _frustum.m_planes[i];
+                _planes[i] = {
+                    plane.m_normal.x, plane.m_normal.y, plane.m_normal.z, plane.m_distance,
+                    std::fabs(plane.m_normal.x), std::fabs(plane.m_normal.y), std::fabs(plane.m_normal.z),
+                };
+            }
+        }
+    }
+
+    bool Frustum::Intersects(const BoundingBox& _box) const
+    {
+        PlaneCoefficients planes[Count];
+        LoadPlanes(*this, planes);
+
+        const float3 center = _box.GetCenter();
+        const float3 extent = _box.GetSize() * 0.5f;
+        return SimdKernels::TestBox<float>(planes, center.x, center.y, center.z, extent.x, extent.y, extent.z);
+    }
+
+    bool Frustum::Intersects(const BoundingSphere& _sphere) const
+    {
+        PlaneCoefficients planes[Count];
+        LoadPlanes(*this, planes);
+
+        return SimdKernels::TestSphere<float>(planes, _sphere.m_center.x, _sphere.m_center.y, _sphere.m_center.z, _sphere.m_radius);
+    }
+
+    void CullBoundingBoxes(
+        const Frustum& _frustum,
+        Vector3Soa<const float> _mins,
+        Vector3Soa<const float> _maxs,
+        size_t _count,
+        u64* _visibilityMask)
+    {
+        PlaneCoefficients planes[Frustum::Count];
+        LoadPlanes(_frustum, planes);
+        SimdKernels::GetActiveKernels().m_cullBoundingBoxes(planes, _mins, _maxs, _count, _visibilityMask);
+    }
+
+    void CullBoundingSpheres(
+        const Frustum& _frustum,
+        Vector3Soa<const float> _centers,
+        const float* _radii,
+        size_t _count,
+        u64* _visibilityMask)
+    {
+        PlaneCoefficients planes[Frustum::Count];
+        LoadPlanes(_frustum, planes);
+        SimdKernels::GetActiveKernels().m_cullBoundingSpheres(planes, _centers, _radii, _count, _visibilityMask);
+    }
+
+    size_t CompactVisibleIndices(const u64* _visibilityMask, size_t _count, u32* _indices, u32 _indexOffset)
+    {
+        size_t written = 0;
+        for (size_t word = 0; word < (_count + 63) / 64; word++)
+        {
+            u64 bits = _visibilityMask[word];
+            while (bits != 0)
+            {
+                const size_t index = word * 64 + std::countr_zero(bits);
+                if (index >= _count)
+                {
+                    break;
+                }
+                _indices[written++] = static_cast<u32>(index) + _indexOffset;
+                bits &= bits - 1;
+            }
+        }
+        return written;
+    }
+}
@@ -6,6 +6,10 @@
 
 #include "KryneEngine/Core/Math/Hashing.hpp"
 
+#include <EASTL/algorithm.h>
+
+#include "Math/SimdKernels/SimdKernels.hpp"
+
 namespace KryneEngine
 {
     static constexpr u64 kFnvPrime = 1'099'511'628'211u;
@@ -34,4 +38,195 @@ namespace KryneEngine
         }
         return hash;
     }
-}
\ No newline at end of file
+
+    namespace Hashing::Xxh3
+    {
+        static_assert(kStripeSize == Math::SimdKernels::kXxh3StripeSize);
+        static_assert(kSecretConsumeRate == Math::SimdKernels::kXxh3SecretConsumeRate);
+        static_assert(kPrime32_1 == Math::SimdKernels::kXxh3Prime32_1);
+
+        void AccumulateStripes(u64* _accumulators, const char* _stripes, const u8* _secret, size_t _stripeCount)
+        {
+            Math::SimdKernels::GetActiveKernels().m_xxh3AccumulateStripes(_accumulators, _stripes, _secret, _stripeCount);
+        }
+
+        void Scramble(u64* _accumulators, const u8* _secret)
+        {
+            Math::SimdKernels::GetActiveKernels().m_xxh3Scramble(_accumulators, _secret);
+        }
+
+        u64 HashLong(const char* _data, u64 _size, u64 _seed)
+        {
+            alignas(64) u8 customSecret[kSecretSize];
+            const u8* secret = kDefaultSecret;
+            if (_seed != 0)
+            {
+                InitSecret(customSecret, _seed);
+                secret = customSecret;
+            }
+
+            alignas(64) u64 accumulators[kAccumulatorCount];
+            InitAccumulators(accumulators);
+
+            // Fetched once, rather than on each block.
+            const auto& kernels = Math::SimdKernels::GetActiveKernels();
+
+            constexpr u64 blockSize = kStripesPerBlock * kStripeSize;
+            const u64 blockCount = (_size - 1) / blockSize;
+            for (u64 block = 0; block < blockCount; block++)
+            {
+                kernels.m_xxh3AccumulateStripes(accumulators, _data + block * blockSize, secret, kStripesPerBlock);
+                kernels.m_xxh3Scramble(accumulators, secret + kSecretSize - kStripeSize);
+            }
+
+            const u64 stripeCount = ((_size - 1) - blockCount * blockSize) / kStripeSize;
+            kernels.m_xxh3AccumulateStripes(accumulators, _data + blockCount * blockSize, secret, stripeCount);
+            kernels.m_xxh3AccumulateStripes(
+                accumulators,
+                _data + _size - kStripeSize,
+                secret + kSecretSize - kStripeSize - 7,
+                1);
+
+            return MergeAccumulators(accumulators, secret + 11, _size * kPrime64_1);
+        }
+    }
+
+    namespace Hashing
+    {
+        FastHasher::FastHasher(u64 _seed)
+        {
+            Reset(_seed);
+        }
+
+        void FastHasher::Reset(u64 _seed)
+        {
+            m_seed = _seed;
+            m_totalSize = 0;
+            m_bufferedSize = 0;
+            m_stripesInBlock = 0;
+            m_consumingStripes = false;
+        }
+
+        void FastHasher::Update(const void* _data, size_t _size)
+        {
+            const auto* data = static_cast<const char*>(_data);
+            m_totalSize += _size;
+
+            if (m_bufferedSize + _size <= kBufferSize)
+            {
+                memcpy(m_buffer + m_bufferedSize, data, _size);
+                m_bufferedSize += static_cast<u32>(_size);
+                return;
+            }
+
+            if (!m_consumingStripes)
+            {
+                _StartConsumingStripes();
+            }
+
+            // Stripes are only consumed once more data follows them, as the final stripe is processed differently.
+            if (m_bufferedSize > 0)
+            {
+                const size_t fillSize = kBufferSize - m_bufferedSize;
+                memcpy(m_buffer + m_bufferedSize, data, fillSize);
+                data += fillSize;
+                _size -= fillSize;
+
+                _ConsumeStripes(
+                    m_accumulators,
+                    m_stripesInBlock,
+                    reinterpret_cast<const char*>(m_buffer),
+                    kBufferSize / Xxh3::kStripeSize,
+                    m_secret);
+                m_bufferedSize = 0;
+            }
+
+            // Large inputs are consumed in place.
+            if (_size > kBufferSize)
+            {
+                const size_t stripeCount = (_size - 1) / Xxh3::kStripeSize;
+                _ConsumeStripes(m_accumulators, m_stripesInBlock, data, stripeCount, m_secret);
+                data += stripeCount * Xxh3::kStripeSize;
+                _size -= stripeCount * Xxh3::kStripeSize;
+                memcpy(m_buffer + kBufferSize - Xxh3::kStripeSize, data - Xxh3::kStripeSize, Xxh3::kStripeSize);
+            }
+
+            memcpy(m_buffer, data, _size);
+            m_bufferedSize = static_cast<u32>(_size);
+        }
+
+        u64 FastHasher::Digest() const
+        {
+            // The whole input is still in the buffer.
+            if (!m_consumingStripes)
+            {
+                return Xxh3::Xxh3Hash64(reinterpret_cast<const char*>(m_buffer), m_totalSize, m_seed);
+            }
+
+            alignas(64) u64 accumulators[Xxh3::kAccumulatorCount];
+            memcpy(accumulators, m_accumulators, sizeof(accumulators));
+            u32 stripesInBlock = m_stripesInBlock;
+
+            alignas(64) char lastStripe[Xxh3::kStripeSize];
+            if (m_bufferedSize >= Xxh3::kStripeSize)
+            {
+                const size_t stripeCount = (m_bufferedSize - 1) / Xxh3::kStripeSize;
+                _ConsumeStripes(
+                    accumulators,
+                    stripesInBlock,
+                    reinterpret_cast<const char*>(m_buffer),
+                    stripeCount,
+                    m_secret);
+                memcpy(lastStripe, m_buffer + m_bufferedSize - Xxh3::kStripeSize, Xxh3::kStripeSize);
+            }
+            else
+            {
+                // Complete the final stripe with the end of the previously consumed one.
+                const size_t catchUpSize = Xxh3::kStripeSize - m_bufferedSize;
+                memcpy(lastStripe, m_buffer + kBufferSize - catchUpSize, catchUpSize);
+                memcpy(lastStripe + catchUpSize, m_buffer, m_bufferedSize);
+            }
+
+            Xxh3::AccumulateStripes(
+                accumulators,
+                lastStripe,
+                m_secret + Xxh3::kSecretSize - Xxh3::kStripeSize - 7,
+                1);
+            return Xxh3::MergeAccumulators(accumulators, m_secret + 11, m_totalSize * Xxh3::kPrime64_1);
+        }
+
+        void FastHasher::_StartConsumingStripes()
+        {
+            Xxh3::InitAccumulators(m_accumulators);
+            Xxh3::InitSecret(m_secret, m_seed);
+            m_consumingStripes = true;
+        }
+
+        void FastHasher::_ConsumeStripes(
+            u64* _accumulators,
+            u32& _stripesInBlock,
+            const char* _stripes,
+            size_t _stripeCount,
+            const u8* _secret)
+        {
+            while (_stripeCount > 0)
+            {
+                const size_t count = eastl::min<size_t>(_stripeCount, Xxh3::kStripesPerBlock - _stripesInBlock);
+                Xxh3::AccumulateStripes(
+                    _accumulators,
+                    _stripes,
+                    _secret + _stripesInBlock * Xxh3::kSecretConsumeRate,
+                    count);
+                _stripes += count * Xxh3::kStripeSize;
+                _stripeCount -= count;
+                _stripesInBlock += static_cast<u32>(count);
+
+                if (_stripesInBlock == Xxh3::kStripesPerBlock)
+                {
+                    Xxh3::Scramble(_accumulators, _secret + Xxh3::kSecretSize - Xxh3::kStripeSize);
+                    _stripesInBlock = 0;
+                }
+            }
+        }
+    }
+}
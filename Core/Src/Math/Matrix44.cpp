@@ -110,8 +110,8 @@ namespace KryneEngine::Math
         else
         {
             using Vector4 = Vector4Base<T, SimdOptimal>;
-            const Vector4& vas = m_vectors;
-            const Vector4& vbs = _other.m_vectors;
+            const Vector4 (&vas)[4] = m_vectors;
+            const Vector4 (&vbs)[4] = _other.m_vectors;
             return {
                 Vector4 {
                     vas[0].x * vbs[0].x + vas[0].y * vbs[1].x + vas[0].z * vbs[2].x + vas[0].w * vbs[3].x,
@@ -0,0 +1,221 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Math/SimdDispatch.hpp"
+
+#include <atomic>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "Math/SimdKernels/SimdKernels.hpp"
+
+#if defined(KE_SIMD_DISPATCH_SSE4_2) || defined(KE_SIMD_DISPATCH_AVX2) || defined(KE_SIMD_DISPATCH_AVX512)
+#   define KE_SIMD_DISPATCH_X86
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace KryneEngine::Math
+{
+    namespace
+    {
+        // Starts on the baseline kernels, which are always safe, so kernels called from other static initializers work
+        // before the best target is selected.
+        constinit std::atomic<const SimdKernels::KernelTable*> g_activeKernels { &SimdKernels::kBaselineKernels };
+        constinit std::atomic<SimdTarget> g_activeTarget { SimdTarget::Baseline };
+
+        const SimdKernels::KernelTable* GetKernelTable(SimdTarget _target)
+        {
+            switch (_target)
+            {
+            case SimdTarget::Baseline:
+                return &SimdKernels::kBaselineKernels;
+            case SimdTarget::Sse4_2:
+#if defined(KE_SIMD_DISPATCH_SSE4_2)
+                return &SimdKernels::kSse4_2Kernels;
+#else
+                return nullptr;
+#endif
+            case SimdTarget::Avx2:
+#if defined(KE_SIMD_DISPATCH_AVX2)
+                return &SimdKernels::kAvx2Kernels;
+#else
+                return nullptr;
+#endif
+            case SimdTarget::Avx512:
+#if defined(KE_SIMD_DISPATCH_AVX512)
+                return &SimdKernels::kAvx512Kernels;
+#else
+                return nullptr;
+#endif
+            case SimdTarget::Count:
+                return nullptr;
+            }
+            return nullptr;
+        }
+
+#if defined(KE_SIMD_DISPATCH_X86)
+        void CpuId(u32 _leaf, u32 _subLeaf, u32 (&_registers)[4])
+        {
+#   if defined(_MSC_VER)
+            int registers[4];
+            __cpuidex(registers, static_cast<int>(_leaf), static_cast<int>(_subLeaf));
+            for (u32 i = 0; i < 4; i++)
+            {
+                _registers[i] = static_cast<u32>(registers[i]);
+            }
+#   else
+            __cpuid_count(_leaf, _subLeaf, _registers[0], _registers[1], _registers[2], _registers[3]);
+#   endif
+        }
+
+        u64 ReadXcr0()
+        {
+#   if defined(_MSC_VER)
+            return _xgetbv(0);
+#   else
+            // Inline assembly rather than `_xgetbv`, which requires XSAVE to be enabled for the whole file.
+            u32 eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return static_cast<u64>(eax) | (static_cast<u64>(edx) << 32);
+#   endif
+        }
+
+        bool IsSupportedByCpu(SimdTarget _target)
+        {
+            struct CpuFeatures
+            {
+                bool m_sse4_2 = false;
+                bool m_avx2 = false;
+                bool m_avx512 = false;
+            };
+
+            static const CpuFeatures features = []()
+            {
+                u32 registers[4];
+                CpuId(0, 0, registers);
+                const u32 maxLeaf = registers[0];
+
+                CpuId(1, 0, registers);
+                const u32 features1 = registers[2];
+                u32 features7 = 0;
+                if (maxLeaf >= 7)
+                {
+                    CpuId(7, 0, registers);
+                    features7 = registers[1];
+                }
+
+                const bool osXsave = features1 & (1u << 27);
+                const bool f16c = features1 & (1u << 29);
+
+                // The OS must also save the wider registers on context switches: XMM and YMM for AVX, plus the opmask
+                // and all ZMM registers for AVX-512.
+                const u64 xcr0 = osXsave ? ReadXcr0() : 0;
+                const bool osAvx = (xcr0 & 0x06) == 0x06;
+                const bool osAvx512 = (xcr0 & 0xe6) == 0xe6;
+
+                CpuFeatures result;
+                result.m_sse4_2 = features1 & (1u << 20);
+                result.m_avx2 = osAvx && f16c && (features7 & (1u << 5));
+                result.m_avx512 = osAvx512 && result.m_avx2 && (features7 & (1u << 16));
+                return result;
+            }();
+
+            switch (_target)
+            {
+            case SimdTarget::Baseline:
+                return true;
+            case SimdTarget::Sse4_2:
+                return features.m_sse4_2;
+            case SimdTarget::Avx2:
+                return features.m_avx2;
+            case SimdTarget::Avx512:
+                return features.m_avx512;
+            case SimdTarget::Count:
+                return false;
+            }
+            return false;
+        }
+#else
+        bool IsSupportedByCpu(SimdTarget _target)
+        {
+            return _target == SimdTarget::Baseline;
+        }
+#endif
+
+        // Selects the best target once, during static initialization.
+        const bool g_bestTargetSelected = []()
+        {
+            SimdDispatch::SetActiveTarget(SimdDispatch::GetBestTarget());
+            return true;
+        }();
+    }
+
+    namespace SimdDispatch
+    {
+        bool IsTargetSupported(SimdTarget _target)
+        {
+            return GetKernelTable(_target) != nullptr && IsSupportedByCpu(_target);
+        }
+
+        SimdTarget GetBestTarget()
+        {
+            static const SimdTarget bestTarget = []()
+            {
+                for (u8 i = static_cast<u8>(SimdTarget::Count); i-- > 0;)
+                {
+                    const auto target = static_cast<SimdTarget>(i);
+                    if (IsTargetSupported(target))
+                    {
+                        return target;
+                    }
+                }
+                return SimdTarget::Baseline;
+            }();
+            return bestTarget;
+        }
+
+        SimdTarget GetActiveTarget()
+        {
+            return g_activeTarget.load(std::memory_order_relaxed);
+        }
+
+        void SetActiveTarget(SimdTarget _target)
+        {
+            IF_NOT_VERIFY_MSG(IsTargetSupported(_target), "SIMD target %s is not supported", GetTargetName(_target))
+            {
+                return;
+            }
+            g_activeKernels.store(GetKernelTable(_target), std::memory_order_relaxed);
+            g_activeTarget.store(_target, std::memory_order_relaxed);
+        }
+
+        const char* GetTargetName(SimdTarget _target)
+        {
+            switch (_target)
+            {
+            case SimdTarget::Baseline:
+                return "Baseline";
+            case SimdTarget::Sse4_2:
+                return "SSE4.2";
+            case SimdTarget::Avx2:
+                return "AVX2";
+            case SimdTarget::Avx512:
+                return "AVX-512";
+            case SimdTarget::Count:
+                break;
+            }
+            return "Unknown";
+        }
+    }
+
+    const SimdKernels::KernelTable& SimdKernels::GetActiveKernels()
+    {
+        return *g_activeKernels.load(std::memory_order_relaxed);
+    }
+}
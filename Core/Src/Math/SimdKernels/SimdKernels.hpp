@@ -0,0 +1,87 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+// Only plain types here: this header is included by the translation units compiled for each SIMD target, which must
+// not instantiate any engine inline function with their own instruction set.
+#include "KryneEngine/Core/Common/Types.hpp"
+#include "KryneEngine/Core/Math/SoaTypes.hpp"
+
+namespace KryneEngine::Math::SimdKernels
+{
+    /// @brief Same as `Frustum::Count`, checked in `Frustum.cpp`.
+    constexpr size_t kPlaneCount = 6;
+
+    /// @brief XXH3 constants used by the kernels, checked against the ones in `Hashing.hpp` in `Hashing.cpp`.
+    constexpr size_t kXxh3StripeSize = 64;
+    constexpr size_t kXxh3SecretConsumeRate = 8;
+    constexpr u32 kXxh3Prime32_1 = 0x9E37'79B1u;
+
+    struct PlaneCoefficients
+    {
+        float m_x, m_y, m_z, m_distance;
+        float m_absX, m_absY, m_absZ;
+    };
+
+    /**
+     * @brief Entry points of the hot math kernels, for one instruction set.
+     * @details `SimdKernels.inl` is compiled once per target, each translation unit with its own compiler flags, and
+     * exposes its instantiation as one of the tables below. All tables give bit-identical results.
+     */
+    struct KernelTable
+    {
+        void (*m_transformVectors)(
+            const float (&_matrix)[3][4],
+            Vector3Soa<const float> _input,
+            Vector3Soa<float> _output,
+            size_t _count);
+        void (*m_computeTransformMatrices)(
+            Vector3Soa<const float> _positions,
+            QuaternionSoa<const float> _rotations,
+            Vector3Soa<const float> _scales,
+            Matrix44Soa<float> _output,
+            size_t _count);
+        void (*m_multiplyMatrices)(
+            Matrix44Soa<const float> _lhs,
+            Matrix44Soa<const float> _rhs,
+            Matrix44Soa<float> _output,
+            size_t _count);
+
+        void (*m_cullBoundingBoxes)(
+            const PlaneCoefficients (&_planes)[kPlaneCount],
+            Vector3Soa<const float> _mins,
+            Vector3Soa<const float> _maxs,
+            size_t _count,
+            u64* _visibilityMask);
+        void (*m_cullBoundingSpheres)(
+            const PlaneCoefficients (&_planes)[kPlaneCount],
+            Vector3Soa<const float> _centers,
+            const float* _radii,
+            size_t _count,
+            u64* _visibilityMask);
+
+        void (*m_convertToFloat16)(const float* _input, u16* _output, size_t _count);
+        void (*m_convertFromFloat16)(const u16* _input, float* _output, size_t _count);
+
+        void (*m_xxh3AccumulateStripes)(u64* _accumulators, const char* _stripes, const u8* _secret, size_t _stripeCount);
+        void (*m_xxh3Scramble)(u64* _accumulators, const u8* _secret);
+    };
+
+    extern const KernelTable kBaselineKernels;
+#if defined(KE_SIMD_DISPATCH_SSE4_2)
+    extern const KernelTable kSse4_2Kernels;
+#endif
+#if defined(KE_SIMD_DISPATCH_AVX2)
+    extern const KernelTable kAvx2Kernels;
+#endif
+#if defined(KE_SIMD_DISPATCH_AVX512)
+    extern const KernelTable kAvx512Kernels;
+#endif
+
+    /// @brief Returns the table of the target selected by `SimdDispatch`.
+    const KernelTable& GetActiveKernels();
+}
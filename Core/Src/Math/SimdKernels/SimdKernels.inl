@@ -0,0 +1,627 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include <xsimd/xsimd.hpp>
+
+// No engine math header: they are compiled with the engine flags elsewhere, so their inline functions must not be
+// instantiated here with the instruction set of the current target. The kernels only rely on plain SoA structures.
+#include "Math/SimdKernels/SimdKernels.hpp"
+
+// This file is compiled once per dispatch target, so these only reflect the flags of the current translation unit.
+#if defined(__AVX512F__)
+#   include <immintrin.h>
+#   define KE_XXH3_AVX512
+#elif defined(__AVX2__)
+#   include <immintrin.h>
+#   define KE_XXH3_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+#   include <emmintrin.h>
+#   define KE_XXH3_SSE2
+#elif defined(__ARM_NEON)
+#   include <arm_neon.h>
+#   define KE_XXH3_NEON
+#endif
+
+#if defined(__ARM_NEON) && defined(__ARM_FP16_FORMAT_IEEE)
+#   include <arm_neon.h>
+#   define KE_F16_NEON
+#elif defined(__AVX512F__)
+#   define KE_F16_AVX512
+#elif defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   include <immintrin.h>
+#   define KE_F16_F16C
+#endif
+
+namespace KryneEngine::Math::SimdKernels
+{
+    // Everything has internal linkage: the same inline code compiled with different instruction sets must never be
+    // merged by the linker.
+    namespace
+    {
+        template <class V>
+        V Load(const float* _ptr)
+        {
+            if constexpr (std::is_same_v<V, float>)
+            {
+                return *_ptr;
+            }
+            else
+            {
+                return V::load_unaligned(_ptr);
+            }
+        }
+
+        inline void Store(float* _ptr, float _value)
+        {
+            *_ptr = _value;
+        }
+
+        template <class Arch>
+        void Store(float* _ptr, const xsimd::batch<float, Arch>& _value)
+        {
+            _value.store_unaligned(_ptr);
+        }
+
+        /**
+         * @brief Runs `_kernel` on full batches, then on the remaining values one at a time.
+         * @details The kernel is written once, as a generic lambda called with either `Batch` or `float` as value type.
+         */
+        template <class Batch, class Kernel>
+        void ForEachBatch(size_t _count, Kernel&& _kernel)
+        {
+            size_t i = 0;
+            for (; i + Batch::size <= _count; i += Batch::size)
+            {
+                _kernel(i, std::type_identity<Batch>{});
+            }
+            for (; i < _count; i++)
+            {
+                _kernel(i, std::type_identity<float>{});
+            }
+        }
+
+        /**
+         * @brief Runs `_convert` on blocks of `BlockSize` values, the last partial block going through a zero padded
+         * copy.
+         * @details This way every value goes through the same vector code, without any scalar fallback.
+         */
+        template <size_t BlockSize, class In, class Out, class Convert>
+        void ConvertBlocks(const In* _input, Out* _output, size_t _count, Convert&& _convert)
+        {
+            size_t i = 0;
+            for (; i + BlockSize <= _count; i += BlockSize)
+            {
+                _convert(_input + i, _output + i);
+            }
+            if (i < _count)
+            {
+                In input[BlockSize] {};
+                Out output[BlockSize];
+                memcpy(input, _input + i, (_count - i) * sizeof(In));
+                _convert(input, output);
+                memcpy(_output + i, output, (_count - i) * sizeof(Out));
+            }
+        }
+
+        // Returns whether the box, given as center and half extent, is not fully behind any plane.
+        template <class V>
+        auto TestBox(
+            const PlaneCoefficients (&_planes)[kPlaneCount],
+            const V& _cx, const V& _cy, const V& _cz,
+            const V& _ex, const V& _ey, const V& _ez)
+        {
+            const auto testPlane = [&](const PlaneCoefficients& _plane)
+            {
+                const V distance = V(_plane.m_x) * _cx + V(_plane.m_y) * _cy + V(_plane.m_z) * _cz + V(_plane.m_distance);
+                const V radius = V(_plane.m_absX) * _ex + V(_plane.m_absY) * _ey + V(_plane.m_absZ) * _ez;
+                return distance + radius >= V(0.f);
+            };
+
+            auto visible = testPlane(_planes[0]);
+            for (size_t i = 1; i < kPlaneCount; i++)
+            {
+                visible = visible & testPlane(_planes[i]);
+            }
+            return visible;
+        }
+
+        template <class V>
+        auto TestSphere(
+            const PlaneCoefficients (&_planes)[kPlaneCount],
+            const V& _cx, const V& _cy, const V& _cz,
+            const V& _radius)
+        {
+            const auto testPlane = [&](const PlaneCoefficients& _plane)
+            {
+                const V distance = V(_plane.m_x) * _cx + V(_plane.m_y) * _cy + V(_plane.m_z) * _cz + V(_plane.m_distance);
+                return distance + _radius >= V(0.f);
+            };
+
+            auto visible = testPlane(_planes[0]);
+            for (size_t i = 1; i < kPlaneCount; i++)
+            {
+                visible = visible & testPlane(_planes[i]);
+            }
+            return visible;
+        }
+
+        template <class Arch>
+        struct Kernels
+        {
+            using Batch = xsimd::batch<float, Arch>;
+            using IntBatch = xsimd::batch<s32, Arch>;
+
+            static_assert(64 % Batch::size == 0, "Batches are expected to never straddle two mask words");
+
+            static void TransformVectors(
+                const float (&_matrix)[3][4],
+                Vector3Soa<const float> _input,
+                Vector3Soa<float> _output,
+                size_t _count)
+            {
+                const auto& m = _matrix;
+                ForEachBatch<Batch>(_count, [&]<class V>(size_t _i, std::type_identity<V>)
+                {
+                    const V x = Load<V>(_input.x + _i);
+                    const V y = Load<V>(_input.y + _i);
+                    const V z = Load<V>(_input.z + _i);
+
+                    Store(_output.x + _i, V(m[0][0]) * x + V(m[0][1]) * y + V(m[0][2]) * z + V(m[0][3]));
+                    Store(_output.y + _i, V(m[1][0]) * x + V(m[1][1]) * y + V(m[1][2]) * z + V(m[1][3]));
+                    Store(_output.z + _i, V(m[2][0]) * x + V(m[2][1]) * y + V(m[2][2]) * z + V(m[2][3]));
+                });
+            }
+
+            static void ComputeTransformMatrices(
+                Vector3Soa<const float> _positions,
+                QuaternionSoa<const float> _rotations,
+                Vector3Soa<const float> _scales,
+                Matrix44Soa<float> _output,
+                size_t _count)
+            {
+                float* const* output = _output.m_elements;
+                ForEachBatch<Batch>(_count, [&]<class V>(size_t _i, std::type_identity<V>)
+                {
+                    const V w = Load<V>(_rotations.w + _i);
+                    const V x = Load<V>(_rotations.x + _i);
+                    const V y = Load<V>(_rotations.y + _i);
+                    const V z = Load<V>(_rotations.z + _i);
+                    const V sx = Load<V>(_scales.x + _i);
+                    const V sy = Load<V>(_scales.y + _i);
+                    const V sz = Load<V>(_scales.z + _i);
+                    const V px = Load<V>(_positions.x + _i);
+                    const V py = Load<V>(_positions.y + _i);
+                    const V pz = Load<V>(_positions.z + _i);
+
+                    // Same rotation matrix as `ToMatrix33`
+                    const V one(1.f);
+                    const V two(2.f);
+                    const V xx = x * x, yy = y * y, zz = z * z;
+                    const V xy = x * y, xz = x * z, yz = y * z;
+                    const V xw = x * w, yw = y * w, zw = z * w;
+
+                    Store(output[0] + _i, (one - two * (yy + zz)) * sx);
+                    Store(output[1] + _i, two * (xy - zw) * sy);
+                    Store(output[2] + _i, two * (xz + yw) * sz);
+                    Store(output[3] + _i, px);
+
+                    Store(output[4] + _i, two * (xy + zw) * sx);
+                    Store(output[5] + _i, (one - two * (xx + zz)) * sy);
+                    Store(output[6] + _i, two * (yz - xw) * sz);
+                    Store(output[7] + _i, py);
+
+                    Store(output[8] + _i, two * (xz - yw) * sx);
+                    Store(output[9] + _i, two * (yz + xw) * sy);
+                    Store(output[10] + _i, (one - two * (xx + yy)) * sz);
+                    Store(output[11] + _i, pz);
+
+                    const V zero(0.f);
+                    Store(output[12] + _i, zero);
+                    Store(output[13] + _i, zero);
+                    Store(output[14] + _i, zero);
+                    Store(output[15] + _i, one);
+                });
+            }
+
+            static void MultiplyMatrices(
+                Matrix44Soa<const float> _lhs,
+                Matrix44Soa<const float> _rhs,
+                Matrix44Soa<float> _output,
+                size_t _count)
+            {
+                ForEachBatch<Batch>(_count, [&]<class V>(size_t _i, std::type_identity<V>)
+                {
+                    // Everything is loaded before the first store, so the output can alias either input.
+                    V a[16];
+                    V b[16];
+                    for (size_t e = 0; e < 16; e++)
+                    {
+                        a[e] = Load<V>(_lhs.m_elements[e] + _i);
+                        b[e] = Load<V>(_rhs.m_elements[e] + _i);
+                    }
+
+                    for (size_t row = 0; row < 4; row++)
+                    {
+                        for (size_t col = 0; col < 4; col++)
+                        {
+                            const V value = a[row * 4 + 0] * b[0 * 4 + col]
+                                + a[row * 4 + 1] * b[1 * 4 + col]
+                                + a[row * 4 + 2] * b[2 * 4 + col]
+                                + a[row * 4 + 3] * b[3 * 4 + col];
+                            Store(_output.m_elements[row * 4 + col] + _i, value);
+                        }
+                    }
+                });
+            }
+
+            /**
+             * @brief Runs `_test` on full batches then on the remaining objects, and packs its results in the mask.
+             * @details `_test` is a generic lambda called with either `Batch` or `float` as value type.
+             */
+            template <class Test>
+            static void BuildVisibilityMask(size_t _count, u64* _visibilityMask, Test&& _test)
+            {
+                for (size_t word = 0; word < (_count + 63) / 64; word++)
+                {
+                    _visibilityMask[word] = 0;
+                }
+
+                size_t i = 0;
+                for (; i + Batch::size <= _count; i += Batch::size)
+                {
+                    const u64 mask = _test(i, std::type_identity<Batch>{}).mask();
+                    _visibilityMask[i / 64] |= mask << (i % 64);
+                }
+                for (; i < _count; i++)
+                {
+                    const u64 visible = _test(i, std::type_identity<float>{}) ? 1 : 0;
+                    _visibilityMask[i / 64] |= visible << (i % 64);
+                }
+            }
+
+            static void CullBoundingBoxes(
+                const PlaneCoefficients (&_planes)[kPlaneCount],
+                Vector3Soa<const float> _mins,
+                Vector3Soa<const float> _maxs,
+                size_t _count,
+                u64* _visibilityMask)
+            {
+                BuildVisibilityMask(_count, _visibilityMask, [&]<class V>(size_t _i, std::type_identity<V>)
+                {
+                    const V minX = Load<V>(_mins.x + _i);
+                    const V minY = Load<V>(_mins.y + _i);
+                    const V minZ = Load<V>(_mins.z + _i);
+                    const V maxX = Load<V>(_maxs.x + _i);
+                    const V maxY = Load<V>(_maxs.y + _i);
+                    const V maxZ = Load<V>(_maxs.z + _i);
+
+                    const V half(0.5f);
+                    return TestBox<V>(
+                        _planes,
+                        (minX + maxX) * half, (minY + maxY) * half, (minZ + maxZ) * half,
+                        (maxX - minX) * half, (maxY - minY) * half, (maxZ - minZ) * half);
+                });
+            }
+
+            static void CullBoundingSpheres(
+                const PlaneCoefficients (&_planes)[kPlaneCount],
+                Vector3Soa<const float> _centers,
+                const float* _radii,
+                size_t _count,
+                u64* _visibilityMask)
+            {
+                BuildVisibilityMask(_count, _visibilityMask, [&]<class V>(size_t _i, std::type_identity<V>)
+                {
+                    return TestSphere<V>(
+                        _planes,
+                        Load<V>(_centers.x + _i),
+                        Load<V>(_centers.y + _i),
+                        Load<V>(_centers.z + _i),
+                        Load<V>(_radii + _i));
+                });
+            }
+
+            static void ConvertToFloat16(const float* _input, u16* _output, size_t _count)
+            {
+#if defined(KE_F16_NEON)
+                ConvertBlocks<4>(_input, _output, _count, [](const float* _in, u16* _out)
+                {
+                    const float16x4_t result = vcvt_f16_f32(vld1q_f32(_in));
+                    vst1_u16(_out, vreinterpret_u16_f16(result));
+                });
+#else
+                // F16C and AVX-512 FP16 conversions round the values and saturate overflows, while the scalar path
+                // truncates them and has its own NaN and underflow results. Instead, the scalar bit manipulation is
+                // done branchless, on integer batches.
+                ConvertBlocks<IntBatch::size>(_input, _output, _count, [](const float* _in, u16* _out)
+                {
+                    const Batch value = Batch::load_unaligned(_in);
+                    const IntBatch binaryFloat = xsimd::bitwise_cast<s32>(value);
+
+                    const IntBatch sign = (binaryFloat >> 16) & IntBatch(0x8000);
+                    const IntBatch exponent = (binaryFloat >> 23) & IntBatch(0xff);
+                    const IntBatch mantissa = binaryFloat & IntBatch(0x7fffff);
+                    const IntBatch exponent16 = exponent - IntBatch(127 - 15);
+
+                    IntBatch result = sign | (exponent16 << 10) | (mantissa >> 13);
+
+                    // Subnormal values are the input in units of 2^-24, truncated, which matches the scalar mantissa
+                    // shifts.
+                    const IntBatch subnormal = sign | xsimd::batch_cast<s32>(xsimd::abs(value) * Batch(16777216.f));
+                    result = xsimd::select(exponent16 <= IntBatch(0), subnormal, result);
+                    result = xsimd::select(exponent16 < IntBatch(-10), IntBatch(0), result);
+
+                    const IntBatch infinity = sign | IntBatch(0x1f << 10);
+                    result = xsimd::select(exponent16 >= IntBatch(31), infinity, result);
+                    result = xsimd::select(
+                        exponent == IntBatch(0xff),
+                        xsimd::select(mantissa == IntBatch(0), infinity, infinity | IntBatch(0x3ff)),
+                        result);
+                    result = xsimd::select(exponent == IntBatch(0), sign, result);
+
+                    alignas(Arch::alignment()) s32 narrowed[IntBatch::size];
+                    result.store_aligned(narrowed);
+                    for (size_t j = 0; j < IntBatch::size; j++)
+                    {
+                        _out[j] = static_cast<u16>(narrowed[j]);
+                    }
+                });
+#endif
+            }
+
+            static void ConvertFromFloat16(const u16* _input, float* _output, size_t _count)
+            {
+#if defined(KE_F16_NEON)
+                ConvertBlocks<4>(_input, _output, _count, [](const u16* _in, float* _out)
+                {
+                    vst1q_f32(_out, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(_in))));
+                });
+#elif defined(KE_F16_AVX512)
+                // Widening is exact, and NaNs are quieted with their payload kept, like in the scalar path.
+                ConvertBlocks<16>(_input, _output, _count, [](const u16* _in, float* _out)
+                {
+                    const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_in));
+                    _mm512_storeu_ps(_out, _mm512_cvtph_ps(value));
+                });
+#elif defined(KE_F16_F16C)
+                ConvertBlocks<8>(_input, _output, _count, [](const u16* _in, float* _out)
+                {
+                    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_in));
+                    _mm256_storeu_ps(_out, _mm256_cvtph_ps(value));
+                });
+#else
+                ConvertBlocks<IntBatch::size>(_input, _output, _count, [](const u16* _in, float* _out)
+                {
+                    alignas(Arch::alignment()) s32 widened[IntBatch::size];
+                    for (size_t j = 0; j < IntBatch::size; j++)
+                    {
+                        widened[j] = _in[j];
+                    }
+                    const IntBatch value = IntBatch::load_aligned(widened);
+
+                    const IntBatch sign = (value & IntBatch(0x8000)) << 16;
+                    const IntBatch exponent = (value >> 10) & IntBatch(0x1f);
+                    const IntBatch mantissa = value & IntBatch(0x3ff);
+
+                    const IntBatch normal = sign | ((exponent + IntBatch(127 - 15)) << 23) | (mantissa << 13);
+
+                    // Subnormal values are exactly their mantissa in units of 2^-24, zeros included.
+                    const Batch subnormalValue = xsimd::batch_cast<float>(mantissa) * Batch(1.f / 16777216.f);
+                    const IntBatch subnormal = sign | xsimd::bitwise_cast<s32>(subnormalValue);
+
+                    const IntBatch infinity = sign | IntBatch(0xff << 23);
+                    const IntBatch infinityOrNan = xsimd::select(
+                        mantissa == IntBatch(0),
+                        infinity,
+                        infinity | (mantissa << 13) | IntBatch(0x400000));
+
+                    IntBatch result = xsimd::select(exponent == IntBatch(0x1f), infinityOrNan, normal);
+                    result = xsimd::select(exponent == IntBatch(0), subnormal, result);
+
+                    xsimd::bitwise_cast<float>(result).store_unaligned(_out);
+                });
+#endif
+            }
+
+            static void Xxh3AccumulateStripes(u64* _accumulators, const char* _stripes, const u8* _secret, size_t _stripeCount)
+            {
+#if defined(KE_XXH3_AVX512)
+                __m512i acc = _mm512_load_si512(_accumulators);
+                for (size_t i = 0; i < _stripeCount; i++)
+                {
+                    const __m512i data = _mm512_loadu_si512(_stripes + i * kXxh3StripeSize);
+                    const __m512i key = _mm512_xor_si512(data, _mm512_loadu_si512(_secret + i * kXxh3SecretConsumeRate));
+
+                    // 32x32 -> 64 bits multiplication of the low and high halves of each lane
+                    const __m512i product = _mm512_mul_epu32(key, _mm512_srli_epi64(key, 32));
+
+                    // acc[i ^ 1] += data[i]
+                    const __m512i swapped = _mm512_shuffle_epi32(data, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2)));
+                    acc = _mm512_add_epi64(acc, _mm512_add_epi64(product, swapped));
+                }
+                _mm512_store_si512(_accumulators, acc);
+#elif defined(KE_XXH3_AVX2)
+                auto* accumulators = reinterpret_cast<__m256i*>(_accumulators);
+                __m256i acc0 = _mm256_load_si256(accumulators + 0);
+                __m256i acc1 = _mm256_load_si256(accumulators + 1);
+
+                const auto accumulate = [](__m256i _acc, const char* _data, const u8* _key)
+                {
+                    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data));
+                    const __m256i key = _mm256_xor_si256(data, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_key)));
+
+                    // 32x32 -> 64 bits multiplication of the low and high halves of each lane
+                    const __m256i product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+
+                    // acc[i ^ 1] += data[i]
+                    const __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    return _mm256_add_epi64(_acc, _mm256_add_epi64(product, swapped));
+                };
+
+                for (size_t i = 0; i < _stripeCount; i++)
+                {
+                    const char* stripe = _stripes + i * kXxh3StripeSize;
+                    const u8* secret = _secret + i * kXxh3SecretConsumeRate;
+                    acc0 = accumulate(acc0, stripe, secret);
+                    acc1 = accumulate(acc1, stripe + 32, secret + 32);
+                }
+
+                _mm256_store_si256(accumulators + 0, acc0);
+                _mm256_store_si256(accumulators + 1, acc1);
+#elif defined(KE_XXH3_SSE2)
+                auto* accumulators = reinterpret_cast<__m128i*>(_accumulators);
+                __m128i acc[4];
+                for (u32 j = 0; j < 4; j++)
+                {
+                    acc[j] = _mm_load_si128(accumulators + j);
+                }
+
+                for (size_t i = 0; i < _stripeCount; i++)
+                {
+                    const auto* stripe = reinterpret_cast<const __m128i*>(_stripes + i * kXxh3StripeSize);
+                    const auto* secret = reinterpret_cast<const __m128i*>(_secret + i * kXxh3SecretConsumeRate);
+                    for (u32 j = 0; j < 4; j++)
+                    {
+                        const __m128i data = _mm_loadu_si128(stripe + j);
+                        const __m128i key = _mm_xor_si128(data, _mm_loadu_si128(secret + j));
+                        const __m128i product = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+                        const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                        acc[j] = _mm_add_epi64(acc[j], _mm_add_epi64(product, swapped));
+                    }
+                }
+
+                for (u32 j = 0; j < 4; j++)
+                {
+                    _mm_store_si128(accumulators + j, acc[j]);
+                }
+#elif defined(KE_XXH3_NEON)
+                uint64x2_t acc[4];
+                for (u32 j = 0; j < 4; j++)
+                {
+                    acc[j] = vld1q_u64(_accumulators + 2 * j);
+                }
+
+                for (size_t i = 0; i < _stripeCount; i++)
+                {
+                    const auto* stripe = reinterpret_cast<const u8*>(_stripes + i * kXxh3StripeSize);
+                    const u8* secret = _secret + i * kXxh3SecretConsumeRate;
+                    for (u32 j = 0; j < 4; j++)
+                    {
+                        const uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(stripe + 16 * j));
+                        const uint64x2_t key = veorq_u64(data, vreinterpretq_u64_u8(vld1q_u8(secret + 16 * j)));
+                        const uint64x2_t product = vmull_u32(vmovn_u64(key), vshrn_n_u64(key, 32));
+                        const uint64x2_t swapped = vextq_u64(data, data, 1);
+                        acc[j] = vaddq_u64(acc[j], vaddq_u64(product, swapped));
+                    }
+                }
+
+                for (u32 j = 0; j < 4; j++)
+                {
+                    vst1q_u64(_accumulators + 2 * j, acc[j]);
+                }
+#else
+                for (size_t i = 0; i < _stripeCount; i++)
+                {
+                    const char* stripe = _stripes + i * kXxh3StripeSize;
+                    const u8* secret = _secret + i * kXxh3SecretConsumeRate;
+                    for (size_t j = 0; j < 8; j++)
+                    {
+                        u64 data;
+                        u64 key;
+                        memcpy(&data, stripe + 8 * j, sizeof(data));
+                        memcpy(&key, secret + 8 * j, sizeof(key));
+                        key ^= data;
+                        _accumulators[j ^ 1] += data;
+                        _accumulators[j] += (key & 0xffff'ffff) * (key >> 32);
+                    }
+                }
+#endif
+            }
+
+            static void Xxh3Scramble(u64* _accumulators, const u8* _secret)
+            {
+#if defined(KE_XXH3_AVX512)
+                const __m512i prime = _mm512_set1_epi32(static_cast<s32>(kXxh3Prime32_1));
+                __m512i acc = _mm512_load_si512(_accumulators);
+                acc = _mm512_xor_si512(acc, _mm512_srli_epi64(acc, 47));
+                acc = _mm512_xor_si512(acc, _mm512_loadu_si512(_secret));
+
+                // 64x32 bits multiplication, from two 32x32 -> 64 ones
+                const __m512i low = _mm512_mul_epu32(acc, prime);
+                const __m512i high = _mm512_mul_epu32(_mm512_srli_epi64(acc, 32), prime);
+                _mm512_store_si512(_accumulators, _mm512_add_epi64(low, _mm512_slli_epi64(high, 32)));
+#elif defined(KE_XXH3_AVX2)
+                auto* accumulators = reinterpret_cast<__m256i*>(_accumulators);
+                const __m256i prime = _mm256_set1_epi32(static_cast<s32>(kXxh3Prime32_1));
+                for (u32 j = 0; j < 2; j++)
+                {
+                    __m256i acc = _mm256_load_si256(accumulators + j);
+                    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+                    acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_secret + 32 * j)));
+
+                    // 64x32 bits multiplication, from two 32x32 -> 64 ones
+                    const __m256i low = _mm256_mul_epu32(acc, prime);
+                    const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+                    _mm256_store_si256(accumulators + j, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+                }
+#elif defined(KE_XXH3_SSE2)
+                auto* accumulators = reinterpret_cast<__m128i*>(_accumulators);
+                const __m128i prime = _mm_set1_epi32(static_cast<s32>(kXxh3Prime32_1));
+                for (u32 j = 0; j < 4; j++)
+                {
+                    __m128i acc = _mm_load_si128(accumulators + j);
+                    acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+                    acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(_secret + 16 * j)));
+
+                    const __m128i low = _mm_mul_epu32(acc, prime);
+                    const __m128i high = _mm_mul_epu32(_mm_srli_epi64(acc, 32), prime);
+                    _mm_store_si128(accumulators + j, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+                }
+#elif defined(KE_XXH3_NEON)
+                for (u32 j = 0; j < 4; j++)
+                {
+                    uint64x2_t acc = vld1q_u64(_accumulators + 2 * j);
+                    acc = veorq_u64(acc, vshrq_n_u64(acc, 47));
+                    acc = veorq_u64(acc, vreinterpretq_u64_u8(vld1q_u8(_secret + 16 * j)));
+
+                    const uint64x2_t high = vshlq_n_u64(vmull_n_u32(vshrn_n_u64(acc, 32), kXxh3Prime32_1), 32);
+                    vst1q_u64(_accumulators + 2 * j, vmlal_n_u32(high, vmovn_u64(acc), kXxh3Prime32_1));
+                }
+#else
+                for (size_t j = 0; j < 8; j++)
+                {
+                    u64 key;
+                    memcpy(&key, _secret + 8 * j, sizeof(key));
+                    u64 accumulator = _accumulators[j];
+                    accumulator ^= accumulator >> 47;
+                    accumulator ^= key;
+                    _accumulators[j] = accumulator * kXxh3Prime32_1;
+                }
+#endif
+            }
+        };
+
+        template <class Arch>
+        constexpr KernelTable MakeKernelTable()
+        {
+            return {
+                .m_transformVectors = &Kernels<Arch>::TransformVectors,
+                .m_computeTransformMatrices = &Kernels<Arch>::ComputeTransformMatrices,
+                .m_multiplyMatrices = &Kernels<Arch>::MultiplyMatrices,
+                .m_cullBoundingBoxes = &Kernels<Arch>::CullBoundingBoxes,
+                .m_cullBoundingSpheres = &Kernels<Arch>::CullBoundingSpheres,
+                .m_convertToFloat16 = &Kernels<Arch>::ConvertToFloat16,
+                .m_convertFromFloat16 = &Kernels<Arch>::ConvertFromFloat16,
+                .m_xxh3AccumulateStripes = &Kernels<Arch>::Xxh3AccumulateStripes,
+                .m_xxh3Scramble = &Kernels<Arch>::Xxh3Scramble,
+            };
+        }
+    }
+}
@@ -0,0 +1,13 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+// Compiled with AVX2 and F16C enabled, see Core/CMakeLists.txt.
+#include "Math/SimdKernels/SimdKernels.inl"
+
+namespace KryneEngine::Math::SimdKernels
+{
+    const KernelTable kAvx2Kernels = MakeKernelTable<xsimd::avx2>();
+}
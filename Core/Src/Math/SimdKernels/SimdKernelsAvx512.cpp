@@ -0,0 +1,13 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+// Compiled with AVX-512F enabled, see Core/CMakeLists.txt.
+#include "Math/SimdKernels/SimdKernels.inl"
+
+namespace KryneEngine::Math::SimdKernels
+{
+    const KernelTable kAvx512Kernels = MakeKernelTable<xsimd::avx512f>();
+}
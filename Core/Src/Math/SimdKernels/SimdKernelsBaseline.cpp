@@ -0,0 +1,14 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+// Compiled with the same flags as the rest of the engine, so it is always safe to call.
+#include "KryneEngine/Core/Math/XSimdUtils.hpp"
+#include "Math/SimdKernels/SimdKernels.inl"
+
+namespace KryneEngine::Math::SimdKernels
+{
+    const KernelTable kBaselineKernels = MakeKernelTable<XsimdArch512>();
+}
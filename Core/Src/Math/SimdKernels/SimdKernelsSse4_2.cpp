@@ -0,0 +1,13 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+// Compiled with SSE4.2 enabled, see Core/CMakeLists.txt.
+#include "Math/SimdKernels/SimdKernels.inl"
+
+namespace KryneEngine::Math::SimdKernels
+{
+    const KernelTable kSse4_2Kernels = MakeKernelTable<xsimd::sse4_2>();
+}
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Math/TransformBatch.hpp"
+
+#include "Math/SimdKernels/SimdKernels.hpp"
+
+namespace KryneEngine::Math
+{
+    namespace
+    {
+        template <bool SimdOptimal, bool RowMajor>
+        void TransformVectors(
+            const Matrix44Base<float, SimdOptimal, RowMajor>& _matrix,
+            Vector3Soa<const float> _input,
+            Vector3Soa<float> _output,
+            size_t _count,
+            bool _applyTranslation)
+        {
+            float m[3][4];
+            for (size_t row = 0; row < 3; row++)
+            {
+                for (size_t col = 0; col < 4; col++)
+                {
+                    m[row][col] = _matrix.Get(row, col);
+                }
+                if (!_applyTranslation)
+                {
+                    m[row][3] = 0.f;
+                }
+            }
+
+            SimdKernels::GetActiveKernels().m_transformVectors(m, _input, _output, _count);
+        }
+    }
+
+    template <bool SimdOptimal, bool RowMajor>
+    void TransformPoints(
+        const Matrix44Base<float, SimdOptimal, RowMajor>& _matrix,
+        Vector3Soa<const float> _points,
+        Vector3Soa<float> _output,
+        size_t _count)
+    {
+        TransformVectors(_matrix, _points, _output, _count, true);
+    }
+
+    template <bool SimdOptimal, bool RowMajor>
+    void TransformDirections(
+        const Matrix44Base<float, SimdOptimal, RowMajor>& _matrix,
+        Vector3Soa<const float> _directions,
+        Vector3Soa<float> _output,
+        size_t _count)
+    {
+        TransformVectors(_matrix, _directions, _output, _count, false);
+    }
+
+    void ComputeTransformMatrices(
+        Vector3Soa<const float> _positions,
+        QuaternionSoa<const float> _rotations,
+        Vector3Soa<const float> _scales,
+        Matrix44Soa<float> _output,
+        size_t _count)
+    {
+        SimdKernels::GetActiveKernels().m_computeTransformMatrices(_positions, _rotations, _scales, _output, _count);
+    }
+
+    void MultiplyMatrices(
+        Matrix44Soa<const float> _lhs,
+        Matrix44Soa<const float> _rhs,
+        Matrix44Soa<float> _output,
+        size_t _count)
+    {
+        SimdKernels::GetActiveKernels().m_multiplyMatrices(_lhs, _rhs, _output, _count);
+    }
+
+#define IMPLEMENTATION_INDIVIDUAL(simdOptimal, rowMajor)                                                               \
+    template void TransformPoints<simdOptimal, rowMajor>(                                                              \
+        const Matrix44Base<float, simdOptimal, rowMajor>&, Vector3Soa<const float>, Vector3Soa<float>, size_t);        \
+    template void TransformDirections<simdOptimal, rowMajor>(                                                          \
+        const Matrix44Base<float, simdOptimal, rowMajor>&, Vector3Soa<const float>, Vector3Soa<float>, size_t)
+
+    IMPLEMENTATION_INDIVIDUAL(true, true);
+    IMPLEMENTATION_INDIVIDUAL(true, false);
+    IMPLEMENTATION_INDIVIDUAL(false, false);
+    IMPLEMENTATION_INDIVIDUAL(false, true);
+
+#undef IMPLEMENTATION_INDIVIDUAL
+}
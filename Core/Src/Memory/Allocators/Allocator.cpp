@@ -8,10 +8,91 @@
 
 #include <cstdint>
 #include "KryneEngine/Core/Platform/StdAlloc.hpp"
-#include "KryneEngine/Core/Memory/Allocators/DefaultHeapHeapAllocationTracker.hpp"
+#include "KryneEngine/Core/Memory/Allocators/AllocatorTracker.hpp"
+#include "KryneEngine/Core/Memory/Allocators/HeapSamplingProfiler.hpp"
 
 namespace KryneEngine
 {
+    bool IAllocator::GetAllocatorStats(AllocatorStats& _stats)
+    {
+        const AllocatorTracker* tracker = GetTracker();
+        if (tracker == nullptr)
+        {
+            return false;
+        }
+        _stats = tracker->GetStats();
+        return true;
+    }
+
+#if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS || KE_COUNT_DEFAULT_HEAP_ALLOCATIONS
+#   define KE_HOOK_DEFAULT_HEAP 1
+
+    namespace
+    {
+#   if KE_COUNT_DEFAULT_HEAP_ALLOCATIONS
+        AllocatorTracker g_defaultHeapTracker { "Default heap" };
+#   endif
+
+#   if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
+        // Skips the `AllocatorInstance::allocate()` frame.
+        HeapSamplingProfiler g_defaultHeapProfiler { HeapSamplingProfiler::kDefaultSamplingInterval, 1 };
+#   endif
+
+        void TrackDefaultHeapAllocation(void* _ptr, size_t _size)
+        {
+#   if KE_COUNT_DEFAULT_HEAP_ALLOCATIONS
+            // Usable sizes are tracked, as the size isn't always known on free.
+            if (_ptr == nullptr) [[unlikely]]
+            {
+                g_defaultHeapTracker.RegisterFailedAllocation();
+                return;
+            }
+            g_defaultHeapTracker.RegisterAllocation(StdAlloc::GetAllocationSize(_ptr));
+#   endif
+#   if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
+            g_defaultHeapProfiler.RegisterAllocation(_ptr, _size);
+#   endif
+        }
+
+        void TrackDefaultHeapFree(void* _ptr)
+        {
+            if (_ptr == nullptr)
+            {
+                return;
+            }
+#   if KE_COUNT_DEFAULT_HEAP_ALLOCATIONS
+            g_defaultHeapTracker.RegisterFree(StdAlloc::GetAllocationSize(_ptr));
+#   endif
+#   if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
+            g_defaultHeapProfiler.RegisterDeallocation(_ptr);
+#   endif
+        }
+    }
+#endif
+
+    AllocatorTracker* AllocatorInstance::GetDefaultHeapTracker()
+    {
+#if KE_COUNT_DEFAULT_HEAP_ALLOCATIONS
+        return &g_defaultHeapTracker;
+#else
+        return nullptr;
+#endif
+    }
+
+    HeapSamplingProfiler* AllocatorInstance::GetDefaultHeapProfiler()
+    {
+#if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
+        return &g_defaultHeapProfiler;
+#else
+        return nullptr;
+#endif
+    }
+
+    AllocatorTracker* AllocatorInstance::GetTracker() const
+    {
+        return m_allocator != nullptr ? m_allocator->GetTracker() : GetDefaultHeapTracker();
+    }
+
     void* AllocatorInstance::allocate(size_t _size, int _flags) const
     {
         if (m_allocator)
@@ -21,8 +102,8 @@ namespace KryneEngine
         else
         {
             void* ptr = StdAlloc::Malloc(_size);
-#if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
-            DefaultHeapHeapAllocationTracker::GetInstance().RegisterAllocation(ptr, _size, 0);
+#if KE_HOOK_DEFAULT_HEAP
+            TrackDefaultHeapAllocation(ptr, _size);
 #endif
             return ptr;
         }
@@ -38,8 +119,8 @@ namespace KryneEngine
         else
         {
             ptr = StdAlloc::MemAlign(_size, _alignment);
-#if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
-            DefaultHeapHeapAllocationTracker::GetInstance().RegisterAllocation(ptr, _size, _alignment);
+#if KE_HOOK_DEFAULT_HEAP
+            TrackDefaultHeapAllocation(ptr, _size);
 #endif
         }
         return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr) + _alignmentOffset);
@@ -53,8 +134,8 @@ namespace KryneEngine
         }
         else
         {
-#if KE_TRACK_DEFAULT_HEAP_ALLOCATIONS
-            DefaultHeapHeapAllocationTracker::GetInstance().RegisterDeallocation(_ptr);
+#if KE_HOOK_DEFAULT_HEAP
+            TrackDefaultHeapFree(_ptr);
 #endif
             StdAlloc::Free(_ptr);
         }
@@ -0,0 +1,78 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/AllocatorTracker.hpp"
+
+namespace KryneEngine
+{
+    AllocatorTracker::~AllocatorTracker()
+    {
+        const BudgetCallback* callback = m_budgetCallback.load(std::memory_order_acquire);
+        while (callback != nullptr)
+        {
+            const BudgetCallback* previous = callback->m_previous;
+            delete callback;
+            callback = previous;
+        }
+    }
+
+    void AllocatorTracker::SetBudget(size_t _budget, AllocatorBudgetCallback _callback, void* _userData)
+    {
+        // Published before the budget, so the allocation crossing the new budget already sees the new callback.
+        auto* callback = new BudgetCallback {
+            .m_function = _callback,
+            .m_userData = _userData,
+            .m_previous = m_budgetCallback.load(std::memory_order_relaxed),
+        };
+        while (!m_budgetCallback.compare_exchange_weak(
+            callback->m_previous,
+            callback,
+            std::memory_order_release,
+            std::memory_order_relaxed))
+        {}
+        m_budget.store(_budget, std::memory_order_release);
+    }
+
+    void AllocatorTracker::SetUsage(size_t _bytesInUse, u64 _allocationCount)
+    {
+        const size_t previous = m_bytesInUse.exchange(_bytesInUse, std::memory_order_relaxed);
+        m_allocationCount.store(_allocationCount, std::memory_order_relaxed);
+        if (_bytesInUse > previous)
+        {
+            _OnUsageIncreased(previous, _bytesInUse);
+        }
+    }
+
+    AllocatorStats AllocatorTracker::GetStats() const
+    {
+        return {
+            .m_name = m_name,
+            .m_bytesInUse = m_bytesInUse.load(std::memory_order_relaxed),
+            .m_peakBytesInUse = m_peakBytesInUse.load(std::memory_order_relaxed),
+            .m_budget = m_budget.load(std::memory_order_relaxed),
+            .m_allocationCount = m_allocationCount.load(std::memory_order_relaxed),
+            .m_totalAllocationCount = m_totalAllocationCount.load(std::memory_order_relaxed),
+            .m_failedAllocationCount = m_failedAllocationCount.load(std::memory_order_relaxed),
+        };
+    }
+
+    void AllocatorTracker::_OnBudgetExceeded(size_t _current)
+    {
+        const BudgetCallback* callback = m_budgetCallback.load(std::memory_order_acquire);
+        if (callback != nullptr && callback->m_function != nullptr)
+        {
+            callback->m_function(*this, _current, callback->m_userData);
+        }
+    }
+
+    void AllocatorTracker::_UpdatePeak(size_t _current)
+    {
+        size_t peak = m_peakBytesInUse.load(std::memory_order_relaxed);
+        while (_current > peak
+            && !m_peakBytesInUse.compare_exchange_weak(peak, _current, std::memory_order_relaxed))
+        {}
+    }
+} // namespace KryneEngine
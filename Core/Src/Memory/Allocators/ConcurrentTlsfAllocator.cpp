@@ -0,0 +1,316 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/ConcurrentTlsfAllocator.hpp"
+
+#include <cstring>
+#include <EASTL/algorithm.h>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/BitUtils.hpp"
+
+namespace KryneEngine
+{
+    namespace
+    {
+        // Size classes are 16 bytes apart up to 128 bytes, then split each power of two in 4.
+        constexpr u32 kLinearClassCount = 8;
+        constexpr size_t kLinearClassMaxSize = 128;
+        constexpr u8 kLinearClassMaxSizePot = 7;
+
+        // Stored right before each user pointer. It is only written when the block is taken from the TLSF heap, and
+        // the TLSF heap never writes into the user area of a used block, so it can be read without the lock.
+        struct BlockPrefix
+        {
+            u32 m_offset;
+            u32 m_sizeClass;
+        };
+
+        // Keeps user pointers aligned to `kCachedAlignment`.
+        constexpr size_t kBlockPrefixSize = 16;
+        constexpr u32 kHeapSizeClass = ~0u;
+
+        void* WriteBlockPrefix(void* _heapBlock, size_t _offset, u32 _sizeClass)
+        {
+            void* userPtr = static_cast<std::byte*>(_heapBlock) + _offset;
+            *(static_cast<BlockPrefix*>(userPtr) - 1) = { static_cast<u32>(_offset), _sizeClass };
+            return userPtr;
+        }
+
+        const BlockPrefix& GetBlockPrefix(const void* _userPtr)
+        {
+            return *(static_cast<const BlockPrefix*>(_userPtr) - 1);
+        }
+
+        void* UserPtrToHeapBlock(void* _userPtr)
+        {
+            return static_cast<std::byte*>(_userPtr) - GetBlockPrefix(_userPtr).m_offset;
+        }
+    }
+
+    ConcurrentTlsfAllocator::ConcurrentTlsfAllocator(AllocatorInstance _parentAllocator, TlsfAllocator* _tlsf)
+        : m_parentAllocator(_parentAllocator)
+        , m_tlsf(_tlsf)
+    {}
+
+    ConcurrentTlsfAllocator::~ConcurrentTlsfAllocator()
+    {
+        // Cached blocks don't need to be given back, as the whole TLSF heap is released.
+        for (ThreadCache* cache: m_threadCaches)
+        {
+            m_parentAllocator.Delete(cache);
+        }
+        TlsfAllocator::Destroy(m_tlsf);
+    }
+
+    void* ConcurrentTlsfAllocator::Allocate(size_t _size, size_t _alignment)
+    {
+        if (_size == 0)
+            return nullptr;
+
+        if (_size > kMaxCachedSize || _alignment > kCachedAlignment)
+        {
+            return _AllocateFromHeap(_size, _alignment);
+        }
+
+        ThreadCache* cache = _GetThreadCache();
+        if (cache == nullptr)
+        {
+            return _AllocateFromHeap(_size, _alignment);
+        }
+
+        const u32 sizeClass = GetSizeClass(_size);
+        Magazine& magazine = cache->m_magazines[sizeClass];
+        if (magazine.m_count == 0)
+        {
+            _Refill(magazine, sizeClass);
+            if (magazine.m_count == 0)
+                return nullptr;
+        }
+        return magazine.m_blocks[--magazine.m_count];
+    }
+
+    void ConcurrentTlsfAllocator::Free(void* _ptr, size_t /* _size */)
+    {
+        if (_ptr == nullptr)
+            return;
+
+        const u32 sizeClass = GetBlockPrefix(_ptr).m_sizeClass;
+        if (sizeClass == kHeapSizeClass)
+        {
+            // Don't wait on the lock, let the next lock owner free the block.
+            if (m_lock.TryLock())
+            {
+                m_tlsf->Free(UserPtrToHeapBlock(_ptr), 0);
+                _DrainRemoteFrees();
+                m_lock.Unlock();
+            }
+            else
+            {
+                auto* node = static_cast<RemoteFreeNode*>(_ptr);
+                _PushRemoteFrees(node, node);
+            }
+            return;
+        }
+
+        ThreadCache* cache = _GetThreadCache();
+        if (cache == nullptr)
+        {
+            auto* node = static_cast<RemoteFreeNode*>(_ptr);
+            _PushRemoteFrees(node, node);
+            return;
+        }
+
+        Magazine& magazine = cache->m_magazines[sizeClass];
+        if (magazine.m_count == kMagazineCapacity)
+        {
+            // Release the oldest half of the magazine in a single push.
+            constexpr u32 releasedCount = kMagazineCapacity / 2;
+            for (u32 i = 0; i < releasedCount; i++)
+            {
+                static_cast<RemoteFreeNode*>(magazine.m_blocks[i])->m_next =
+                    i + 1 < releasedCount ? static_cast<RemoteFreeNode*>(magazine.m_blocks[i + 1]) : nullptr;
+            }
+            _PushRemoteFrees(
+                static_cast<RemoteFreeNode*>(magazine.m_blocks[0]),
+                static_cast<RemoteFreeNode*>(magazine.m_blocks[releasedCount - 1]));
+
+            memmove(
+                magazine.m_blocks,
+                magazine.m_blocks + releasedCount,
+                (kMagazineCapacity - releasedCount) * sizeof(void*));
+            magazine.m_count -= releasedCount;
+        }
+        magazine.m_blocks[magazine.m_count++] = _ptr;
+    }
+
+    ConcurrentTlsfAllocator* ConcurrentTlsfAllocator::Create(AllocatorInstance _parentAllocator, size_t _heapSize)
+    {
+        TlsfAllocator* tlsf = TlsfAllocator::Create(_parentAllocator, _heapSize);
+        VERIFY_OR_RETURN(tlsf != nullptr, nullptr);
+
+        auto* allocator = _parentAllocator.Allocate<ConcurrentTlsfAllocator>();
+        IF_NOT_VERIFY_MSG(allocator != nullptr, "Failed to allocate memory for the allocator")
+        {
+            TlsfAllocator::Destroy(tlsf);
+            return nullptr;
+        }
+        return new (allocator) ConcurrentTlsfAllocator(_parentAllocator, tlsf);
+    }
+
+    void ConcurrentTlsfAllocator::Destroy(ConcurrentTlsfAllocator* _allocator)
+    {
+        VERIFY_OR_RETURN_VOID(_allocator != nullptr);
+
+        const AllocatorInstance parentAllocator = _allocator->m_parentAllocator;
+        _allocator->~ConcurrentTlsfAllocator();
+        parentAllocator.deallocate(_allocator, sizeof(ConcurrentTlsfAllocator));
+    }
+
+    void ConcurrentTlsfAllocator::SetAutoGrowth(bool _autoGrowth)
+    {
+        const auto lock = m_lock.AutoLock();
+        m_tlsf->SetAutoGrowth(_autoGrowth);
+    }
+
+    void ConcurrentTlsfAllocator::SetTrimPolicy(const TlsfAllocator::TrimPolicy& _policy)
+    {
+        const auto lock = m_lock.AutoLock();
+        _DrainRemoteFrees();
+        m_tlsf->SetTrimPolicy(_policy);
+    }
+
+    u32 ConcurrentTlsfAllocator::TrimEmptyHeaps(u32 _keptEmptyHeaps)
+    {
+        const auto lock = m_lock.AutoLock();
+        _DrainRemoteFrees();
+        return m_tlsf->TrimEmptyHeaps(_keptEmptyHeaps);
+    }
+
+    bool ConcurrentTlsfAllocator::GetAllocatorStats(AllocatorStats& _stats)
+    {
+        const auto lock = m_lock.AutoLock();
+        _DrainRemoteFrees();
+        return m_tlsf->GetAllocatorStats(_stats);
+    }
+
+    void ConcurrentTlsfAllocator::FlushThreadCache()
+    {
+        const u32 threadSlot = Threads::PeekThreadSlot();
+        if (threadSlot == Threads::kNoThreadSlot || m_threadCaches[threadSlot] == nullptr)
+            return;
+
+        ThreadCache* cache = m_threadCaches[threadSlot];
+
+        const auto lock = m_lock.AutoLock();
+        for (Magazine& magazine: cache->m_magazines)
+        {
+            for (u32 i = 0; i < magazine.m_count; i++)
+            {
+                m_tlsf->Free(UserPtrToHeapBlock(magazine.m_blocks[i]), 0);
+            }
+            magazine.m_count = 0;
+        }
+        _DrainRemoteFrees();
+    }
+
+    u32 ConcurrentTlsfAllocator::GetSizeClass(size_t _size)
+    {
+        KE_ASSERT(_size > 0 && _size <= kMaxCachedSize);
+
+        if (_size <= kLinearClassMaxSize)
+        {
+            return static_cast<u32>((_size - 1) >> 4);
+        }
+
+        const u8 msb = BitUtils::GetMostSignificantBit(_size - 1);
+        const u8 shift = msb - 2;
+        return kLinearClassCount + (msb - kLinearClassMaxSizePot) * 4 + (((_size - 1) >> shift) & 3);
+    }
+
+    size_t ConcurrentTlsfAllocator::GetSizeClassSize(u32 _sizeClass)
+    {
+        KE_ASSERT(_sizeClass < kSizeClassCount);
+
+        if (_sizeClass < kLinearClassCount)
+        {
+            return (_sizeClass + 1) * 16;
+        }
+
+        const u32 group = (_sizeClass - kLinearClassCount) / 4;
+        const u32 step = (_sizeClass - kLinearClassCount) % 4;
+        return static_cast<size_t>(4 + step + 1) << (kLinearClassMaxSizePot - 2 + group);
+    }
+
+    ConcurrentTlsfAllocator::ThreadCache* ConcurrentTlsfAllocator::_GetThreadCache()
+    {
+        const u32 threadSlot = Threads::GetThreadSlot();
+        if (threadSlot == Threads::kNoThreadSlot)
+        {
+            return nullptr;
+        }
+
+        ThreadCache*& cache = m_threadCaches[threadSlot];
+        if (cache == nullptr)
+        {
+            cache = m_parentAllocator.New<ThreadCache>();
+        }
+        return cache;
+    }
+
+    void* ConcurrentTlsfAllocator::_AllocateFromHeap(size_t _size, size_t _alignment)
+    {
+        // Over-aligned blocks need a prefix as large as their alignment, to keep the user pointer aligned.
+        const size_t prefixSize = eastl::max(_alignment, kBlockPrefixSize);
+
+        void* block;
+        {
+            const auto lock = m_lock.AutoLock();
+            _DrainRemoteFrees();
+            block = m_tlsf->Allocate(_size + prefixSize, prefixSize);
+        }
+        return block != nullptr ? WriteBlockPrefix(block, prefixSize, kHeapSizeClass) : nullptr;
+    }
+
+    void ConcurrentTlsfAllocator::_Refill(Magazine& _magazine, u32 _sizeClass)
+    {
+        const size_t blockSize = GetSizeClassSize(_sizeClass);
+
+        const auto lock = m_lock.AutoLock();
+        _DrainRemoteFrees();
+        while (_magazine.m_count < kRefillBatchSize)
+        {
+            void* block = m_tlsf->Allocate(blockSize + kBlockPrefixSize, kCachedAlignment);
+            if (block == nullptr)
+                break;
+            _magazine.m_blocks[_magazine.m_count++] = WriteBlockPrefix(block, kBlockPrefixSize, _sizeClass);
+        }
+    }
+
+    void ConcurrentTlsfAllocator::_PushRemoteFrees(RemoteFreeNode* _first, RemoteFreeNode* _last)
+    {
+        RemoteFreeNode* head = m_remoteFreeList.load(std::memory_order_relaxed);
+        do
+        {
+            _last->m_next = head;
+        }
+        while (!m_remoteFreeList.compare_exchange_weak(head, _first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void ConcurrentTlsfAllocator::_DrainRemoteFrees()
+    {
+        KE_ASSERT(m_lock.IsLocked());
+
+        // The whole list is detached at once, so there is no ABA issue.
+        RemoteFreeNode* node = m_remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr)
+        {
+            RemoteFreeNode* next = node->m_next;
+            m_tlsf->Free(UserPtrToHeapBlock(node), 0);
+            node = next;
+        }
+    }
+} // namespace KryneEngine
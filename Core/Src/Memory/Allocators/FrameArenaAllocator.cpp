@@ -0,0 +1,283 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/FrameArenaAllocator.hpp"
+
+#include <EASTL/algorithm.h>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "KryneEngine/Core/Profiling/TracyHeader.hpp"
+#include "KryneEngine/Core/Threads/FiberThread.hpp"
+
+namespace KryneEngine
+{
+    namespace
+    {
+        inline std::byte* AlignPointer(std::byte* _ptr, size_t _alignment)
+        {
+            return reinterpret_cast<std::byte*>(Alignment::AlignUp(reinterpret_cast<uintptr_t>(_ptr), _alignment));
+        }
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator(
+        AllocatorInstance _parentAllocator,
+        size_t _regionSize,
+        u8 _frameCount,
+        u16 _threadCount)
+        : m_parentAllocator(_parentAllocator)
+        , m_regionSize(_regionSize)
+        , m_frameCount(_frameCount)
+        , m_threadCount(_threadCount)
+    {
+        for (u8 i = 0; i < m_frameCount; i++)
+        {
+            m_frames[i].m_memory = static_cast<std::byte*>(m_parentAllocator.allocate(m_regionSize, kChunkAlignment));
+        }
+
+        m_subArenas = m_parentAllocator.Allocate<SubArena>(m_threadCount + 1);
+        if (m_subArenas != nullptr)
+        {
+            for (u32 i = 0; i <= m_threadCount; i++)
+            {
+                new (&m_subArenas[i]) SubArena();
+            }
+        }
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        for (u8 i = 0; i < m_frameCount; i++)
+        {
+            _ReleaseOverflowBlocks(m_frames[i]);
+            m_parentAllocator.deallocate(m_frames[i].m_memory, m_regionSize);
+        }
+        m_parentAllocator.deallocate(m_subArenas, sizeof(SubArena) * (m_threadCount + 1));
+    }
+
+    void* FrameArenaAllocator::Allocate(size_t _size, size_t _alignment)
+    {
+        if (_size == 0)
+            return nullptr;
+
+        const size_t alignment = _alignment == 0 ? kDefaultAlignment : _alignment;
+        KE_ASSERT_MSG((alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+        if (_size > kMaxSubArenaAllocationSize || alignment > kChunkAlignment)
+        {
+            return _AllocateFromRegion(_size, alignment);
+        }
+
+        if (FiberThread::IsFiberThread())
+        {
+            const u16 threadIndex = FiberThread::GetCurrentFiberThreadIndex();
+            if (threadIndex < m_threadCount)
+            {
+                return _AllocateFromSubArena(m_subArenas[threadIndex], _size, alignment);
+            }
+        }
+
+        const auto lock = m_sharedSubArenaLock.AutoLock();
+        return _AllocateFromSubArena(m_subArenas[m_threadCount], _size, alignment);
+    }
+
+    FrameArenaAllocator* FrameArenaAllocator::Create(
+        AllocatorInstance _parentAllocator,
+        size_t _regionSize,
+        u8 _frameCount,
+        u16 _threadCount)
+    {
+        VERIFY_OR_RETURN(_frameCount > 0 && _frameCount <= kMaxFrameCount, nullptr);
+        VERIFY_OR_RETURN(_regionSize >= kChunkSize, nullptr);
+
+        auto* memory = _parentAllocator.Allocate<FrameArenaAllocator>();
+        VERIFY_OR_RETURN(memory != nullptr, nullptr);
+
+        auto* allocator = new (memory) FrameArenaAllocator(
+            _parentAllocator,
+            Alignment::AlignUp(_regionSize, kChunkAlignment),
+            _frameCount,
+            _threadCount);
+
+        bool success = allocator->m_subArenas != nullptr;
+        for (u8 i = 0; i < _frameCount; i++)
+        {
+            success &= allocator->m_frames[i].m_memory != nullptr;
+        }
+        IF_NOT_VERIFY_MSG(success, "Failed to allocate frame arena regions")
+        {
+            Destroy(allocator);
+            return nullptr;
+        }
+        return allocator;
+    }
+
+    void FrameArenaAllocator::Destroy(FrameArenaAllocator* _allocator)
+    {
+        VERIFY_OR_RETURN_VOID(_allocator != nullptr);
+
+        const AllocatorInstance parentAllocator = _allocator->m_parentAllocator;
+        _allocator->~FrameArenaAllocator();
+        parentAllocator.deallocate(_allocator, sizeof(FrameArenaAllocator));
+    }
+
+    void FrameArenaAllocator::BeginFrame(u64 _frameId)
+    {
+        KE_ZoneScopedFunction("FrameArenaAllocator::BeginFrame");
+
+        _UpdateHighWater(m_frames[m_currentFrame]);
+
+        m_currentFrame = static_cast<u8>(_frameId % m_frameCount);
+        FrameRegion& frame = m_frames[m_currentFrame];
+        frame.m_offset.store(0, std::memory_order_relaxed);
+        _ReleaseOverflowBlocks(frame);
+
+        // Sub-arena chunks still point to the previous frame region.
+        for (u32 i = 0; i <= m_threadCount; i++)
+        {
+            m_subArenas[i] = {};
+        }
+
+        m_tracker.SetUsage(_GetLiveBytes(), 0);
+    }
+
+    FrameArenaAllocator::Stats FrameArenaAllocator::GetStats() const
+    {
+        const FrameRegion& frame = m_frames[m_currentFrame];
+
+        Stats stats {};
+        {
+            const auto lock = m_overflowLock.AutoLock();
+            stats.m_overflowBytes = frame.m_overflowBytes;
+            stats.m_overflowBlockCount = frame.m_overflowBlockCount;
+        }
+        stats.m_regionBytes = _GetRegionUsage(frame);
+        stats.m_highWaterBytes = eastl::max(m_highWaterBytes, stats.m_regionBytes + stats.m_overflowBytes);
+        stats.m_highWaterOverflowBytes = eastl::max(m_highWaterOverflowBytes, stats.m_overflowBytes);
+        stats.m_overflowedFrameCount = m_overflowedFrameCount + (stats.m_overflowBlockCount > 0 ? 1 : 0);
+        return stats;
+    }
+
+    bool FrameArenaAllocator::GetAllocatorStats(AllocatorStats& _stats)
+    {
+        _stats = m_tracker.GetStats();
+        _stats.m_bytesInUse = _GetLiveBytes();
+        _stats.m_peakBytesInUse = eastl::max(_stats.m_peakBytesInUse, _stats.m_bytesInUse);
+
+        // Only the current region can serve allocations, overflow blocks are not reused once a frame is over.
+        _stats.m_totalFreeBytes = m_regionSize - _GetRegionUsage(m_frames[m_currentFrame]);
+        _stats.m_largestFreeBlock = _stats.m_totalFreeBytes;
+        return true;
+    }
+
+    void* FrameArenaAllocator::_AllocateFromSubArena(SubArena& _subArena, size_t _size, size_t _alignment)
+    {
+        std::byte* ptr = AlignPointer(_subArena.m_cursor, _alignment);
+        if (_subArena.m_cursor == nullptr || ptr + _size > _subArena.m_end)
+        {
+            // The end of the previous chunk is wasted, which is bounded by `kMaxSubArenaAllocationSize`.
+            std::byte* chunk = _AllocateFromRegion(kChunkSize, kChunkAlignment);
+            if (chunk == nullptr)
+                return nullptr;
+
+            _subArena.m_end = chunk + kChunkSize;
+            ptr = AlignPointer(chunk, _alignment);
+        }
+        _subArena.m_cursor = ptr + _size;
+        return ptr;
+    }
+
+    std::byte* FrameArenaAllocator::_AllocateFromRegion(size_t _size, size_t _alignment)
+    {
+        // Keep region offsets aligned to chunks, and reserve enough padding for larger alignments.
+        const size_t alignment = eastl::max(_alignment, kChunkAlignment);
+        const size_t reservedSize = Alignment::AlignUp(_size, kChunkAlignment) + (alignment - kChunkAlignment);
+
+        FrameRegion& frame = m_frames[m_currentFrame];
+        const size_t offset = frame.m_offset.fetch_add(reservedSize, std::memory_order_relaxed);
+        if (offset + reservedSize <= m_regionSize)
+        {
+            return AlignPointer(frame.m_memory + offset, alignment);
+        }
+
+        return _AllocateFromOverflow(frame, reservedSize, alignment);
+    }
+
+    std::byte* FrameArenaAllocator::_AllocateFromOverflow(FrameRegion& _frame, size_t _size, size_t _alignment)
+    {
+        const auto lock = m_overflowLock.AutoLock();
+
+        OverflowBlock* block = _frame.m_overflowBlocks;
+        if (block == nullptr || block->m_offset + _size > block->m_size)
+        {
+            // Size overflow blocks relatively to the region, to avoid allocating from the parent on every chunk.
+            const size_t blockSize = eastl::max(m_regionSize / 4, _size);
+            auto* memory = static_cast<std::byte*>(m_parentAllocator.allocate(
+                kOverflowHeaderSize + blockSize,
+                kChunkAlignment));
+            IF_NOT_VERIFY_MSG(memory != nullptr, "Failed to allocate frame arena overflow block")
+            {
+                m_tracker.RegisterFailedAllocation();
+                return nullptr;
+            }
+
+            block = reinterpret_cast<OverflowBlock*>(memory);
+            block->m_next = _frame.m_overflowBlocks;
+            block->m_size = blockSize;
+            block->m_offset = 0;
+            _frame.m_overflowBlocks = block;
+            _frame.m_overflowBytes += blockSize;
+            _frame.m_overflowBlockCount++;
+
+            TracyPlot("Frame arena overflow (KiB)", static_cast<s64>(_frame.m_overflowBytes / 1024));
+        }
+
+        std::byte* ptr = reinterpret_cast<std::byte*>(block) + kOverflowHeaderSize + block->m_offset;
+        block->m_offset += _size;
+        return AlignPointer(ptr, _alignment);
+    }
+
+    void FrameArenaAllocator::_ReleaseOverflowBlocks(FrameRegion& _frame)
+    {
+        OverflowBlock* block = _frame.m_overflowBlocks;
+        while (block != nullptr)
+        {
+            OverflowBlock* next = block->m_next;
+            m_parentAllocator.deallocate(block, kOverflowHeaderSize + block->m_size);
+            block = next;
+        }
+        _frame.m_overflowBlocks = nullptr;
+        _frame.m_overflowBytes = 0;
+        _frame.m_overflowBlockCount = 0;
+    }
+
+    void FrameArenaAllocator::_UpdateHighWater(const FrameRegion& _frame)
+    {
+        m_highWaterBytes = eastl::max(m_highWaterBytes, _GetRegionUsage(_frame) + _frame.m_overflowBytes);
+        m_highWaterOverflowBytes = eastl::max(m_highWaterOverflowBytes, _frame.m_overflowBytes);
+        if (_frame.m_overflowBlockCount > 0)
+        {
+            m_overflowedFrameCount++;
+        }
+    }
+
+    size_t FrameArenaAllocator::_GetRegionUsage(const FrameRegion& _frame) const
+    {
+        // Failed reservations still bump the offset, so clamp it to the region size.
+        return eastl::min(_frame.m_offset.load(std::memory_order_relaxed), m_regionSize);
+    }
+
+    size_t FrameArenaAllocator::_GetLiveBytes() const
+    {
+        size_t liveBytes = 0;
+        const auto lock = m_overflowLock.AutoLock();
+        for (u8 i = 0; i < m_frameCount; i++)
+        {
+            liveBytes += _GetRegionUsage(m_frames[i]) + m_frames[i].m_overflowBytes;
+        }
+        return liveBytes;
+    }
+} // namespace KryneEngine
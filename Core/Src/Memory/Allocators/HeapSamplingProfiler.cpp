@@ -0,0 +1,390 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/HeapSamplingProfiler.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <EASTL/algorithm.h>
+
+#if defined(_WIN32)
+#   include "KryneEngine/Core/Platform/Windows.h"
+#else
+#   include <execinfo.h>
+#endif
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Math/Hashing.hpp"
+#include "KryneEngine/Core/Platform/StdAlloc.hpp"
+
+namespace KryneEngine
+{
+    namespace
+    {
+        // Distance until the sampling interval is checked again while sampling is disabled.
+        constexpr s64 kDisabledSamplingDistance = 64 * 1024 * 1024;
+
+        // Frame of `_OnSamplingPoint()`. Unoptimized builds keep the inline `RegisterAllocation()` frame, so callstacks
+        // start one frame too early.
+        constexpr u32 kOwnFrameCount = 1;
+
+        // Shared by all profilers, as the internal allocations of one profiler can reach another one.
+        thread_local bool t_insideProfiler = false;
+    }
+
+    HeapSamplingProfiler::HeapSamplingProfiler(size_t _samplingInterval, u32 _skippedFrameCount)
+        : m_samplingInterval(_samplingInterval)
+        , m_skippedFrameCount(_skippedFrameCount + kOwnFrameCount)
+        , m_allocationCountersStart(std::chrono::steady_clock::now())
+    {}
+
+    HeapSamplingProfiler::~HeapSamplingProfiler()
+    {
+        // Allocations can still be freed during static destruction, make sure they don't reach the destroyed tables.
+        m_samplingInterval.store(0, std::memory_order_relaxed);
+        for (auto& counter: m_liveFilter)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+
+        const auto lock = m_lock.AutoLock();
+        for (ThreadState& threadState: m_threadStates)
+        {
+            if (threadState.m_buffer != nullptr)
+            {
+                threadState.m_buffer->~ThreadBuffer();
+                StdAlloc::Free(threadState.m_buffer);
+                threadState.m_buffer = nullptr;
+            }
+        }
+    }
+
+    void HeapSamplingProfiler::SetSamplingInterval(size_t _interval)
+    {
+        m_samplingInterval.store(_interval, std::memory_order_relaxed);
+    }
+
+    HeapSamplingProfiler::Report HeapSamplingProfiler::TakeReport(
+        ReportType _type,
+        bool _resetAllocationCounters)
+    {
+        // Snapshot with the internal allocator, to not go through the tracked heap while holding the lock.
+        eastl::vector<SiteReport, CustomAllocator> snapshot;
+
+        Report report { .m_type = _type };
+        {
+            const auto lock = m_lock.AutoLock();
+
+            for (ThreadState& threadState: m_threadStates)
+            {
+                if (threadState.m_buffer != nullptr)
+                {
+                    const auto bufferLock = threadState.m_buffer->m_lock.AutoLock();
+                    _FlushThreadBuffer(*threadState.m_buffer);
+                }
+            }
+
+            snapshot.reserve(m_sites.size());
+            for (const auto& [siteHash, site]: m_sites)
+            {
+                SiteReport& siteReport = snapshot.push_back();
+                siteReport.m_siteHash = siteHash;
+                siteReport.m_callstackDepth = site.m_callstackDepth;
+                memcpy(siteReport.m_callstack, site.m_callstack, site.m_callstackDepth * sizeof(void*));
+                siteReport.m_liveCount = std::llround(eastl::max(site.m_liveCount, 0.0));
+                siteReport.m_liveBytes = std::llround(eastl::max(site.m_liveBytes, 0.0));
+                siteReport.m_allocatedCount = std::llround(site.m_allocatedCount);
+                siteReport.m_allocatedBytes = std::llround(site.m_allocatedBytes);
+
+                report.m_liveBytes += siteReport.m_liveBytes;
+                report.m_allocatedBytes += siteReport.m_allocatedBytes;
+            }
+            report.m_sampleCount = m_sampleCount;
+
+            const auto now = std::chrono::steady_clock::now();
+            report.m_durationSeconds = std::chrono::duration<double>(now - m_allocationCountersStart).count();
+
+            if (_resetAllocationCounters)
+            {
+                m_allocationCountersStart = now;
+                for (auto it = m_sites.begin(); it != m_sites.end();)
+                {
+                    if (it->second.m_liveCount < 0.5)
+                    {
+                        it = m_sites.erase(it);
+                    }
+                    else
+                    {
+                        it->second.m_allocatedCount = 0;
+                        it->second.m_allocatedBytes = 0;
+                        ++it;
+                    }
+                }
+            }
+        }
+
+        const bool liveHeap = _type == ReportType::LiveHeap;
+        eastl::sort(snapshot.begin(), snapshot.end(), [liveHeap](const SiteReport& _a, const SiteReport& _b)
+        {
+            return liveHeap ? _a.m_liveBytes > _b.m_liveBytes : _a.m_allocatedBytes > _b.m_allocatedBytes;
+        });
+        report.m_sites.assign(snapshot.begin(), snapshot.end());
+
+        return report;
+    }
+
+    void HeapSamplingProfiler::PrintReport(const Report& _report, FILE* _file, u32 _maxSiteCount)
+    {
+        constexpr double mebibyte = 1024.0 * 1024.0;
+        const double duration = eastl::max(_report.m_durationSeconds, 1e-9);
+
+        fprintf(
+            _file,
+            "%s report: %llu samples, %.2f MiB live, %.2f MiB allocated in %.2f s (%.2f MiB/s)\n",
+            _report.m_type == ReportType::LiveHeap ? "Live heap" : "Allocation rate",
+            static_cast<unsigned long long>(_report.m_sampleCount),
+            static_cast<double>(_report.m_liveBytes) / mebibyte,
+            static_cast<double>(_report.m_allocatedBytes) / mebibyte,
+            _report.m_durationSeconds,
+            static_cast<double>(_report.m_allocatedBytes) / mebibyte / duration);
+
+        const u32 siteCount = eastl::min<u32>(_maxSiteCount, _report.m_sites.size());
+        for (u32 i = 0; i < siteCount; i++)
+        {
+            const SiteReport& site = _report.m_sites[i];
+            fprintf(
+                _file,
+                "#%u: %llu bytes live in %llu allocations, %llu bytes allocated in %llu allocations (%.2f KiB/s)\n",
+                i,
+                static_cast<unsigned long long>(site.m_liveBytes),
+                static_cast<unsigned long long>(site.m_liveCount),
+                static_cast<unsigned long long>(site.m_allocatedBytes),
+                static_cast<unsigned long long>(site.m_allocatedCount),
+                static_cast<double>(site.m_allocatedBytes) / 1024.0 / duration);
+
+#if defined(_WIN32)
+            for (u32 frame = 0; frame < site.m_callstackDepth; frame++)
+            {
+                fprintf(_file, "    %p\n", site.m_callstack[frame]);
+            }
+#else
+            fflush(_file);
+            backtrace_symbols_fd(site.m_callstack, static_cast<int>(site.m_callstackDepth), fileno(_file));
+#endif
+        }
+        fflush(_file);
+    }
+
+    void HeapSamplingProfiler::_OnSamplingPoint(ThreadState& _threadState, void* _ptr, size_t _size)
+    {
+        const bool initialized = _threadState.m_randomState != 0;
+        if (!initialized)
+        {
+            _threadState.m_randomState = reinterpret_cast<uintptr_t>(&_threadState)
+                ^ static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count())
+                ^ 0x9E37'79B9'7F4A'7C15ull;
+            _threadState.m_randomState |= 1; // xorshift state can't be 0
+        }
+
+        _threadState.m_bytesUntilNextSample = _DrawSamplingDistance(_threadState);
+
+        const size_t interval = GetSamplingInterval();
+        if (!initialized || interval == 0 || _ptr == nullptr || t_insideProfiler)
+        {
+            return;
+        }
+
+        t_insideProfiler = true;
+
+        ThreadBuffer* buffer = _AcquireThreadBuffer(_threadState);
+        if (buffer != nullptr)
+        {
+            PendingSample sample {
+                .m_ptr = _ptr,
+                .m_size = _size,
+                // Inverse of the probability for an allocation of this size to be sampled.
+                .m_weight = 1.0 / -std::expm1(-static_cast<double>(_size) / static_cast<double>(interval)),
+                .m_freed = false,
+            };
+
+            // Captured directly here, so the number of frames to skip doesn't depend on inlining.
+            constexpr u32 maxFrameCount = 2 * kMaxCallstackDepth;
+            void* frames[maxFrameCount];
+            const u32 skippedFrameCount = eastl::min(m_skippedFrameCount, maxFrameCount - kMaxCallstackDepth);
+#if defined(_WIN32)
+            const u32 depth = CaptureStackBackTrace(0, kMaxCallstackDepth + skippedFrameCount, frames, nullptr);
+#else
+            const u32 depth = backtrace(frames, static_cast<int>(kMaxCallstackDepth + skippedFrameCount));
+#endif
+            sample.m_callstackDepth = depth > skippedFrameCount ? depth - skippedFrameCount : 0;
+            memcpy(sample.m_callstack, frames + skippedFrameCount, sample.m_callstackDepth * sizeof(void*));
+
+            buffer->m_lock.Lock();
+            if (buffer->m_count == kThreadBufferCapacity)
+            {
+                // Respect the lock order, shared lock first.
+                buffer->m_lock.Unlock();
+                const auto lock = m_lock.AutoLock();
+                buffer->m_lock.Lock();
+                _FlushThreadBuffer(*buffer);
+            }
+            buffer->m_samples[buffer->m_count++] = sample;
+
+            // The pointer isn't returned yet, so no thread can free it before it goes through the filter.
+            m_liveFilter[_GetFilterIndex(_ptr)].fetch_add(1, std::memory_order_relaxed);
+            buffer->m_lock.Unlock();
+        }
+
+        t_insideProfiler = false;
+    }
+
+    void HeapSamplingProfiler::_OnPossibleSampleFree(void* _ptr)
+    {
+        if (t_insideProfiler)
+        {
+            return;
+        }
+        t_insideProfiler = true;
+
+        const auto lock = m_lock.AutoLock();
+
+        const auto it = m_liveSamples.find(_ptr);
+        if (it != m_liveSamples.end())
+        {
+            const auto siteIt = m_sites.find(it->second.m_siteHash);
+            if (siteIt != m_sites.end())
+            {
+                siteIt->second.m_liveCount -= it->second.m_weight;
+                siteIt->second.m_liveBytes -= it->second.m_weight * static_cast<double>(it->second.m_size);
+            }
+            m_liveSamples.erase(it);
+            m_liveFilter[_GetFilterIndex(_ptr)].fetch_sub(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            // Either a false positive of the filter, or a sample not flushed yet.
+            for (ThreadState& threadState: m_threadStates)
+            {
+                ThreadBuffer* buffer = threadState.m_buffer;
+                if (buffer == nullptr)
+                {
+                    continue;
+                }
+
+                const auto bufferLock = buffer->m_lock.AutoLock();
+                const auto sampleIt = eastl::find_if(
+                    buffer->m_samples,
+                    buffer->m_samples + buffer->m_count,
+                    [_ptr](const PendingSample& _sample) { return _sample.m_ptr == _ptr && !_sample.m_freed; });
+                if (sampleIt != buffer->m_samples + buffer->m_count)
+                {
+                    sampleIt->m_freed = true;
+                    m_liveFilter[_GetFilterIndex(_ptr)].fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+
+        t_insideProfiler = false;
+    }
+
+    HeapSamplingProfiler::ThreadBuffer* HeapSamplingProfiler::_AcquireThreadBuffer(ThreadState& _threadState)
+    {
+        // Only written by the owning thread, so it can be read without the lock.
+        if (_threadState.m_buffer != nullptr)
+        {
+            return _threadState.m_buffer;
+        }
+
+        void* memory = StdAlloc::MemAlign(sizeof(ThreadBuffer), alignof(ThreadBuffer));
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        auto* buffer = new (memory) ThreadBuffer();
+
+        const auto lock = m_lock.AutoLock();
+        _threadState.m_buffer = buffer;
+        return buffer;
+    }
+
+    void HeapSamplingProfiler::_FlushThreadBuffer(ThreadBuffer& _buffer)
+    {
+        for (u32 i = 0; i < _buffer.m_count; i++)
+        {
+            const PendingSample& sample = _buffer.m_samples[i];
+            const u64 siteHash = Hashing::Hash64(sample.m_callstack, sample.m_callstackDepth);
+
+            const auto [it, inserted] = m_sites.insert(siteHash);
+            Site& site = it->second;
+            if (inserted)
+            {
+                site = Site { .m_callstackDepth = sample.m_callstackDepth };
+                memcpy(site.m_callstack, sample.m_callstack, sample.m_callstackDepth * sizeof(void*));
+            }
+
+            const double bytes = sample.m_weight * static_cast<double>(sample.m_size);
+            site.m_allocatedCount += sample.m_weight;
+            site.m_allocatedBytes += bytes;
+            if (!sample.m_freed)
+            {
+                site.m_liveCount += sample.m_weight;
+                site.m_liveBytes += bytes;
+                m_liveSamples[sample.m_ptr] = LiveSample {
+                    .m_siteHash = siteHash,
+                    .m_weight = sample.m_weight,
+                    .m_size = sample.m_size,
+                };
+            }
+            m_sampleCount++;
+        }
+        _buffer.m_count = 0;
+    }
+
+    s64 HeapSamplingProfiler::_DrawSamplingDistance(ThreadState& _threadState) const
+    {
+        const size_t interval = GetSamplingInterval();
+        if (interval == 0)
+        {
+            return kDisabledSamplingDistance;
+        }
+
+        // xorshift64*
+        u64& state = _threadState.m_randomState;
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        const u64 random = state * 0x2545'F491'4F6C'DD1Dull;
+
+        // Uniform in ]0, 1], to get an exponentially distributed distance with a mean of `interval`.
+        const double uniform = static_cast<double>((random >> 11) + 1) * 0x1.0p-53;
+        const double distance = -std::log(uniform) * static_cast<double>(interval);
+        return eastl::max<s64>(static_cast<s64>(eastl::min(distance, static_cast<double>(1ll << 62))), 1);
+    }
+
+    void* HeapSamplingProfiler::CustomAllocator::allocate(size_t _size, int)
+    {
+        return StdAlloc::Malloc(_size);
+    }
+
+    void* HeapSamplingProfiler::CustomAllocator::allocate(
+        size_t _size,
+        size_t _alignment,
+        size_t _alignmentOffset,
+        int)
+    {
+        // `deallocate()` only gets the offset pointer back, which can't be freed.
+        VERIFY_OR_RETURN(_alignmentOffset == 0, nullptr);
+        return StdAlloc::MemAlign(_size, _alignment);
+    }
+
+    void HeapSamplingProfiler::CustomAllocator::deallocate(
+        void* _ptr,
+        size_t _size)
+    {
+        StdAlloc::Free(_ptr);
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/HugePageAllocator.hpp"
+
+#include <EASTL/algorithm.h>
+
+#if defined(_WIN32)
+#   include "KryneEngine/Core/Platform/Windows.h"
+#else
+#   include <sys/mman.h>
+#endif
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "KryneEngine/Core/Profiling/TracyHeader.hpp"
+
+namespace KryneEngine
+{
+    HugePageAllocator::HugePageAllocator(AllocatorInstance _parentAllocator, size_t _threshold, Mode _mode)
+        : m_parentAllocator(_parentAllocator)
+        , m_threshold(_threshold)
+        , m_mode(_mode)
+    {
+        m_mappings.set_allocator(m_parentAllocator);
+    }
+
+    HugePageAllocator::~HugePageAllocator()
+    {
+        KE_ASSERT_MSG(m_mappings.empty(), "Some huge page mappings were not freed");
+        for (const Mapping& mapping: m_mappings)
+        {
+            _Unmap(mapping);
+        }
+    }
+
+    void* HugePageAllocator::Allocate(size_t _size, size_t _alignment)
+    {
+        if (_size < m_threshold || _alignment > kHugePageSize)
+        {
+            return m_parentAllocator.allocate(_size, _alignment);
+        }
+
+        KE_ZoneScopedFunction("HugePageAllocator::Allocate");
+
+        const size_t size = Alignment::AlignUp(_size, kHugePageSize);
+        PageType pageType;
+        void* ptr = _Map(size, pageType);
+        VERIFY_OR_RETURN(ptr != nullptr, nullptr);
+
+        const auto lock = m_lock.AutoLock();
+        m_mappings.push_back({ ptr, size, pageType });
+        m_stats.m_mappedBytes += size;
+        if (pageType == PageType::Reserved)
+        {
+            m_stats.m_hugePageCount += size / kHugePageSize;
+        }
+        else
+        {
+            m_stats.m_transparentHugePageCount += pageType == PageType::Transparent ? size / kHugePageSize : 0;
+            m_stats.m_fallbackCount += m_mode == Mode::Explicit ? 1 : 0;
+        }
+        return ptr;
+    }
+
+    void HugePageAllocator::Free(void* _ptr, size_t _size)
+    {
+        if (_ptr == nullptr)
+            return;
+
+        Mapping mapping {};
+        {
+            const auto lock = m_lock.AutoLock();
+            const auto it = eastl::find_if(
+                m_mappings.begin(),
+                m_mappings.end(),
+                [_ptr](const Mapping& _mapping) { return _mapping.m_ptr == _ptr; });
+            if (it == m_mappings.end())
+            {
+                m_parentAllocator.deallocate(_ptr, _size);
+                return;
+            }
+
+            mapping = *it;
+            m_mappings.erase_unsorted(it);
+
+            m_stats.m_mappedBytes -= mapping.m_size;
+            if (mapping.m_pageType == PageType::Reserved)
+            {
+                m_stats.m_hugePageCount -= mapping.m_size / kHugePageSize;
+            }
+            else if (mapping.m_pageType == PageType::Transparent)
+            {
+                m_stats.m_transparentHugePageCount -= mapping.m_size / kHugePageSize;
+            }
+        }
+
+        KE_ZoneScopedFunction("HugePageAllocator::Free");
+        _Unmap(mapping);
+    }
+
+    HugePageAllocator* HugePageAllocator::Create(AllocatorInstance _parentAllocator, size_t _threshold, Mode _mode)
+    {
+        auto* memory = _parentAllocator.Allocate<HugePageAllocator>();
+        VERIFY_OR_RETURN(memory != nullptr, nullptr);
+
+        return new (memory) HugePageAllocator(_parentAllocator, _threshold, _mode);
+    }
+
+    void HugePageAllocator::Destroy(HugePageAllocator* _allocator)
+    {
+        VERIFY_OR_RETURN_VOID(_allocator != nullptr);
+
+        const AllocatorInstance parentAllocator = _allocator->m_parentAllocator;
+        _allocator->~HugePageAllocator();
+        parentAllocator.deallocate(_allocator, sizeof(HugePageAllocator));
+    }
+
+    HugePageAllocator::Stats HugePageAllocator::GetStats() const
+    {
+        const auto lock = m_lock.AutoLock();
+        return m_stats;
+    }
+
+    void* HugePageAllocator::_Map(size_t _size, PageType& _pageType)
+    {
+        _pageType = PageType::Regular;
+
+#if defined(_WIN32)
+        // Large pages need the SeLockMemoryPrivilege, allocation simply fails without it.
+        const size_t largePageSize = GetLargePageMinimum();
+        if (m_mode == Mode::Explicit && largePageSize != 0 && Alignment::IsAligned(_size, largePageSize))
+        {
+            void* ptr = VirtualAlloc(
+                nullptr,
+                _size,
+                MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                PAGE_READWRITE);
+            if (ptr != nullptr)
+            {
+                _pageType = PageType::Reserved;
+                return ptr;
+            }
+        }
+        return VirtualAlloc(nullptr, _size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+#   if defined(MAP_HUGETLB)
+        if (m_mode == Mode::Explicit)
+        {
+            // Fails if no reserved huge page is available (see `/proc/sys/vm/nr_hugepages`).
+            void* ptr = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED)
+            {
+                _pageType = PageType::Reserved;
+                return ptr;
+            }
+        }
+#   endif
+
+        // Over-map by a huge page, so the mapping can be trimmed to a huge page boundary, as THP can only back aligned
+        // huge page ranges.
+        const size_t mappedSize = _size + kHugePageSize;
+        void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        auto* begin = static_cast<std::byte*>(mapped);
+        auto* ptr = reinterpret_cast<std::byte*>(Alignment::AlignUp(reinterpret_cast<uintptr_t>(begin), kHugePageSize));
+        const size_t headSize = ptr - begin;
+        if (headSize > 0)
+        {
+            munmap(begin, headSize);
+        }
+        munmap(ptr + _size, kHugePageSize - headSize);
+
+#   if defined(MADV_HUGEPAGE)
+        // Fails when the kernel is built without transparent huge page support.
+        if (madvise(ptr, _size, MADV_HUGEPAGE) == 0)
+        {
+            _pageType = PageType::Transparent;
+        }
+#   endif
+        return ptr;
+#endif
+    }
+
+    void HugePageAllocator::_Unmap(const Mapping& _mapping)
+    {
+#if defined(_WIN32)
+        VirtualFree(_mapping.m_ptr, 0, MEM_RELEASE);
+#else
+        munmap(_mapping.m_ptr, _mapping.m_size);
+#endif
+    }
+} // namespace KryneEngine
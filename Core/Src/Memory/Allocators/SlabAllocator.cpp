@@ -0,0 +1,328 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Memory/Allocators/SlabAllocator.hpp"
+
+#include <cstring>
+#include <EASTL/algorithm.h>
+
+#include "KryneEngine/Core/Common/Assert.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+
+namespace KryneEngine
+{
+    SlabAllocator::SlabAllocator(
+        AllocatorInstance _parentAllocator,
+        std::byte* _heapStart,
+        size_t _heapSize,
+        bool _threadCaching)
+        : m_parentAllocator(_parentAllocator)
+        , m_heapStart(_heapStart)
+        , m_heapSize(_heapSize)
+        , m_threadCaching(_threadCaching)
+    {}
+
+    SlabAllocator::~SlabAllocator()
+    {
+        // Cached slots don't need to be given back, as the whole slab heap is released.
+        for (ThreadCache* cache: m_threadCaches)
+        {
+            m_parentAllocator.Delete(cache);
+        }
+        m_parentAllocator.deallocate(m_heapStart, m_heapSize);
+    }
+
+    void* SlabAllocator::Allocate(size_t _size, size_t _alignment)
+    {
+        if (_size == 0)
+            return nullptr;
+
+        const u32 sizeClass = GetSizeClass(_size, _alignment);
+        if (sizeClass != kInvalidSizeClass)
+        {
+            ThreadCache* cache = m_threadCaching ? _GetThreadCache() : nullptr;
+            if (cache != nullptr)
+            {
+                Magazine& magazine = cache->m_magazines[sizeClass];
+                if (magazine.m_count == 0)
+                {
+                    const auto lock = m_lock.AutoLock();
+                    while (magazine.m_count < kRefillBatchSize)
+                    {
+                        void* slot = _AllocateSlot(sizeClass);
+                        if (slot == nullptr)
+                            break;
+                        magazine.m_slots[magazine.m_count++] = slot;
+                    }
+                }
+                if (magazine.m_count > 0)
+                {
+                    return magazine.m_slots[--magazine.m_count];
+                }
+            }
+            else
+            {
+                const auto lock = m_lock.AutoLock();
+                void* slot = _AllocateSlot(sizeClass);
+                if (slot != nullptr)
+                {
+                    return slot;
+                }
+            }
+        }
+
+        // Slab heap is full, or the allocation doesn't fit any size class.
+        return _alignment == 0
+            ? m_parentAllocator.allocate(_size)
+            : m_parentAllocator.allocate(_size, _alignment);
+    }
+
+    void SlabAllocator::Free(void* _ptr, size_t _size)
+    {
+        if (_ptr == nullptr)
+            return;
+
+        if (!Owns(_ptr))
+        {
+            m_parentAllocator.deallocate(_ptr, _size);
+            return;
+        }
+
+        ThreadCache* cache = m_threadCaching ? _GetThreadCache() : nullptr;
+        if (cache != nullptr)
+        {
+            // The size class of a page can't change while one of its slots is in use, so no need for the lock here.
+            Magazine& magazine = cache->m_magazines[_GetPage(_ptr)->m_sizeClass];
+            if (magazine.m_count == kMagazineCapacity)
+            {
+                // Give back the oldest half of the magazine, as it's the least likely to be hot in cache.
+                constexpr u32 releasedCount = kMagazineCapacity / 2;
+                {
+                    const auto lock = m_lock.AutoLock();
+                    for (u32 i = 0; i < releasedCount; i++)
+                    {
+                        _FreeSlot(magazine.m_slots[i]);
+                    }
+                }
+                memmove(
+                    magazine.m_slots,
+                    magazine.m_slots + releasedCount,
+                    (kMagazineCapacity - releasedCount) * sizeof(void*));
+                magazine.m_count -= releasedCount;
+            }
+            magazine.m_slots[magazine.m_count++] = _ptr;
+            return;
+        }
+
+        const auto lock = m_lock.AutoLock();
+        _FreeSlot(_ptr);
+    }
+
+    SlabAllocator* SlabAllocator::Create(AllocatorInstance _parentAllocator, size_t _heapSize, bool _threadCaching)
+    {
+        const size_t heapSize = Alignment::AlignUp(_heapSize, kPageSize);
+        VERIFY_OR_RETURN(heapSize > 0, nullptr);
+
+        auto* heapStart = static_cast<std::byte*>(_parentAllocator.allocate(heapSize, kPageSize));
+        VERIFY_OR_RETURN(heapStart != nullptr, nullptr);
+
+        auto* allocator = _parentAllocator.Allocate<SlabAllocator>();
+        IF_NOT_VERIFY_MSG(allocator != nullptr, "Failed to allocate memory for the allocator")
+        {
+            _parentAllocator.deallocate(heapStart, heapSize);
+            return nullptr;
+        }
+        return new (allocator) SlabAllocator(_parentAllocator, heapStart, heapSize, _threadCaching);
+    }
+
+    void SlabAllocator::Destroy(SlabAllocator* _allocator)
+    {
+        VERIFY_OR_RETURN_VOID(_allocator != nullptr);
+
+        const AllocatorInstance parentAllocator = _allocator->m_parentAllocator;
+        _allocator->~SlabAllocator();
+        parentAllocator.deallocate(_allocator, sizeof(SlabAllocator));
+    }
+
+    void SlabAllocator::FlushThreadCache()
+    {
+        const u32 threadSlot = Threads::PeekThreadSlot();
+        if (threadSlot == Threads::kNoThreadSlot || m_threadCaches[threadSlot] == nullptr)
+            return;
+
+        ThreadCache* cache = m_threadCaches[threadSlot];
+
+        const auto lock = m_lock.AutoLock();
+        for (Magazine& magazine: cache->m_magazines)
+        {
+            for (u32 i = 0; i < magazine.m_count; i++)
+            {
+                _FreeSlot(magazine.m_slots[i]);
+            }
+            magazine.m_count = 0;
+        }
+    }
+
+    u32 SlabAllocator::GetSizeClass(size_t _size, size_t _alignment)
+    {
+        if (_alignment > kMaxSlotAlignment)
+            return kInvalidSizeClass;
+
+        // Slots are laid out from a `kMaxSlotAlignment` aligned offset, so rounding the slot size to the alignment is
+        // enough to align all the slots of the class.
+        const size_t slotSize = Alignment::AlignUp(_size, eastl::max(_alignment, kSizeClassGranularity));
+        if (slotSize > kMaxSlotSize)
+            return kInvalidSizeClass;
+
+        return static_cast<u32>(slotSize / kSizeClassGranularity - 1);
+    }
+
+    SlabAllocator::ThreadCache* SlabAllocator::_GetThreadCache()
+    {
+        const u32 threadSlot = Threads::GetThreadSlot();
+        if (threadSlot == Threads::kNoThreadSlot)
+        {
+            return nullptr;
+        }
+
+        ThreadCache*& cache = m_threadCaches[threadSlot];
+        if (cache == nullptr)
+        {
+            cache = m_parentAllocator.New<ThreadCache>();
+        }
+        return cache;
+    }
+
+    void* SlabAllocator::_AllocateSlot(u32 _sizeClass)
+    {
+        KE_ASSERT(m_lock.IsLocked());
+
+        PageHeader* page = m_partialPages[_sizeClass];
+        if (page == nullptr)
+        {
+            page = _AcquirePage(_sizeClass);
+            if (page == nullptr)
+                return nullptr;
+        }
+
+        void* slot;
+        if (page->m_freeSlots != nullptr)
+        {
+            slot = page->m_freeSlots;
+            page->m_freeSlots = page->m_freeSlots->m_next;
+        }
+        else
+        {
+            // Slots are carved lazily, to avoid touching the whole page when acquiring it.
+            KE_ASSERT(page->m_carvedCount < page->m_capacity);
+            slot = reinterpret_cast<std::byte*>(page) + kPageHeaderSize
+                + static_cast<size_t>(page->m_carvedCount) * GetSlotSize(_sizeClass);
+            page->m_carvedCount++;
+        }
+
+        page->m_usedCount++;
+        if (page->m_usedCount == page->m_capacity)
+        {
+            _UnlinkPartialPage(page);
+        }
+        return slot;
+    }
+
+    void SlabAllocator::_FreeSlot(void* _ptr)
+    {
+        KE_ASSERT(m_lock.IsLocked());
+
+        PageHeader* page = _GetPage(_ptr);
+        KE_ASSERT(page->m_usedCount > 0);
+
+        auto* slot = static_cast<FreeSlot*>(_ptr);
+        slot->m_next = page->m_freeSlots;
+        page->m_freeSlots = slot;
+
+        if (page->m_usedCount == page->m_capacity)
+        {
+            _LinkPartialPage(page);
+        }
+        page->m_usedCount--;
+
+        // Keep the last partial page of the size class, to avoid acquiring and releasing it repeatedly.
+        const bool lastPartialPage = m_partialPages[page->m_sizeClass] == page && page->m_next == nullptr;
+        if (page->m_usedCount == 0 && !lastPartialPage)
+        {
+            _UnlinkPartialPage(page);
+            _ReleasePage(page);
+        }
+    }
+
+    SlabAllocator::PageHeader* SlabAllocator::_AcquirePage(u32 _sizeClass)
+    {
+        PageHeader* page = m_freePages;
+        if (page != nullptr)
+        {
+            m_freePages = page->m_next;
+        }
+        else if (m_untouchedPageIndex < m_heapSize / kPageSize)
+        {
+            page = reinterpret_cast<PageHeader*>(m_heapStart + m_untouchedPageIndex * kPageSize);
+            m_untouchedPageIndex++;
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        *page = {
+            .m_next = nullptr,
+            .m_previous = nullptr,
+            .m_freeSlots = nullptr,
+            .m_usedCount = 0,
+            .m_capacity = static_cast<u32>((kPageSize - kPageHeaderSize) / GetSlotSize(_sizeClass)),
+            .m_carvedCount = 0,
+            .m_sizeClass = _sizeClass,
+        };
+        _LinkPartialPage(page);
+        m_usedPageCount++;
+        return page;
+    }
+
+    void SlabAllocator::_ReleasePage(PageHeader* _page)
+    {
+        _page->m_next = m_freePages;
+        m_freePages = _page;
+        m_usedPageCount--;
+    }
+
+    void SlabAllocator::_LinkPartialPage(PageHeader* _page)
+    {
+        PageHeader*& head = m_partialPages[_page->m_sizeClass];
+        _page->m_previous = nullptr;
+        _page->m_next = head;
+        if (head != nullptr)
+        {
+            head->m_previous = _page;
+        }
+        head = _page;
+    }
+
+    void SlabAllocator::_UnlinkPartialPage(PageHeader* _page)
+    {
+        if (_page->m_previous != nullptr)
+        {
+            _page->m_previous->m_next = _page->m_next;
+        }
+        else
+        {
+            m_partialPages[_page->m_sizeClass] = _page->m_next;
+        }
+
+        if (_page->m_next != nullptr)
+        {
+            _page->m_next->m_previous = _page->m_previous;
+        }
+        _page->m_next = nullptr;
+        _page->m_previous = nullptr;
+    }
+} // namespace KryneEngine
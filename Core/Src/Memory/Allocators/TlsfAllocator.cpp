@@ -51,7 +51,10 @@ namespace KryneEngine
 
         const size_t usableHeapSize = m_heapSize - TlsfHeap::kHeapPoolOverhead - sizeof(void*);
         if (adjusted > usableHeapSize)
+        {
+            m_tracker.RegisterFailedAllocation();
             return nullptr;
+        }
 
         constexpr size_t gapMinimum = sizeof(TlsfHeap::BlockHeader);
         if (_alignment > TlsfHeap::kAlignment)
@@ -64,7 +67,7 @@ namespace KryneEngine
              * the prev_phys_block field is not valid, and we can't simply adjust
              * the size of that block.
              */
-            alignedSize = Alignment::AlignUp(_size + gapMinimum + _alignment, _alignment);
+            alignedSize = Alignment::AlignUp(adjusted + gapMinimum + _alignment, _alignment);
         }
 
         auto [fl, sl] = MappingSearch(alignedSize);
@@ -73,17 +76,25 @@ namespace KryneEngine
         if (block == nullptr)
         {
             // Try to auto-grow the allocator by adding a heap
-            if (!m_autoGrowth || !AddHeap())
-                return nullptr;
-            eastl::pair<u8, u8> pair = MappingSearch(alignedSize);
-            fl = pair.first; sl = pair.second;
-            block = SearchHeader(_size, fl, sl);
+            if (m_autoGrowth && AddHeap())
+            {
+                eastl::pair<u8, u8> pair = MappingSearch(alignedSize);
+                fl = pair.first; sl = pair.second;
+                block = SearchHeader(_size, fl, sl);
+            }
 
             if (block == nullptr)
+            {
+                m_tracker.RegisterFailedAllocation();
                 return nullptr;
+            }
         }
 
         TLSF_ASSERT(block->GetSize() >= _size);
+        if (IsWholeAdditionalHeap(block))
+        {
+            m_emptyHeapCount--;
+        }
         RemoveBlock(block, fl, sl);
 
         if (_alignment > TlsfHeap::kAlignment)
@@ -116,7 +127,10 @@ namespace KryneEngine
             }
         }
 
-        return PrepareBlockUsed(block, alignedSize);
+        // Only keep the requested size, the alignment padding was already trimmed.
+        void* ptr = PrepareBlockUsed(block, adjusted);
+        m_tracker.RegisterAllocation(block->GetSize());
+        return ptr;
     }
 
     void TlsfAllocator::Free(void* _ptr, size_t /* _size */)
@@ -126,10 +140,20 @@ namespace KryneEngine
 
         TlsfHeap::BlockHeader* block = TlsfHeap::UserPtrToBlockHeader(_ptr);
         TLSF_ASSERT_MSG(!block->IsFree(), "Block must not be free");
+        m_tracker.RegisterFree(block->GetSize());
         MarkAsFree(block);
         block = MergePreviousBlock(block);
         block = MergeNextBlock(block);
         InsertBlock(block);
+
+        if (IsWholeAdditionalHeap(block))
+        {
+            m_emptyHeapCount++;
+            if (m_trimPolicy.m_autoTrimThreshold != 0 && m_emptyHeapCount > m_trimPolicy.m_autoTrimThreshold)
+            {
+                TrimEmptyHeaps(m_trimPolicy.m_keptEmptyHeaps);
+            }
+        }
     }
 
     TlsfAllocator* TlsfAllocator::Create(AllocatorInstance _parentAllocator, size_t _heapSize)
@@ -187,6 +211,84 @@ namespace KryneEngine
         newHeapLink->m_next = nullptr;
         newHeapStart += sizeof(HeapLink);
         SetupHeapPool(newHeapStart, m_heapSize - sizeof(void*));
+
+        m_heapCount++;
+        m_emptyHeapCount++;
+        return true;
+    }
+
+    u32 TlsfAllocator::TrimEmptyHeaps(u32 _keptEmptyHeaps)
+    {
+        u32 releasedCount = 0;
+
+        HeapLink* previous = &m_nextHeap;
+        while (previous->m_next != nullptr && m_emptyHeapCount > _keptEmptyHeaps)
+        {
+            HeapLink* heap = previous->m_next;
+
+            // The first block header of the pool overlaps with the heap link, see `AddHeap()`.
+            auto* block = reinterpret_cast<TlsfHeap::BlockHeader*>(
+                reinterpret_cast<std::byte*>(heap) + sizeof(HeapLink) - TlsfHeap::kBlockHeaderMemoryAddressLeftOffset);
+            if (block->IsFree() && IsWholeAdditionalHeap(block))
+            {
+                const auto [fl, sl] = MappingInsert(block->GetSize());
+                RemoveBlock(block, fl, sl);
+
+                previous->m_next = heap->m_next;
+                m_parentAllocator.deallocate(heap, m_heapSize);
+
+                m_heapCount--;
+                m_emptyHeapCount--;
+                releasedCount++;
+                continue;
+            }
+            previous = heap;
+        }
+
+        return releasedCount;
+    }
+
+    void TlsfAllocator::SetTrimPolicy(const TrimPolicy& _policy)
+    {
+        KE_ASSERT_MSG(
+            _policy.m_autoTrimThreshold == 0 || _policy.m_autoTrimThreshold > _policy.m_keptEmptyHeaps,
+            "Auto-trim threshold must be greater than the number of kept heaps");
+
+        m_trimPolicy = _policy;
+        if (m_trimPolicy.m_autoTrimThreshold != 0 && m_emptyHeapCount > m_trimPolicy.m_autoTrimThreshold)
+        {
+            TrimEmptyHeaps(m_trimPolicy.m_keptEmptyHeaps);
+        }
+    }
+
+    bool TlsfAllocator::GetAllocatorStats(AllocatorStats& _stats)
+    {
+        _stats = m_tracker.GetStats();
+        _stats.m_totalFreeBytes = 0;
+        _stats.m_largestFreeBlock = 0;
+
+        const TlsfHeap::ControlBlock* control = GetControlBlock();
+        u32 flBitmap = control->m_flBitmap;
+        while (flBitmap != 0)
+        {
+            const u8 fl = BitUtils::GetLeastSignificantBit(flBitmap);
+            flBitmap &= flBitmap - 1;
+
+            u32 slBitmap = control->m_slBitmaps[fl];
+            while (slBitmap != 0)
+            {
+                const u8 sl = BitUtils::GetLeastSignificantBit(slBitmap);
+                slBitmap &= slBitmap - 1;
+
+                for (const TlsfHeap::BlockHeader* block = control->m_headerMap[fl][sl];
+                     block != &control->m_nullBlock;
+                     block = block->m_nextFreeBlock)
+                {
+                    _stats.m_totalFreeBytes += block->GetSize();
+                    _stats.m_largestFreeBlock = eastl::max(_stats.m_largestFreeBlock, block->GetSize());
+                }
+            }
+        }
         return true;
     }
 
@@ -452,4 +554,17 @@ namespace KryneEngine
         LinkNext(_left);
         return _left;
     }
+
+    size_t TlsfAllocator::GetAdditionalHeapPoolSize() const
+    {
+        // Matches the pool set up in `AddHeap()`
+        return Alignment::AlignDownPot(m_heapSize - sizeof(HeapLink) - TlsfHeap::kHeapPoolOverhead, TlsfHeap::kAlignmentPot);
+    }
+
+    bool TlsfAllocator::IsWholeAdditionalHeap(const TlsfHeap::BlockHeader* _block) const
+    {
+        // The initial heap pool is smaller than additional ones, as it also holds the allocator and its control block,
+        // so a block of this size can only be a whole additional heap pool.
+        return _block->GetSize() == GetAdditionalHeapPoolSize() && NextBlock(_block)->IsLast();
+    }
 } // namespace KryneEngine
\ No newline at end of file
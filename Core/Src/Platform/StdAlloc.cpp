@@ -8,6 +8,12 @@
 
 #include <new>
 
+#if defined(__APPLE__)
+#   include <malloc/malloc.h>
+#elif defined(__linux__)
+#   include <malloc.h>
+#endif
+
 namespace KryneEngine::StdAlloc
 {
     void* Malloc(size_t _size)
@@ -33,6 +39,22 @@ namespace KryneEngine::StdAlloc
         _aligned_free(_ptr);
 #else
         free(_ptr);
+#endif
+    }
+
+    size_t GetAllocationSize(void* _ptr)
+    {
+        if (_ptr == nullptr)
+        {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return malloc_size(_ptr);
+#elif defined(__linux__)
+        return malloc_usable_size(_ptr);
+#else
+        // _aligned_msize() requires the alignment the block was allocated with, which isn't known on free.
+        return 0;
 #endif
     }
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Platform/VirtualMemory.hpp"
+
+#if defined(_WIN32)
+#   include "KryneEngine/Core/Platform/Windows.h"
+#else
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+namespace KryneEngine::VirtualMemory
+{
+    size_t GetPageSize()
+    {
+#if defined(_WIN32)
+        static const size_t pageSize = []
+        {
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            return static_cast<size_t>(systemInfo.dwPageSize);
+        }();
+#else
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        return pageSize;
+    }
+
+    size_t GetReservationGranularity()
+    {
+#if defined(_WIN32)
+        static const size_t granularity = []
+        {
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            return static_cast<size_t>(systemInfo.dwAllocationGranularity);
+        }();
+        return granularity;
+#else
+        return GetPageSize();
+#endif
+    }
+
+    void* Reserve(size_t _size)
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, _size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        void* ptr = mmap(nullptr, _size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+    }
+
+    bool Commit(void* _ptr, size_t _size)
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(_ptr, _size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+        return mprotect(_ptr, _size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    void Decommit(void* _ptr, size_t _size)
+    {
+#if defined(_WIN32)
+        VirtualFree(_ptr, _size, MEM_DECOMMIT);
+#else
+        // Drop the physical pages first, so they are zeroed if committed again.
+        madvise(_ptr, _size, MADV_DONTNEED);
+        mprotect(_ptr, _size, PROT_NONE);
+#endif
+    }
+
+    void Release(void* _ptr, size_t _size)
+    {
+#if defined(_WIN32)
+        VirtualFree(_ptr, 0, MEM_RELEASE);
+#else
+        munmap(_ptr, _size);
+#endif
+    }
+}
@@ -273,21 +273,29 @@ namespace KryneEngine
             TracyLockable(std::mutex, waitMutex);
             struct Data {
                 std::condition_variable_any m_waitVariable {};
+                LockableBase(std::mutex)* m_waitMutex;
                 SyncCounterId m_syncCounterId;
+                bool m_done = false;
             } data;
 
+            data.m_waitMutex = &waitMutex;
             data.m_syncCounterId = _syncCounter;
 
             constexpr auto jobFunction = [](void* _dataPtr)
             {
                 auto* data = static_cast<Data*>(_dataPtr);
                 FibersManager::GetInstance()->WaitForCounter(data->m_syncCounterId);
+
+                // Notify under the lock, as the waiting thread may be woken up spuriously and release `data` as soon
+                // as it sees `m_done`. The flag also covers the job completing before the thread started waiting.
+                const std::lock_guard<LockableBase(std::mutex)> lock(*data->m_waitMutex);
+                data->m_done = true;
                 data->m_waitVariable.notify_one();
             };
             SyncCounterId id = InitAndBatchJobs(jobFunction, &data);
 
             std::unique_lock<LockableBase(std::mutex)> lock(waitMutex);
-            data.m_waitVariable.wait(lock);
+            data.m_waitVariable.wait(lock, [&data] { return data.m_done; });
 
             ResetCounter(id);
         }
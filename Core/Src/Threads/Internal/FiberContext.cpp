@@ -102,6 +102,7 @@ namespace KryneEngine
     }
 
     FiberContextAllocator::FiberContextAllocator(AllocatorInstance _allocator)
+        : m_stackAllocator(_allocator)
     {
         {
             const auto smallLock = m_availableSmallContextsIds.m_spinLock.AutoLock();
@@ -164,9 +165,10 @@ namespace KryneEngine
 
     FiberContextAllocator::~FiberContextAllocator()
     {
-        AllocatorInstance allocator {};
-        allocator.deallocate(m_smallStacks);
-        allocator.deallocate(m_bigStacks);
+        // Stacks can be big enough to come from a page provider (see `HugePageAllocator`), so give them back to the
+        // allocator they come from.
+        m_stackAllocator.deallocate(m_smallStacks, sizeof(SmallStack) * static_cast<size_t>(kSmallStackCount));
+        m_stackAllocator.deallocate(m_bigStacks, sizeof(BigStack) * static_cast<size_t>(kBigStackCount));
     }
 
     bool FiberContextAllocator::Allocate(bool _bigStack, u16 &id_)
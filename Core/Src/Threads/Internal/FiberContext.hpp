@@ -79,6 +79,8 @@ namespace KryneEngine
 
         eastl::array<FiberContext, kSmallStackCount + kBigStackCount> m_contexts {};
 
+        AllocatorInstance m_stackAllocator;
+
         using SmallStack = u8[kSmallStackSize];
         SmallStack* m_smallStacks = nullptr;
 
@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include "KryneEngine/Core/Threads/ThreadSlots.hpp"
+
+#include <atomic>
+
+#include "KryneEngine/Core/Common/BitUtils.hpp"
+
+namespace KryneEngine::Threads
+{
+    namespace
+    {
+        static_assert(kMaxThreadSlots == 64, "Slots are tracked in a single 64-bit mask");
+
+        // Set once the slot was released, so thread-local destructors running after the release don't acquire it back.
+        constexpr u32 kReleasedThreadSlot = kNoThreadSlot - 1;
+
+        std::atomic<u64> s_usedSlots = 0;
+
+        struct ThreadSlotReleaser
+        {
+            u32 m_slot = kNoThreadSlot;
+
+            ~ThreadSlotReleaser()
+            {
+                if (m_slot < kMaxThreadSlots)
+                {
+                    // Release, so the next owner of the slot sees all the writes done through it by this thread.
+                    s_usedSlots.fetch_and(~(1ull << m_slot), std::memory_order_release);
+                }
+                Internal::t_threadSlot = kReleasedThreadSlot;
+            }
+        };
+
+        thread_local ThreadSlotReleaser t_threadSlotReleaser;
+    }
+
+    u32 Internal::AcquireThreadSlot()
+    {
+        if (t_threadSlot == kReleasedThreadSlot)
+            return kNoThreadSlot;
+
+        u64 usedSlots = s_usedSlots.load(std::memory_order_relaxed);
+        u32 slot;
+        do
+        {
+            if (usedSlots == ~0ull)
+                return kNoThreadSlot;
+            slot = BitUtils::GetLeastSignificantBit(~usedSlots);
+        }
+        while (!s_usedSlots.compare_exchange_weak(
+            usedSlots,
+            usedSlots | (1ull << slot),
+            std::memory_order_acquire,
+            std::memory_order_relaxed));
+
+        // First access to the releaser, which registers its destructor for the thread exit.
+        t_threadSlotReleaser.m_slot = slot;
+        t_threadSlot = slot;
+        return slot;
+    }
+}
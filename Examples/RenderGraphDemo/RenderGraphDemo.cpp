@@ -251,7 +251,7 @@ int main()
     {
         RenderGraph::PassDeclaration gBufferDummyPass(Modules::RenderGraph::PassType::Render, 0);
         RenderGraph::PassDeclarationBuilder(gBufferDummyPass, nullptr)
-            .SetName("GBuffer pass")
+            .SetName(KE_SH("GBuffer pass"))
             .AddColorAttachment(gBufferAlbedoRtv)
                 .SetLoadOperation(RenderPassDesc::Attachment::LoadOperation::DontCare)
                 .SetStoreOperation(RenderPassDesc::Attachment::StoreOperation::Store)
@@ -316,7 +316,7 @@ int main()
 
             RenderGraph::PassDeclaration imguiDummyPass(Modules::RenderGraph::PassType::Render, 0);
             RenderGraph::PassDeclarationBuilder(imguiDummyPass, nullptr)
-                .SetName("ImGui pass")
+                .SetName(KE_SH("ImGui pass"))
                 .AddColorAttachment(swapChainRtvs[0])
                     .SetLoadOperation(RenderPassDesc::Attachment::LoadOperation::Load)
                     .SetStoreOperation(RenderPassDesc::Attachment::StoreOperation::Store)
@@ -359,7 +359,7 @@ int main()
 
             builder
                 .DeclarePass(RenderGraph::PassType::Render)
-                    .SetName("GBuffer pass")
+                    .SetName(KE_SH("GBuffer pass"))
                     .SetExecuteFunction([&sceneManager](const auto& _, const auto& _passData)
                         {
                             KE_ZoneScoped("Render GBuffer");
@@ -381,7 +381,7 @@ int main()
                     .ReadDependency(frameCBufferReadDep)
                     .Done()
                 .DeclarePass(RenderGraph::PassType::Compute)
-                    .SetName("Deferred shadow pass")
+                    .SetName(KE_SH("Deferred shadow pass"))
                     .SetExecuteFunction([&deferredShadowPass](const auto&, const auto& _passData) { deferredShadowPass.Render(_passData); })
                     .ReadDependency(frameCBufferReadDep)
                     .ReadDependency({
@@ -399,7 +399,7 @@ int main()
                     })
                     .Done()
                 .DeclarePass(RenderGraph::PassType::Compute)
-                    .SetName("Deferred 'GI' pass")
+                    .SetName(KE_SH("Deferred 'GI' pass"))
                     .SetExecuteFunction([&giPass](const auto&, const auto& _passData) { giPass.Render(_passData); })
                     .ReadDependency(frameCBufferReadDep)
                     .ReadDependency({
@@ -429,7 +429,7 @@ int main()
                     })
                     .Done()
                 .DeclarePass(Modules::RenderGraph::PassType::Render)
-                    .SetName("Deferred shading pass")
+                    .SetName(KE_SH("Deferred shading pass"))
                     .SetRenderPassCallback([&deferredShadingPass](auto* _graphicsContext, RenderPassHandle _renderPass) { deferredShadingPass.CreatePso(_graphicsContext, _renderPass); })
                     .SetExecuteFunction([&deferredShadingPass](const auto& _, const auto& _passData) { deferredShadingPass.Render(_, _passData); })
                     .AddColorAttachment(hdrRtv)
@@ -470,7 +470,7 @@ int main()
                     })
                     .Done()
                 .DeclarePass(Modules::RenderGraph::PassType::Render)
-                    .SetName("Sky pass")
+                    .SetName(KE_SH("Sky pass"))
                     .SetRenderPassCallback([&skyPass](auto* _graphicsContext, RenderPassHandle _renderPass) { skyPass.CreatePso(_graphicsContext, _renderPass); })
                     .SetExecuteFunction([&skyPass](const auto& _renderGraph, const auto& _passData) { skyPass.Render(_renderGraph, _passData); })
                     .AddColorAttachment(hdrRtv)
@@ -484,7 +484,7 @@ int main()
                     .ReadDependency(frameCBufferReadDep)
                     .Done()
                 .DeclarePass(Modules::RenderGraph::PassType::Render)
-                    .SetName("Color mapping pass")
+                    .SetName(KE_SH("Color mapping pass"))
                     .SetRenderPassCallback([&colorMappingPass](auto* _graphicsContext, auto _renderPass) { colorMappingPass.CreatePso(_graphicsContext, _renderPass); })
                     .SetExecuteFunction([&colorMappingPass](const auto& _renderGraph, const auto& _passData) { colorMappingPass.Render(_renderGraph, _passData); })
                     .AddColorAttachment(swapChainRtv)
@@ -513,7 +513,7 @@ int main()
 
             builder
                 .DeclarePass(RenderGraph::PassType::Render)
-                .SetName("ImGui pass")
+                .SetName(KE_SH("ImGui pass"))
                 .SetExecuteFunction(executeFunction)
                 .AddColorAttachment(swapChainRtv)
                     .SetLoadOperation(RenderPassDesc::Attachment::LoadOperation::Load)
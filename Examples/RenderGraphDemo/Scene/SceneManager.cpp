@@ -167,7 +167,7 @@ namespace KryneEngine::Samples::RenderGraphDemo
 
         _builder
             .DeclarePass(Modules::RenderGraph::PassType::Transfer)
-            .SetName("Scene data transfer pass")
+            .SetName(KE_SH("Scene data transfer pass"))
             .SetExecuteFunction(transferExecuteFunction)
             .WriteDependency({
                 .m_resource = m_cbRenderGraphHandles[index],
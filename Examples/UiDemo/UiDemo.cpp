@@ -95,8 +95,8 @@ s32 main(s32 argc, const char** argv)
 
     Modules::TextRendering::MsdfAtlasManager msdfAtlasManager(allocatorInstance, *graphicsContext, &fontManager, 1024, 32);
 
-    const StringHash notoFontPath { "Resources/Modules/TextRendering/NotoSerif-Regular.ttf" };
-    Modules::Resources::ResourceEntry* notFontEntry = resourceSystem.GetResourceEntry<Modules::TextRendering::Font>(notoFontPath);
+    constexpr eastl::string_view notoFontPath = "Resources/Modules/TextRendering/NotoSerif-Regular.ttf";
+    Modules::Resources::ResourceEntry* notFontEntry = resourceSystem.GetResourceEntry<Modules::TextRendering::Font>(StringHash(notoFontPath));
     resourceSystem.LoadResource(notoFontPath, notFontEntry);
     auto* font = notFontEntry->UseResource<Modules::TextRendering::Font>();
 
@@ -64,6 +64,8 @@ namespace KryneEngine::Modules::RenderGraph
 
     public:
         PassDeclarationBuilder& SetName(const eastl::string_view& _name);
+        /// @brief Doesn't hash nor intern anything, use with `KE_SH("...")` to name a pass at no runtime cost.
+        PassDeclarationBuilder& SetName(const StringHash& _name);
         PassAttachmentDeclarationBuilder AddColorAttachment(SimplePoolHandle _texture);
         PassAttachmentDeclarationBuilder SetDepthAttachment(SimplePoolHandle _texture);
         PassDeclarationBuilder& ReadDependency(const Dependency& _dependency);
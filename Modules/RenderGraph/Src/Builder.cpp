@@ -304,14 +304,14 @@ namespace KryneEngine::Modules::RenderGraph
             {
                 std::cout
                     << eastl::string{}.sprintf(R"(  "[%lld] %s" -> "[%lld] %s";)",
-                                               i, m_declaredPasses[i].m_name.m_string.c_str(),
-                                               child, m_declaredPasses[child].m_name.m_string.c_str()).c_str()
+                                               i, m_declaredPasses[i].m_name.GetString(),
+                                               child, m_declaredPasses[child].m_name.GetString()).c_str()
                     << std::endl;
             }
             if (node.m_children.empty())
             {
                 std::cout
-                    << eastl::string{}.sprintf(R"(  "[%lld] %s";)", i, m_declaredPasses[i].m_name.m_string.c_str()).c_str()
+                    << eastl::string{}.sprintf(R"(  "[%lld] %s";)", i, m_declaredPasses[i].m_name.GetString()).c_str()
                     << std::endl;
             }
         }
@@ -335,14 +335,14 @@ namespace KryneEngine::Modules::RenderGraph
                 }
                 std::cout
                     << eastl::string{}.sprintf(R"(  "[%lld] %s" -> "[%lld] %s";)",
-                                               i, m_declaredPasses[i].m_name.m_string.c_str(),
-                                               child, m_declaredPasses[child].m_name.m_string.c_str()).c_str()
+                                               i, m_declaredPasses[i].m_name.GetString(),
+                                               child, m_declaredPasses[child].m_name.GetString()).c_str()
                     << std::endl;
             }
             if (node.m_children.empty())
             {
                 std::cout
-                    << eastl::string{}.sprintf(R"(  "[%lld] %s";)", i, m_declaredPasses[i].m_name.m_string.c_str()).c_str()
+                    << eastl::string{}.sprintf(R"(  "[%lld] %s";)", i, m_declaredPasses[i].m_name.GetString()).c_str()
                     << std::endl;
             }
         }
@@ -416,7 +416,7 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s";)",
                                       renderPasses[0],
-                                      m_declaredPasses[renderPasses[0]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[renderPasses[0]].m_name.GetString()).c_str()
                 << std::endl;
         }
         for (size_t i = 1; i < renderPasses.size(); i++)
@@ -426,9 +426,9 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s" -> "[%lld] %s";)",
                                       renderPasses[i - 1],
-                                      m_declaredPasses[renderPasses[i - 1]].m_name.m_string.c_str(),
+                                      m_declaredPasses[renderPasses[i - 1]].m_name.GetString(),
                                       renderPasses[i],
-                                      m_declaredPasses[renderPasses[i]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[renderPasses[i]].m_name.GetString()).c_str()
                 << std::endl;
         }
         std::cout << "\t}" << std::endl;
@@ -441,7 +441,7 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s";)",
                                       computePasses[0],
-                                      m_declaredPasses[computePasses[0]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[computePasses[0]].m_name.GetString()).c_str()
                 << std::endl;
         }
         for (size_t i = 1; i < computePasses.size(); i++)
@@ -451,9 +451,9 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s" -> "[%lld] %s";)",
                                       computePasses[i - 1],
-                                      m_declaredPasses[computePasses[i - 1]].m_name.m_string.c_str(),
+                                      m_declaredPasses[computePasses[i - 1]].m_name.GetString(),
                                       computePasses[i],
-                                      m_declaredPasses[computePasses[i]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[computePasses[i]].m_name.GetString()).c_str()
                 << std::endl;
         }
         std::cout << "\t}" << std::endl;
@@ -466,7 +466,7 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s";)",
                                       transferPasses[0],
-                                      m_declaredPasses[transferPasses[0]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[transferPasses[0]].m_name.GetString()).c_str()
                 << std::endl;
         }
         for (size_t i = 1; i < transferPasses.size(); i++)
@@ -476,9 +476,9 @@ namespace KryneEngine::Modules::RenderGraph
                 << eastl::string().sprintf(
                                       R"("[%lld] %s" -> "[%lld] %s";)",
                                       transferPasses[i - 1],
-                                      m_declaredPasses[transferPasses[i - 1]].m_name.m_string.c_str(),
+                                      m_declaredPasses[transferPasses[i - 1]].m_name.GetString(),
                                       transferPasses[i],
-                                      m_declaredPasses[transferPasses[i]].m_name.m_string.c_str()).c_str()
+                                      m_declaredPasses[transferPasses[i]].m_name.GetString()).c_str()
                 << std::endl;
         }
         std::cout << "\t}" << std::endl;
@@ -492,9 +492,9 @@ namespace KryneEngine::Modules::RenderGraph
                     << eastl::string().sprintf(
                                           R"("[%lld] %s" -> "[%lld] %s";)",
                                           dependencyPair.first,
-                                          m_declaredPasses[dependencyPair.first].m_name.m_string.c_str(),
+                                          m_declaredPasses[dependencyPair.first].m_name.GetString(),
                                           dependencyPair.second,
-                                          m_declaredPasses[dependencyPair.second].m_name.m_string.c_str()).c_str()
+                                          m_declaredPasses[dependencyPair.second].m_name.GetString()).c_str()
                     << std::endl;
             }
         }
@@ -34,6 +34,12 @@ namespace KryneEngine::Modules::RenderGraph
         return *this;
     }
 
+    PassDeclarationBuilder& PassDeclarationBuilder::SetName(const StringHash& _name)
+    {
+        m_item.m_name = _name;
+        return *this;
+    }
+
     PassAttachmentDeclarationBuilder PassDeclarationBuilder::AddColorAttachment(SimplePoolHandle _texture)
     {
         return { m_item.m_colorAttachments.emplace_back(_texture), this };
@@ -170,12 +170,12 @@ namespace KryneEngine::Modules::RenderGraph
                 jobData->m_passExecutionData.m_graphicsContext->GetProfilerContext(),
                 jobData->m_passExecutionData.m_commandList,
                 "%s",
-                pass.m_name.m_string.c_str());
+                pass.m_name.GetString());
 
             const std::chrono::time_point start = std::chrono::steady_clock::now();
             jobData->m_passExecutionData.m_graphicsContext->PushDebugMarker(
                 jobData->m_passExecutionData.m_commandList,
-                pass.m_name.m_string,
+                pass.m_name.GetString(),
                 ColorPalette::kWhite);
 
             if (GraphicsContext::SupportsNonGlobalBarriers())
@@ -289,7 +289,7 @@ namespace KryneEngine::Modules::RenderGraph
         }
 
 #if !defined(KE_FINAL)
-        desc.m_debugName = _passDeclaration.m_name.m_string;
+        desc.m_debugName = _passDeclaration.m_name.GetString();
 #endif
 
         const RenderPassHandle handle = _graphicsContext.CreateRenderPass(desc);
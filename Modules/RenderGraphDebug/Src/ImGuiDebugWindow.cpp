@@ -155,7 +155,7 @@ namespace KryneEngine::Modules::RenderGraph
                 Layer& layer = layers[layerIndex];
 
                 const float nodeWidth = eastl::max(
-                    ImGui::CalcTextSize(_builder.m_declaredPasses[i].m_name.m_string.c_str()).x + 2 * padding.x,
+                    ImGui::CalcTextSize(_builder.m_declaredPasses[i].m_name.GetString()).x + 2 * padding.x,
                     minNodeWidth);
                 layer.m_nodes.emplace_back(i, nodeWidth);
                 layer.m_totalWidth += nodeWidth;
@@ -477,7 +477,7 @@ namespace KryneEngine::Modules::RenderGraph
                             (nodeHeight + verticalSpacing) * static_cast<float>(layersIndices[i]) - nodeHeight / 2.f);
                     ImGui::SetCursorScreenPos(rectMin + padding);
                     ImGui::BeginGroup();
-                    ImGui::Text("%s", _builder.m_declaredPasses[i].m_name.m_string.c_str());
+                    ImGui::Text("%s", _builder.m_declaredPasses[i].m_name.GetString());
                     ImU32 color;
                     switch (_builder.m_declaredPasses[i].m_type)
                     {
@@ -663,7 +663,7 @@ namespace KryneEngine::Modules::RenderGraph
                     {
                         ImGui::Text(
                             "Used in pass '%s' as a %s (%s #%zu)",
-                            resourceUse.m_pass->m_name.m_string.c_str(),
+                            resourceUse.m_pass->m_name.GetString(),
                             useTypeNames[resourceUse.m_useType],
                             type,
                             trueResourceHandle);
@@ -672,7 +672,7 @@ namespace KryneEngine::Modules::RenderGraph
                     {
                         ImGui::Text(
                             "Used in pass '%s' as a %s (%s #%zu named '%s')",
-                            resourceUse.m_pass->m_name.m_string.c_str(),
+                            resourceUse.m_pass->m_name.GetString(),
                             useTypeNames[resourceUse.m_useType],
                             type,
                             trueResourceHandle,
@@ -683,7 +683,7 @@ namespace KryneEngine::Modules::RenderGraph
                 {
                     ImGui::Text(
                         "Used in pass '%s' as a %s",
-                        resourceUse.m_pass->m_name.m_string.c_str(),
+                        resourceUse.m_pass->m_name.GetString(),
                         useTypeNames[resourceUse.m_useType]);
                 }
             }
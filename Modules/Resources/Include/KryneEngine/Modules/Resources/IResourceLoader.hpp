@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <KryneEngine/Core/Common/StringHelpers.hpp>
+#include <EASTL/string_view.h>
 
 namespace KryneEngine::Modules::Resources
 {
@@ -18,6 +18,10 @@ namespace KryneEngine::Modules::Resources
     public:
         virtual ~IResourceLoader() = default;
 
-        virtual void RequestLoad(const StringHash& _path, ResourceEntry* _entry, IResourceManager* _resourceManager) = 0;
+        /**
+         * @param _path Only valid during the call, loaders deferring the load must copy it. Passed as a string rather
+         * than a `StringHash`, as hash names can be stripped.
+         */
+        virtual void RequestLoad(eastl::string_view _path, ResourceEntry* _entry, IResourceManager* _resourceManager) = 0;
     };
 }
@@ -10,6 +10,7 @@
 
 
 #include <EASTL/vector_set.h>
+#include <KryneEngine/Core/Common/StringHelpers.hpp>
 #include <KryneEngine/Core/Threads/SpinLock.hpp>
 
 #include "KryneEngine/Modules/Resources/IResourceLoader.hpp"
@@ -21,7 +22,7 @@ namespace KryneEngine::Modules::Resources
     public:
         explicit SerialResourceLoader(AllocatorInstance _allocator);
 
-        void RequestLoad(const StringHash& _path, ResourceEntry* _entry, IResourceManager* _resourceManager) override;
+        void RequestLoad(eastl::string_view _path, ResourceEntry* _entry, IResourceManager* _resourceManager) override;
 
     private:
         eastl::vector_set<StringHash> m_pendingRequests;
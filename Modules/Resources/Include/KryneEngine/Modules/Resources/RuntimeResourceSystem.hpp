@@ -41,7 +41,8 @@ namespace KryneEngine::Modules::Resources
         template <class Resource> [[nodiscard]] ResourceEntry* GetResourceEntry(const StringHash& _name) { return GetResourceEntry(_name, Resource::kTypeId); }
         [[nodiscard]] ResourceEntry* GetResourceEntry(const StringHash& _name, u64 _typeId);
 
-        void LoadResource(const StringHash& _name, ResourceEntry* _entry);
+        /// @param _path Path of the resource, from which the entry name was hashed.
+        void LoadResource(eastl::string_view _path, ResourceEntry* _entry);
 
     private:
         AllocatorInstance m_allocator;
@@ -18,22 +18,25 @@ namespace KryneEngine::Modules::Resources
     {}
 
     void SerialResourceLoader::RequestLoad(
-        const StringHash& _path, ResourceEntry* _entry, IResourceManager* _resourceManager)
+        eastl::string_view _path, ResourceEntry* _entry, IResourceManager* _resourceManager)
     {
+        const StringHash pathHash(StringHash::Hash64(_path));
         {
             const auto lock = m_lock.AutoLock();
-            if (m_pendingRequests.find(_path) == m_pendingRequests.end())
-                m_pendingRequests.emplace(_path);
+            if (m_pendingRequests.find(pathHash) == m_pendingRequests.end())
+                m_pendingRequests.emplace(pathHash);
             else
                 return;
         }
 
         {
-            std::ifstream file(_path.m_string.c_str(), std::ios::binary);
+            // Null terminated copy, for the file stream and the resource manager.
+            const eastl::string path(_path);
+            std::ifstream file(path.c_str(), std::ios::binary);
 
             if (!file)
             {
-                _resourceManager->ReportFailedLoad(_entry, _path.m_string);
+                _resourceManager->ReportFailedLoad(_entry, path);
             }
             else
             {
@@ -47,13 +50,13 @@ namespace KryneEngine::Modules::Resources
                 _resourceManager->LoadResource(
                     _entry,
                     {static_cast<std::byte*>(buffer), static_cast<size_t>(size)},
-                    _path.m_string);
+                    path);
             }
         }
 
         {
             const auto lock = m_lock.AutoLock();
-            m_pendingRequests.erase(_path);
+            m_pendingRequests.erase(pathHash);
         }
     }
 } // namespace KryneEngine::Modules::Resources
\ No newline at end of file
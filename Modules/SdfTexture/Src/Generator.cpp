@@ -120,6 +120,9 @@ namespace KryneEngine::Modules::SdfTexture
 
         m_outputBuffer = m_allocator.Allocate<Math::Float16>(m_dimensions.x * m_dimensions.y * m_dimensions.z);
 
+        // Distances are converted to half precision one row at a time, using the bulk conversion.
+        float* rowDistances = m_allocator.Allocate<float>(m_dimensions.x);
+
         for (u32 z = 0; z < m_dimensions.z; z++)
         {
             for (u32 y = 0; y < m_dimensions.y; y++)
@@ -143,10 +146,15 @@ namespace KryneEngine::Modules::SdfTexture
                         }
                     }
 
-                    m_outputBuffer[x + y * m_dimensions.x + z * m_dimensions.x * m_dimensions.y] = Math::Float16 { dist };
+                    rowDistances[x] = dist;
                 }
+
+                Math::Float16* row = m_outputBuffer + y * m_dimensions.x + z * m_dimensions.x * m_dimensions.y;
+                Math::Float16::ConvertToFloat16(rowDistances, reinterpret_cast<u16*>(row), m_dimensions.x);
             }
         }
+
+        m_allocator.deallocate(rowDistances);
     }
 
     float
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <thread>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Common/StringHelpers.hpp>
+#include <KryneEngine/Core/Common/StringInterning.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(StringInterning, Intern)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        const eastl::string name = "StringInterning.Intern/Name";
+        const eastl::string sameName = name;
+        const u64 hash = StringHash::Hash64(name);
+
+        const StringInterning::Stats initialStats = StringInterning::GetStats();
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(StringInterning::Find(hash), nullptr);
+
+        const char* interned = StringInterning::Intern(name, hash);
+        EXPECT_NE(interned, name.c_str());
+        EXPECT_STREQ(interned, name.c_str());
+        EXPECT_EQ(StringInterning::Find(hash), interned);
+
+        // Same string from another buffer gives back the same copy
+        EXPECT_EQ(StringInterning::Intern(sameName, hash), interned);
+        EXPECT_STREQ(StringInterning::Intern("", 0), "");
+
+        const StringInterning::Stats stats = StringInterning::GetStats();
+        EXPECT_EQ(stats.m_stringCount, initialStats.m_stringCount + 1);
+        EXPECT_EQ(stats.m_internCount, initialStats.m_internCount + 2);
+        EXPECT_EQ(stats.m_stringBytes, initialStats.m_stringBytes + name.size() + 1);
+        EXPECT_EQ(stats.m_deduplicatedBytes, initialStats.m_deduplicatedBytes + name.size() + 1);
+        EXPECT_GE(stats.m_arenaBytes, stats.m_stringBytes);
+
+        // Strings bigger than the arena chunks are supported
+        const eastl::string longName(100'000, 'x');
+        const char* longInterned = StringInterning::Intern(longName, StringHash::Hash64(longName));
+        EXPECT_EQ(eastl::string_view(longInterned), longName);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(StringInterning, StringHash)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        const eastl::string name = "StringInterning.StringHash/Name";
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        const StringHash first(name);
+        const StringHash second(eastl::string_view { name });
+        EXPECT_EQ(first, second);
+
+        EXPECT_STREQ(StringHash(0ull).GetString(), "");
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+        EXPECT_STREQ(first.GetString(), name.c_str());
+        EXPECT_EQ(first.GetString(), second.GetString());
+#else
+        EXPECT_STREQ(first.GetString(), "");
+#endif
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(StringInterning, Literals)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr StringHash literal = KE_SH("StringInterning.Literals/Name");
+        static_assert(literal.m_hash == StringHash::Hash64("StringInterning.Literals/Name"));
+
+        // UTF-8 "Crème brûlée", so full 8 bytes blocks contain non ASCII characters.
+        static constexpr char nonAscii[] = "Cr\xc3\xa8me br\xc3\xbbl\xc3\xa9" "e";
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Compile time hashes match the runtime ones
+        EXPECT_EQ(literal, StringHash(eastl::string_view("StringInterning.Literals/Name")));
+        EXPECT_EQ(KE_SH(nonAscii), StringHash(eastl::string_view(nonAscii)));
+
+#if !defined(KE_STRIP_STRING_HASH_NAMES)
+        EXPECT_STREQ(literal.GetString(), "StringInterning.Literals/Name");
+#endif
+
+        // Literals are referenced as is, and don't go through the interning table
+        const u64 internCount = StringInterning::GetStats().m_internCount;
+        const StringHash other = "StringInterning.Literals/Other"_sh;
+        EXPECT_EQ(StringInterning::Find(other.m_hash), nullptr);
+        EXPECT_EQ(StringInterning::GetStats().m_internCount, internCount);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(StringInterning, MultiThreaded)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr u32 threadCount = 8;
+        constexpr u32 stringCount = 2048;
+
+        eastl::vector<eastl::string> strings;
+        for (u32 i = 0; i < stringCount; i++)
+        {
+            strings.push_back(eastl::string().sprintf("StringInterning.MultiThreaded/%u", i));
+        }
+
+        eastl::vector<eastl::vector<const char*>> results(threadCount);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<std::thread> threads;
+        for (u32 t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&, t]
+            {
+                results[t].resize(stringCount);
+                // Each thread goes through the strings in a different order, odd factors being coprime with the count
+                for (u32 i = 0; i < stringCount; i++)
+                {
+                    const u32 index = (i * (2 * t + 1)) % stringCount;
+                    results[t][index] = StringInterning::Intern(strings[index], StringHash::Hash64(strings[index]));
+                }
+            });
+        }
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        for (u32 i = 0; i < stringCount; i++)
+        {
+            EXPECT_STREQ(results[0][i], strings[i].c_str());
+            for (u32 t = 1; t < threadCount; t++)
+            {
+                EXPECT_EQ(results[t][i], results[0][i]);
+            }
+        }
+
+        catcher.ExpectNoMessage();
+    }
+}
@@ -0,0 +1,203 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+
+#include "Files/FileHandleCache.hpp"
+#include "Utils/AssertUtils.hpp"
+#include "Utils/ScopedTestFile.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        /// Each file gets a different size, to check handles refer to the right file.
+        struct TestFiles
+        {
+            ScopedTestFile m_a { "KE_FileHandleCache_A.bin" };
+            ScopedTestFile m_b { "KE_FileHandleCache_B.bin" };
+            ScopedTestFile m_c { "KE_FileHandleCache_C.bin" };
+
+            TestFiles()
+            {
+                m_a.WriteContent(eastl::vector<u8>(10, 0xA));
+                m_b.WriteContent(eastl::vector<u8>(20, 0xB));
+                m_c.WriteContent(eastl::vector<u8>(30, 0xC));
+            }
+        };
+
+        // Descriptors are only checked when no file was opened since they might have been closed, so closed descriptors
+        // can't have been reused by the OS.
+        bool IsOpen(const FileHandleCache::CachedHandle& _handle)
+        {
+            return NativeFile::GetSize(_handle.m_handle) >= 0;
+        }
+    }
+
+    TEST(FileHandleCache, LruEviction)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const TestFiles files;
+        FileHandleCache cache { AllocatorInstance(), 2 };
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        const FileHandleCache::CachedHandle a = cache.Acquire(files.m_a.GetPath());
+        ASSERT_TRUE(a.IsValid());
+        EXPECT_EQ(a.m_fileSize, 10);
+        cache.Release(a);
+
+        const FileHandleCache::CachedHandle b = cache.Acquire(files.m_b.GetPath());
+        ASSERT_TRUE(b.IsValid());
+        EXPECT_EQ(b.m_fileSize, 20);
+        cache.Release(b);
+
+        // Cache hit, which makes B the least recently used entry.
+        const FileHandleCache::CachedHandle aHit = cache.Acquire(files.m_a.GetPath());
+        EXPECT_EQ(aHit.m_handle, a.m_handle);
+        EXPECT_EQ(aHit.m_fileSize, 10);
+        cache.Release(aHit);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 2);
+
+        const FileHandleCache::CachedHandle c = cache.Acquire(files.m_c.GetPath());
+        ASSERT_TRUE(c.IsValid());
+        EXPECT_EQ(c.m_fileSize, 30);
+        cache.Release(c);
+
+        EXPECT_EQ(cache.GetOpenHandleCount(), 2);
+        EXPECT_TRUE(IsOpen(a));
+        EXPECT_FALSE(IsOpen(b));
+        EXPECT_TRUE(IsOpen(c));
+
+        // Shrinking evicts A, now the least recently used.
+        cache.SetMaxOpenHandles(1);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 1);
+        EXPECT_FALSE(IsOpen(a));
+        EXPECT_TRUE(IsOpen(c));
+
+        const FileHandleCache::CachedHandle cHit = cache.Acquire(files.m_c.GetPath());
+        EXPECT_EQ(cHit.m_handle, c.m_handle);
+        cache.Release(cHit);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FileHandleCache, NoEvictionWhileInUse)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const TestFiles files;
+        FileHandleCache cache { AllocatorInstance(), 2 };
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        const FileHandleCache::CachedHandle a = cache.Acquire(files.m_a.GetPath());
+        const FileHandleCache::CachedHandle b = cache.Acquire(files.m_b.GetPath());
+        ASSERT_TRUE(a.IsValid());
+        ASSERT_TRUE(b.IsValid());
+
+        // All handles are in use, so the cache goes above its limit.
+        const FileHandleCache::CachedHandle c = cache.Acquire(files.m_c.GetPath());
+        ASSERT_TRUE(c.IsValid());
+        EXPECT_EQ(cache.GetOpenHandleCount(), 3);
+
+        // Sharing an in-use handle doesn't open a new descriptor.
+        const FileHandleCache::CachedHandle aShared = cache.Acquire(files.m_a.GetPath());
+        EXPECT_EQ(aShared.m_handle, a.m_handle);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 3);
+
+        // C is the only unused handle once released, so it is the one evicted to shrink back to the limit.
+        cache.Release(c);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 2);
+        EXPECT_FALSE(IsOpen(c));
+        EXPECT_TRUE(IsOpen(a));
+        EXPECT_TRUE(IsOpen(b));
+
+        // A is still used through its shared reference.
+        cache.Release(a);
+        cache.Release(b);
+        cache.SetMaxOpenHandles(0);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 1);
+        EXPECT_TRUE(IsOpen(aShared));
+        EXPECT_FALSE(IsOpen(b));
+
+        cache.Release(aShared);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 0);
+        EXPECT_FALSE(IsOpen(aShared));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FileHandleCache, OrphanCleanup)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const TestFiles files;
+        FileHandleCache cache { AllocatorInstance() };
+
+        const FileHandleCache::CachedHandle a = cache.Acquire(files.m_a.GetPath());
+        const FileHandleCache::CachedHandle b = cache.Acquire(files.m_b.GetPath());
+        ASSERT_TRUE(a.IsValid());
+        ASSERT_TRUE(b.IsValid());
+        cache.Release(b);
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        // In use, so the descriptor stays open until released.
+        cache.Invalidate(files.m_a.GetPath());
+        EXPECT_EQ(cache.GetOpenHandleCount(), 2);
+        EXPECT_TRUE(IsOpen(a));
+
+        // Unused, so closed right away.
+        cache.Invalidate(files.m_b.GetPath());
+        EXPECT_EQ(cache.GetOpenHandleCount(), 1);
+        EXPECT_FALSE(IsOpen(b));
+
+        // Invalidated entries aren't handed out anymore.
+        const FileHandleCache::CachedHandle aReopened = cache.Acquire(files.m_a.GetPath());
+        ASSERT_TRUE(aReopened.IsValid());
+        EXPECT_NE(aReopened.m_handle, a.m_handle);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 2);
+
+        cache.Release(a);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 1);
+        EXPECT_FALSE(IsOpen(a));
+        EXPECT_TRUE(IsOpen(aReopened));
+
+        // Same for all entries at once.
+        cache.InvalidateAll();
+        EXPECT_EQ(cache.GetOpenHandleCount(), 1);
+        EXPECT_TRUE(IsOpen(aReopened));
+
+        cache.Release(aReopened);
+        EXPECT_EQ(cache.GetOpenHandleCount(), 0);
+        EXPECT_FALSE(IsOpen(aReopened));
+
+        catcher.ExpectNoMessage();
+
+        // The orphan was closed, its handle isn't known anymore.
+        cache.Release(aReopened);
+        catcher.ExpectMessageCount(1);
+        EXPECT_EQ(catcher.GetLastCaughtMessages().m_message, "Released a file handle that doesn't belong to this cache");
+    }
+}
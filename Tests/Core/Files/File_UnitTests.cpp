@@ -0,0 +1,189 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+
+#include "Files/File.hpp"
+#include "Utils/AssertUtils.hpp"
+#include "Utils/ScopedTestFile.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        eastl::vector<u8> MakeContent(u64 _size, u8 _seed)
+        {
+            eastl::vector<u8> content(_size);
+            for (u64 i = 0; i < _size; i++)
+            {
+                content[i] = static_cast<u8>(i * 7 + _seed);
+            }
+            return content;
+        }
+
+        bool IsIdentical(const ScopedTestFile& _file, eastl::vector<u8>& _content, bool _useHashSidecar = false)
+        {
+            File file(_file.GetPath());
+            return file.IsIdentical(_content.size(), _content.data(), _useHashSidecar);
+        }
+
+        bool WriteIfNotIdentical(const ScopedTestFile& _file, eastl::vector<u8>& _content, bool _useHashSidecar = false)
+        {
+            return File::WriteIfNotIdentical(_file.GetPath(), _content.size(), _content.data(), _useHashSidecar);
+        }
+    }
+
+    TEST(File, CompareContent)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_File_CompareContent.bin");
+
+        // Not a multiple of the chunk size, so the last chunk is partial.
+        eastl::vector<u8> content = MakeContent(2 * File::kCompareChunkSize + 123, 1);
+        file.WriteContent(content);
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_TRUE(IsIdentical(file, content));
+
+        // Differences in the first and last chunks.
+        {
+            eastl::vector<u8> other = content;
+            other.front()++;
+            EXPECT_FALSE(IsIdentical(file, other));
+        }
+        {
+            eastl::vector<u8> other = content;
+            other.back()++;
+            EXPECT_FALSE(IsIdentical(file, other));
+        }
+
+        // Size mismatches.
+        {
+            eastl::vector<u8> other(content.begin(), content.end() - 1);
+            EXPECT_FALSE(IsIdentical(file, other));
+        }
+        {
+            eastl::vector<u8> other = content;
+            other.push_back(0);
+            EXPECT_FALSE(IsIdentical(file, other));
+        }
+
+        // Missing file.
+        {
+            const ScopedTestFile missingFile("KE_File_CompareContent_Missing.bin");
+            EXPECT_FALSE(IsIdentical(missingFile, content));
+        }
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(File, WriteIfNotIdentical)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_File_WriteIfNotIdentical.bin");
+
+        eastl::vector<u8> content = MakeContent(File::kCompareChunkSize + 5, 2);
+        eastl::vector<u8> newContent = MakeContent(content.size(), 3);
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_TRUE(WriteIfNotIdentical(file, content));
+        EXPECT_EQ(file.ReadContent(), content);
+
+        EXPECT_FALSE(WriteIfNotIdentical(file, content));
+        EXPECT_EQ(file.ReadContent(), content);
+
+        EXPECT_TRUE(WriteIfNotIdentical(file, newContent));
+        EXPECT_EQ(file.ReadContent(), newContent);
+
+        // Shorter content erases the previous one.
+        eastl::vector<u8> shortContent = MakeContent(10, 4);
+        EXPECT_TRUE(WriteIfNotIdentical(file, shortContent));
+        EXPECT_EQ(file.ReadContent(), shortContent);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(File, HashSidecar)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_File_HashSidecar.bin");
+        const ScopedTestFile sidecarFile("KE_File_HashSidecar.bin.hash");
+
+        eastl::vector<u8> content = MakeContent(File::kCompareChunkSize + 5, 5);
+        eastl::vector<u8> newContent = MakeContent(content.size(), 6);
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_TRUE(WriteIfNotIdentical(file, content, true));
+        EXPECT_EQ(file.ReadContent(), content);
+        const eastl::vector<u8> sidecar = sidecarFile.ReadContent();
+        EXPECT_FALSE(sidecar.empty());
+
+        EXPECT_FALSE(WriteIfNotIdentical(file, content, true));
+        EXPECT_EQ(sidecarFile.ReadContent(), sidecar);
+
+        // An up-to-date sidecar is trusted, so the file isn't read: replace its content, but keep its size and last
+        // write time.
+        {
+            const auto lastWriteTime = std::filesystem::last_write_time(file.GetPath());
+            file.WriteContent(newContent);
+            std::filesystem::last_write_time(file.GetPath(), lastWriteTime);
+        }
+        EXPECT_TRUE(IsIdentical(file, content, true));
+        EXPECT_FALSE(IsIdentical(file, newContent, true));
+        EXPECT_FALSE(IsIdentical(file, content));
+        EXPECT_TRUE(IsIdentical(file, newContent));
+
+        // A sidecar with an outdated write time is ignored, and the content is compared instead.
+        file.WriteContent(content);
+        std::filesystem::last_write_time(
+            file.GetPath(),
+            std::filesystem::last_write_time(file.GetPath()) + std::chrono::seconds(10));
+        EXPECT_TRUE(IsIdentical(file, content, true));
+        EXPECT_FALSE(IsIdentical(file, newContent, true));
+
+        // The outdated sidecar is refreshed even if the file is identical.
+        EXPECT_FALSE(WriteIfNotIdentical(file, content, true));
+        EXPECT_NE(sidecarFile.ReadContent(), sidecar);
+
+        // Then trusted again.
+        {
+            const auto lastWriteTime = std::filesystem::last_write_time(file.GetPath());
+            file.WriteContent(newContent);
+            std::filesystem::last_write_time(file.GetPath(), lastWriteTime);
+        }
+        EXPECT_TRUE(IsIdentical(file, content, true));
+
+        // A corrupted sidecar is ignored.
+        sidecarFile.WriteContent(MakeContent(sidecar.size(), 7));
+        EXPECT_FALSE(IsIdentical(file, content, true));
+        EXPECT_TRUE(IsIdentical(file, newContent, true));
+
+        catcher.ExpectNoMessage();
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+
+#include "Files/IoQueryManager.hpp"
+#include "Files/NativeFile.hpp"
+#include "KryneEngine/Core/Common/Utils/Alignment.hpp"
+#include "Utils/AssertUtils.hpp"
+#include "Utils/ScopedTestFile.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        using Query = IoQueryManager::Query;
+
+        constexpr u64 kAlignment = NativeFile::kUnbufferedAlignment;
+
+        eastl::vector<u8> MakeContent(u64 _size)
+        {
+            eastl::vector<u8> content(_size);
+            for (u64 i = 0; i < _size; i++)
+            {
+                // Vary across blocks too, so misplaced blocks are caught.
+                content[i] = static_cast<u8>(i * 31 + (i >> 12));
+            }
+            return content;
+        }
+
+        bool SupportsUnbufferedReads(const ScopedTestFile& _file)
+        {
+            const NativeFile::Handle handle = NativeFile::Open(
+                _file.GetPath(),
+                NativeFile::OpenFlags::Read | NativeFile::OpenFlags::Unbuffered);
+            NativeFile::Close(handle);
+            return handle != NativeFile::kInvalidHandle;
+        }
+
+        /// Reads `[_offset, _offset + _size)` into `_data`, or into a manager-allocated buffer if `nullptr`.
+        Query ReadSync(const ScopedTestFile& _file, Query::ReadMode _mode, s64 _offset, u64 _size, u8* _data = nullptr)
+        {
+            Query query {};
+            query.m_type = Query::Type::Read;
+            query.m_readMode = _mode;
+            query.m_path = _file.GetPath();
+            query.m_offset = _offset;
+            query.m_size = _size;
+            query.m_data = _data;
+            query.m_closeFile = true;
+            IoQueryManager::MakeQuerySync(&query);
+            return query;
+        }
+
+        void ExpectContent(const Query& _query, const eastl::vector<u8>& _content, u64 _offset, u64 _size)
+        {
+            ASSERT_EQ(_query.m_size, _size);
+            ASSERT_LE(_offset + _size, _content.size());
+            EXPECT_EQ(memcmp(_query.m_data, _content.data() + _offset, _size), 0);
+        }
+    }
+
+    TEST(IoQueryManager, DirectRead)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_IoQueryManager_DirectRead.bin");
+
+        // Spans several bounce buffers, and doesn't end on a block boundary.
+        const eastl::vector<u8> content = MakeContent(2 * IoQueryManager::kDirectReadBufferSize + 3 * kAlignment + 123);
+        file.WriteContent(content);
+
+        if (!SupportsUnbufferedReads(file))
+        {
+            GTEST_SKIP() << "The temporary directory doesn't support unbuffered reads";
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        // Whole file into a manager-allocated buffer: aligned body, unaligned tail.
+        {
+            const Query query = ReadSync(file, Query::ReadMode::Direct, 0, UINT64_MAX);
+            EXPECT_TRUE(Alignment::IsAligned(reinterpret_cast<uintptr_t>(query.m_data), kAlignment));
+            EXPECT_EQ(query.m_fileSize, content.size());
+            EXPECT_EQ(query.m_file, nullptr);
+            ExpectContent(query, content, 0, content.size());
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+
+        // Unaligned head and tail.
+        {
+            const u64 offset = kAlignment + 17;
+            const u64 size = 2 * kAlignment + 100;
+            const Query query = ReadSync(file, Query::ReadMode::Direct, offset, size);
+            ExpectContent(query, content, offset, size);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+
+        // Range within a single block.
+        {
+            const u64 offset = 3 * kAlignment + 5;
+            const u64 size = 42;
+            const Query query = ReadSync(file, Query::ReadMode::Direct, offset, size);
+            ExpectContent(query, content, offset, size);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+
+        // Unaligned caller buffer, the whole range goes through bounce buffers.
+        {
+            eastl::vector<u8> buffer(content.size() + 1);
+            const Query query = ReadSync(file, Query::ReadMode::Direct, 0, content.size(), buffer.data() + 1);
+            ExpectContent(query, content, 0, content.size());
+        }
+
+        // Reads are clamped to the end of the file.
+        {
+            const u64 offset = content.size() - 1000;
+            const Query query = ReadSync(file, Query::ReadMode::Direct, offset, 10 * kAlignment);
+            ExpectContent(query, content, offset, 1000);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(IoQueryManager, AutoReadFallback)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_IoQueryManager_AutoReadFallback.bin");
+
+        const eastl::vector<u8> content = MakeContent(IoQueryManager::kDirectReadThreshold + kAlignment + 7);
+        file.WriteContent(content);
+
+        IoQueryManager::SimulateUnbufferedOpenFailure(true);
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        // Big enough for a direct read, falls back to a buffered read.
+        {
+            const u64 offset = 13;
+            const Query query = ReadSync(file, Query::ReadMode::Auto, offset, UINT64_MAX);
+            EXPECT_EQ(query.m_file, nullptr);
+            ExpectContent(query, content, offset, content.size() - offset);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+        catcher.ExpectNoMessage();
+
+        // Explicit direct reads don't fall back.
+        {
+            const Query query = ReadSync(file, Query::ReadMode::Direct, 0, content.size());
+            EXPECT_EQ(query.m_size, 0);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+        catcher.ExpectMessageCount(1);
+        EXPECT_EQ(catcher.GetLastCaughtMessages().m_message, "Error while opening file");
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        IoQueryManager::SimulateUnbufferedOpenFailure(false);
+    }
+}
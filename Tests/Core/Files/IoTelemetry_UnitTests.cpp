@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+
+#include "Files/IoTelemetry.hpp"
+#include "Utils/AssertUtils.hpp"
+#include "Utils/ScopedTestFile.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(LatencyHistogram, BucketBoundaries)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        using Histogram = LatencyHistogram;
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        // Small values are exact.
+        for (u32 value = 0; value < Histogram::kSubBucketCount; value++)
+        {
+            EXPECT_EQ(Histogram::GetBucketIndex(value), value);
+            EXPECT_EQ(Histogram::GetBucketUpperBound(value), value);
+        }
+
+        // First log-linear ranges.
+        EXPECT_EQ(Histogram::GetBucketIndex(32), 32);
+        EXPECT_EQ(Histogram::GetBucketIndex(63), 63);
+        EXPECT_EQ(Histogram::GetBucketIndex(64), 64);
+        EXPECT_EQ(Histogram::GetBucketIndex(65), 64);
+        EXPECT_EQ(Histogram::GetBucketIndex(66), 65);
+        EXPECT_EQ(Histogram::GetBucketUpperBound(64), 65);
+        EXPECT_EQ(Histogram::GetBucketIndex(128), 96);
+        EXPECT_EQ(Histogram::GetBucketUpperBound(96), 131);
+
+        // Buckets are contiguous: each upper bound is followed by the first value of the next bucket.
+        for (u32 index = 0; index < Histogram::kBucketCount - 1; index++)
+        {
+            const u64 upperBound = Histogram::GetBucketUpperBound(index);
+            EXPECT_EQ(Histogram::GetBucketIndex(upperBound), index) << "Bucket " << index;
+            EXPECT_EQ(Histogram::GetBucketIndex(upperBound + 1), index + 1) << "Bucket " << index;
+        }
+
+        // Values above the max value are clamped to the last bucket.
+        EXPECT_EQ(Histogram::GetBucketIndex((1ull << (Histogram::kMaxValueBits + 1)) - 1), Histogram::kBucketCount - 1);
+        EXPECT_EQ(Histogram::GetBucketIndex(1ull << (Histogram::kMaxValueBits + 1)), Histogram::kBucketCount - 1);
+        EXPECT_EQ(Histogram::GetBucketIndex(UINT64_MAX), Histogram::kBucketCount - 1);
+
+        // Bounded relative error, for random magnitudes up to the max value.
+        std::mt19937_64 generator(42);
+        for (u32 i = 0; i < 10'000; i++)
+        {
+            const u64 shift = 64 - Histogram::kMaxValueBits + generator() % Histogram::kMaxValueBits;
+            const u64 value = generator() >> shift;
+            const u64 upperBound = Histogram::GetBucketUpperBound(Histogram::GetBucketIndex(value));
+            EXPECT_GE(upperBound, value);
+            EXPECT_LE(upperBound - value, value / Histogram::kSubBucketCount) << "Value " << value;
+        }
+    }
+
+    TEST(LatencyHistogram, Percentiles)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        LatencyHistogram histogram;
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(histogram.ComputeStats().m_count, 0);
+
+        // Exact values: 100 samples of 10, and a single outlier.
+        for (u32 i = 0; i < 100; i++)
+        {
+            histogram.Record(10);
+        }
+        histogram.Record(20);
+        {
+            const LatencyHistogram::Stats stats = histogram.ComputeStats();
+            EXPECT_EQ(stats.m_count, 101);
+            EXPECT_EQ(stats.m_min, 10);
+            EXPECT_EQ(stats.m_max, 20);
+            EXPECT_EQ(stats.m_mean, 10);
+            EXPECT_EQ(stats.m_p50, 10);
+            EXPECT_EQ(stats.m_p90, 10);
+            EXPECT_EQ(stats.m_p99, 10);
+            EXPECT_EQ(stats.m_p999, 20);
+        }
+
+        // Uniform values in [1, 1000], percentiles are reported as their bucket upper bound.
+        histogram.Reset();
+        for (u64 value = 1; value <= 1000; value++)
+        {
+            histogram.Record(value);
+        }
+        {
+            const LatencyHistogram::Stats stats = histogram.ComputeStats();
+            EXPECT_EQ(stats.m_count, 1000);
+            EXPECT_EQ(stats.m_min, 1);
+            EXPECT_EQ(stats.m_max, 1000);
+            EXPECT_EQ(stats.m_mean, 500);
+            EXPECT_EQ(stats.m_p50, 503);
+            EXPECT_EQ(stats.m_p90, 911);
+            EXPECT_EQ(stats.m_p99, 991);
+            EXPECT_EQ(stats.m_p999, 1000); // Clamped to the max
+        }
+
+        // Reported percentiles never exceed the max.
+        histogram.Reset();
+        histogram.Record(1000);
+        {
+            const LatencyHistogram::Stats stats = histogram.ComputeStats();
+            EXPECT_EQ(stats.m_count, 1);
+            EXPECT_EQ(stats.m_p50, 1000);
+            EXPECT_EQ(stats.m_p999, 1000);
+        }
+    }
+
+    TEST(IoTelemetry, TransferredBytes)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        using Query = IoQueryManager::Query;
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_IoTelemetry_TransferredBytes.bin");
+        const ScopedTestFile missingFile("KE_IoTelemetry_TransferredBytes_Missing.bin");
+
+        eastl::vector<u8> content(1000, 0x42);
+
+        // Statistics are process-wide, so only differences are checked.
+        IoTelemetry& telemetry = IoQueryManager::GetTelemetry();
+        const IoTelemetry::Snapshot initial = telemetry.TakeSnapshot();
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        {
+            Query query {};
+            query.m_type = Query::Type::Write;
+            query.m_path = file.GetPath();
+            query.m_data = content.data();
+            query.m_size = content.size();
+            query.m_destroyOnOpen = true;
+            query.m_closeFile = true;
+            IoQueryManager::MakeQuerySync(&query);
+        }
+
+        // Requests more than the file holds.
+        {
+            Query query {};
+            query.m_type = Query::Type::Read;
+            query.m_path = file.GetPath();
+            query.m_offset = 100;
+            query.m_size = 10'000;
+            query.m_closeFile = true;
+            IoQueryManager::MakeQuerySync(&query);
+            IoQueryManager::FreeQueryData(query.m_data);
+        }
+
+        // Fails.
+        {
+            Query query {};
+            query.m_type = Query::Type::Read;
+            query.m_path = missingFile.GetPath();
+            query.m_size = 10'000;
+            query.m_closeFile = true;
+            IoQueryManager::MakeQuerySync(&query);
+            EXPECT_EQ(query.m_size, 0);
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        catcher.ExpectMessageCount(1);
+        EXPECT_EQ(catcher.GetLastCaughtMessages().m_message, "No such file");
+
+        const IoTelemetry::Snapshot snapshot = telemetry.TakeSnapshot();
+        EXPECT_EQ(snapshot.m_bytesWritten - initial.m_bytesWritten, content.size());
+        EXPECT_EQ(snapshot.m_bytesRead - initial.m_bytesRead, content.size() - 100);
+        EXPECT_EQ(snapshot[Query::Type::Write].m_queryCount - initial[Query::Type::Write].m_queryCount, 1);
+        EXPECT_EQ(snapshot[Query::Type::Read].m_queryCount - initial[Query::Type::Read].m_queryCount, 2);
+
+        // Sync queries skip the queue.
+        EXPECT_EQ(
+            snapshot[Query::Type::Read].m_queueLatency.m_count,
+            initial[Query::Type::Read].m_queueLatency.m_count);
+        EXPECT_EQ(
+            snapshot[Query::Type::Read].m_serviceLatency.m_count - initial[Query::Type::Read].m_serviceLatency.m_count,
+            2);
+    }
+}
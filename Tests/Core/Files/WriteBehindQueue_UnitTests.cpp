@@ -0,0 +1,269 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+
+#include "Files/WriteBehindQueue.hpp"
+#include "Utils/AssertUtils.hpp"
+#include "Utils/ScopedTestFile.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        using Query = IoQueryManager::Query;
+
+        struct Write
+        {
+            u64 m_offset;
+            eastl::vector<u8> m_data;
+        };
+
+        Write MakeWrite(u64 _offset, u64 _size, u8 _value)
+        {
+            return { _offset, eastl::vector<u8>(_size, _value) };
+        }
+
+        void PrepareWriteQuery(Query& _query, const char* _path, Write& _write)
+        {
+            _query.m_type = Query::Type::Write;
+            _query.m_writeMode = Query::WriteMode::WriteBehind;
+            _query.m_path = _path;
+            _query.m_offset = static_cast<s64>(_write.m_offset);
+            _query.m_data = _write.m_data.data();
+            _query.m_size = _write.m_data.size();
+        }
+
+        // Later writes overwrite earlier ones, holes are left zeroed.
+        eastl::vector<u8> ComputeExpectedContent(const eastl::vector<Write>& _writes)
+        {
+            eastl::vector<u8> content;
+            for (const Write& write: _writes)
+            {
+                if (content.size() < write.m_offset + write.m_data.size())
+                {
+                    content.resize(write.m_offset + write.m_data.size(), 0);
+                }
+                memcpy(content.data() + write.m_offset, write.m_data.data(), write.m_data.size());
+            }
+            return content;
+        }
+
+        /// Queues all `_writes` to the same file, then flushes it and checks all queries completed.
+        void ProcessWrites(WriteBehindQueue& _queue, const ScopedTestFile& _file, eastl::vector<Write>& _writes)
+        {
+            eastl::vector<Query> queries(_writes.size());
+            for (size_t i = 0; i < _writes.size(); i++)
+            {
+                PrepareWriteQuery(queries[i], _file.GetPath(), _writes[i]);
+                _queue.Process(&queries[i], nullptr);
+            }
+            EXPECT_TRUE(_queue.HasPendingWrites());
+
+            _queue.Flush(_file.GetPath(), nullptr);
+            EXPECT_FALSE(_queue.HasPendingWrites());
+
+            for (size_t i = 0; i < _writes.size(); i++)
+            {
+                EXPECT_NE(queries[i].m_completeTime, 0) << "Query " << i;
+                EXPECT_EQ(queries[i].m_size, _writes[i].m_data.size()) << "Query " << i;
+            }
+
+            _queue.CloseAll(nullptr);
+        }
+    }
+
+    TEST(WriteBehindQueue, DisjointWrites)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_WriteBehindQueue_DisjointWrites.bin");
+        WriteBehindQueue queue { AllocatorInstance() };
+
+        // Out of order, with holes between extents.
+        eastl::vector<Write> writes;
+        writes.push_back(MakeWrite(64, 16, 0x2));
+        writes.push_back(MakeWrite(0, 8, 0x1));
+        writes.push_back(MakeWrite(128, 32, 0x3));
+        writes.push_back(MakeWrite(100, 4, 0x4));
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        ProcessWrites(queue, file, writes);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(file.ReadContent(), ComputeExpectedContent(writes));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(WriteBehindQueue, AdjacentWrites)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_WriteBehindQueue_AdjacentWrites.bin");
+        WriteBehindQueue queue { AllocatorInstance() };
+
+        eastl::vector<Write> writes;
+        writes.push_back(MakeWrite(16, 16, 0x1));
+        // Appended to the end of an extent
+        writes.push_back(MakeWrite(32, 8, 0x2));
+        // Prepended to the start of an extent
+        writes.push_back(MakeWrite(8, 8, 0x3));
+        // Bridging two extents, touching both ends
+        writes.push_back(MakeWrite(48, 8, 0x4));
+        writes.push_back(MakeWrite(40, 8, 0x5));
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        ProcessWrites(queue, file, writes);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(file.ReadContent(), ComputeExpectedContent(writes));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(WriteBehindQueue, OverlappingWrites)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_WriteBehindQueue_OverlappingWrites.bin");
+        WriteBehindQueue queue { AllocatorInstance() };
+
+        eastl::vector<Write> writes;
+        writes.push_back(MakeWrite(16, 16, 0x1));
+        // Overwriting the middle of an extent
+        writes.push_back(MakeWrite(20, 4, 0x2));
+        // Overlapping the end of an extent
+        writes.push_back(MakeWrite(28, 8, 0x3));
+        // Overlapping the start of an extent
+        writes.push_back(MakeWrite(12, 8, 0x4));
+        // Covering a whole extent
+        writes.push_back(MakeWrite(64, 8, 0x5));
+        writes.push_back(MakeWrite(60, 16, 0x6));
+        // Spanning several extents and the holes between them
+        writes.push_back(MakeWrite(96, 8, 0x7));
+        writes.push_back(MakeWrite(30, 70, 0x8));
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        ProcessWrites(queue, file, writes);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(file.ReadContent(), ComputeExpectedContent(writes));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(WriteBehindQueue, RandomWrites)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_WriteBehindQueue_RandomWrites.bin");
+        WriteBehindQueue queue { AllocatorInstance() };
+
+        // Small enough for the queue to never reach its flush size on its own.
+        std::mt19937 random(0x5eed);
+        std::uniform_int_distribution<u64> offsetDistribution(0, 4096);
+        std::uniform_int_distribution<u64> sizeDistribution(1, 256);
+
+        eastl::vector<Write> writes;
+        for (u32 i = 0; i < 200; i++)
+        {
+            writes.push_back(MakeWrite(offsetDistribution(random), sizeDistribution(random), static_cast<u8>(i + 1)));
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        ProcessWrites(queue, file, writes);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(file.ReadContent(), ComputeExpectedContent(writes));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(WriteBehindQueue, CloseWithDeletedQuery)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        const ScopedTestFile file("KE_WriteBehindQueue_CloseWithDeletedQuery.bin");
+        WriteBehindQueue queue { AllocatorInstance() };
+
+        eastl::vector<Write> writes;
+        writes.push_back(MakeWrite(0, 32, 0x1));
+        writes.push_back(MakeWrite(32, 32, 0x2));
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        Query pendingQuery;
+        PrepareWriteQuery(pendingQuery, file.GetPath(), writes[0]);
+        queue.Process(&pendingQuery, nullptr);
+        EXPECT_TRUE(queue.HasPendingWrites());
+        EXPECT_EQ(pendingQuery.m_completeTime, 0);
+
+        // Send-and-forget close, the query is freed as soon as it completes, while the queue is still processing it.
+        auto* closeQuery = new Query();
+        PrepareWriteQuery(*closeQuery, file.GetPath(), writes[1]);
+        closeQuery->m_closeFile = true;
+        closeQuery->m_deleteQuery = true;
+        queue.Process(closeQuery, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_FALSE(queue.HasPendingWrites());
+        EXPECT_NE(pendingQuery.m_completeTime, 0);
+        EXPECT_EQ(pendingQuery.m_size, writes[0].m_data.size());
+        EXPECT_EQ(file.ReadContent(), ComputeExpectedContent(writes));
+
+        // The file was closed and removed from the queue, so closing everything has nothing left to do.
+        queue.CloseAll(nullptr);
+
+        catcher.ExpectNoMessage();
+    }
+}
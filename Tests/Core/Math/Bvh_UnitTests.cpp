@@ -0,0 +1,361 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Bvh.inl>
+#include <KryneEngine/Core/Threads/FibersManager.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests::Math
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        eastl::vector<BoundingBox> GenerateBoxes(size_t _count, u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            std::uniform_real_distribution<float> positionDistribution(-100.f, 100.f);
+            std::uniform_real_distribution<float> sizeDistribution(0.f, 5.f);
+
+            eastl::vector<BoundingBox> boxes;
+            for (size_t i = 0; i < _count; i++)
+            {
+                const float3 min(positionDistribution(random), positionDistribution(random), positionDistribution(random));
+                const float3 size(sizeDistribution(random), sizeDistribution(random), sizeDistribution(random));
+                boxes.emplace_back(min, min + size);
+            }
+            return boxes;
+        }
+
+        bool Overlaps(const BoundingBox& _a, const BoundingBox& _b)
+        {
+            return _a.m_min.x <= _b.m_max.x && _a.m_max.x >= _b.m_min.x
+                && _a.m_min.y <= _b.m_max.y && _a.m_max.y >= _b.m_min.y
+                && _a.m_min.z <= _b.m_max.z && _a.m_max.z >= _b.m_min.z;
+        }
+
+        // Returns FLT_MAX if the ray misses the box.
+        float IntersectBox(const Ray& _ray, const BoundingBox& _box)
+        {
+            float near = 0.f;
+            float far = FLT_MAX;
+            for (size_t axis = 0; axis < 3; axis++)
+            {
+                const float t0 = (_box.m_min[axis] - _ray.m_origin[axis]) / _ray.m_direction[axis];
+                const float t1 = (_box.m_max[axis] - _ray.m_origin[axis]) / _ray.m_direction[axis];
+                near = eastl::max(near, eastl::min(t0, t1));
+                far = eastl::min(far, eastl::max(t0, t1));
+            }
+            return near <= far ? near : FLT_MAX;
+        }
+
+        float DistanceToBox(const float3& _point, const BoundingBox& _box)
+        {
+            float distanceSquared = 0.f;
+            for (size_t axis = 0; axis < 3; axis++)
+            {
+                const float d = eastl::max(eastl::max(_box.m_min[axis] - _point[axis], _point[axis] - _box.m_max[axis]), 0.f);
+                distanceSquared += d * d;
+            }
+            return std::sqrt(distanceSquared);
+        }
+
+        void ExpectValidTree(const Bvh& _bvh, size_t _primitiveCount)
+        {
+            // Every primitive is referenced by exactly one leaf.
+            eastl::vector<u32> referenced(_primitiveCount, 0);
+            for (const Bvh::Node& node: _bvh.GetNodes())
+            {
+                for (u32 i = 0; i < Bvh::kWidth; i++)
+                {
+                    if (node.m_children[i] == Bvh::kInvalidIndex)
+                    {
+                        continue;
+                    }
+                    if (node.m_counts[i] == 0)
+                    {
+                        EXPECT_LT(node.m_children[i], _bvh.GetNodes().size());
+                        continue;
+                    }
+                    for (u32 j = 0; j < node.m_counts[i]; j++)
+                    {
+                        referenced[node.m_children[i] + j]++;
+                    }
+                }
+            }
+            for (size_t i = 0; i < _primitiveCount; i++)
+            {
+                EXPECT_EQ(referenced[i], 1) << i;
+            }
+        }
+    }
+
+    TEST(Bvh, Build)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        Bvh bvh;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        bvh.Build({});
+        EXPECT_TRUE(bvh.IsEmpty());
+        EXPECT_FALSE(bvh.Raycast(Ray(float3(0.f), float3(1.f, 0.f, 0.f)), [](u32, float) { return 0.f; }).IsValid());
+
+        // Single leaf tree
+        const eastl::vector<BoundingBox> fewBoxes = GenerateBoxes(3, 1);
+        bvh.Build(fewBoxes);
+        EXPECT_EQ(bvh.GetNodes().size(), 1);
+        ExpectValidTree(bvh, fewBoxes.size());
+
+        const eastl::vector<BoundingBox> boxes = GenerateBoxes(5000, 2);
+        bvh.Build(boxes);
+        ExpectValidTree(bvh, boxes.size());
+
+        // Identical boxes can't be split by SAH, but leaves must still respect the maximum size.
+        const eastl::vector<BoundingBox> identicalBoxes(100, BoundingBox(float3(0.f), float3(1.f)));
+        bvh.Build(identicalBoxes, nullptr, 2);
+        ExpectValidTree(bvh, identicalBoxes.size());
+        for (const Bvh::Node& node: bvh.GetNodes())
+        {
+            for (const u32 count: node.m_counts)
+            {
+                EXPECT_LE(count, 2);
+            }
+        }
+    }
+
+    TEST(Bvh, QueryOverlaps)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        const eastl::vector<BoundingBox> boxes = GenerateBoxes(5000, 3);
+        Bvh bvh;
+        bvh.Build(boxes);
+
+        const eastl::vector<BoundingBox> queries = GenerateBoxes(50, 4);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (const BoundingBox& query: queries)
+        {
+            const BoundingBox enlargedQuery(query.m_min - 5.f, query.m_max + 5.f);
+
+            eastl::vector<u32> expected;
+            for (u32 i = 0; i < boxes.size(); i++)
+            {
+                if (Overlaps(boxes[i], enlargedQuery))
+                {
+                    expected.push_back(i);
+                }
+            }
+
+            eastl::vector<u32> found;
+            bvh.QueryOverlaps(enlargedQuery, [&](u32 _primitive) { found.push_back(_primitive); });
+            std::sort(found.begin(), found.end());
+
+            EXPECT_EQ(found, expected);
+        }
+    }
+
+    TEST(Bvh, Raycast)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        const eastl::vector<BoundingBox> boxes = GenerateBoxes(5000, 5);
+        Bvh bvh;
+        bvh.Build(boxes);
+
+        std::mt19937 random(6);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        u32 hitCount = 0;
+        for (u32 i = 0; i < 200; i++)
+        {
+            const Ray ray(
+                float3(distribution(random), distribution(random), distribution(random)) * 120.f,
+                float3(distribution(random), distribution(random), distribution(random)));
+
+            Bvh::Hit expected;
+            for (u32 j = 0; j < boxes.size(); j++)
+            {
+                const float distance = IntersectBox(ray, boxes[j]);
+                if (distance < expected.m_distance)
+                {
+                    expected = { j, distance };
+                }
+            }
+
+            const Bvh::Hit hit = bvh.Raycast(ray, [&](u32 _primitive, float)
+            {
+                return IntersectBox(ray, boxes[_primitive]);
+            });
+
+            EXPECT_EQ(hit.IsValid(), expected.IsValid());
+            if (expected.IsValid())
+            {
+                // Compare distances rather than indices, as overlapping boxes can be hit at the same distance.
+                EXPECT_EQ(hit.m_distance, expected.m_distance);
+                hitCount++;
+            }
+        }
+        EXPECT_GT(hitCount, 0);
+
+        // Maximum distance
+        const Ray ray(float3(-200.f, 0.f, 0.f), float3(1.f, 0.f, 0.f));
+        const auto intersect = [&](u32 _primitive, float) { return IntersectBox(ray, boxes[_primitive]); };
+        const Bvh::Hit hit = bvh.Raycast(ray, intersect);
+        ASSERT_TRUE(hit.IsValid());
+        EXPECT_FALSE(bvh.Raycast(ray, intersect, hit.m_distance * 0.99f).IsValid());
+    }
+
+    TEST(Bvh, FindClosest)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        const eastl::vector<BoundingBox> boxes = GenerateBoxes(5000, 7);
+        Bvh bvh;
+        bvh.Build(boxes);
+
+        std::mt19937 random(8);
+        std::uniform_real_distribution<float> distribution(-150.f, 150.f);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (u32 i = 0; i < 200; i++)
+        {
+            const float3 point(distribution(random), distribution(random), distribution(random));
+
+            float expected = FLT_MAX;
+            for (const BoundingBox& box: boxes)
+            {
+                expected = eastl::min(expected, DistanceToBox(point, box));
+            }
+
+            const Bvh::Hit hit = bvh.FindClosest(point, [&](u32 _primitive, float)
+            {
+                return DistanceToBox(point, boxes[_primitive]);
+            });
+
+            ASSERT_TRUE(hit.IsValid());
+            EXPECT_EQ(hit.m_distance, expected);
+        }
+    }
+
+    TEST(Bvh, ParallelBuild)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // Fiber threads are pinned to a core each, so don't request more than the machine has.
+        FibersManager fibersManager(eastl::min<s32>(std::thread::hardware_concurrency(), 4), AllocatorInstance());
+
+        // Above the parallel build threshold, so the top of the tree is split into subtrees built by jobs.
+        const eastl::vector<BoundingBox> boxes = GenerateBoxes(40'000, 9);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        Bvh bvh;
+        bvh.Build(boxes, &fibersManager);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        ExpectValidTree(bvh, boxes.size());
+
+        eastl::vector<u32> sortedIndices = bvh.GetPrimitiveIndices();
+        std::sort(sortedIndices.begin(), sortedIndices.end());
+        for (u32 i = 0; i < sortedIndices.size(); i++)
+        {
+            ASSERT_EQ(sortedIndices[i], i);
+        }
+
+        for (const BoundingBox& query: GenerateBoxes(50, 10))
+        {
+            eastl::vector<u32> expected;
+            for (u32 i = 0; i < boxes.size(); i++)
+            {
+                if (Overlaps(boxes[i], query))
+                {
+                    expected.push_back(i);
+                }
+            }
+
+            eastl::vector<u32> found;
+            bvh.QueryOverlaps(query, [&](u32 _primitive) { found.push_back(_primitive); });
+            std::sort(found.begin(), found.end());
+
+            EXPECT_EQ(found, expected);
+        }
+
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        for (u32 i = 0; i < 100; i++)
+        {
+            const Ray ray(
+                float3(distribution(random), distribution(random), distribution(random)) * 120.f,
+                float3(distribution(random), distribution(random), distribution(random)));
+
+            float expectedDistance = FLT_MAX;
+            for (const BoundingBox& box: boxes)
+            {
+                expectedDistance = eastl::min(expectedDistance, IntersectBox(ray, box));
+            }
+
+            const Bvh::Hit hit = bvh.Raycast(ray, [&](u32 _primitive, float)
+            {
+                return IntersectBox(ray, boxes[_primitive]);
+            });
+            EXPECT_EQ(hit.m_distance, expectedDistance);
+
+            const float3 point = ray.m_origin;
+            float expectedClosest = FLT_MAX;
+            for (const BoundingBox& box: boxes)
+            {
+                expectedClosest = eastl::min(expectedClosest, DistanceToBox(point, box));
+            }
+
+            const Bvh::Hit closest = bvh.FindClosest(point, [&](u32 _primitive, float)
+            {
+                return DistanceToBox(point, boxes[_primitive]);
+            });
+            ASSERT_TRUE(closest.IsValid());
+            EXPECT_EQ(closest.m_distance, expectedClosest);
+        }
+
+        catcher.ExpectNoMessage();
+    }
+}
@@ -4,7 +4,9 @@
  * @date 19/06/2025.
  */
 
+#include <random>
 #include <gtest/gtest.h>
+#include <EASTL/vector.h>
 #include <KryneEngine/Core/Math/Float16.hpp>
 
 namespace KryneEngine::Tests::Math
@@ -85,4 +87,73 @@ namespace KryneEngine::Tests::Math
         // Nan -> Nan
         TestF16ToF32(0b1'11111'1111111111, 0b1'11111111'11111111110000000000000);
     }
-}
\ No newline at end of file
+
+    TEST(Float16, BulkF32ToF16)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        eastl::vector<u32> inputs;
+
+        // Every exponent, with edge and middle mantissas, for both signs.
+        for (u32 sign = 0; sign < 2; sign++)
+        {
+            for (u32 exponent = 0; exponent <= 0xff; exponent++)
+            {
+                for (const u32 mantissa: { 0u, 1u, 0x1fffu, 0x2000u, 0x400000u, 0x7fffffu })
+                {
+                    inputs.push_back((sign << 31) | (exponent << 23) | mantissa);
+                }
+            }
+        }
+
+        std::mt19937 random(0x5eed);
+        for (u32 i = 0; i < 100'003; i++)
+        {
+            inputs.push_back(random());
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<u16> outputs(inputs.size());
+        Float16::ConvertToFloat16(reinterpret_cast<const float*>(inputs.data()), outputs.data(), inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const float value = *reinterpret_cast<const float*>(&inputs[i]);
+            EXPECT_EQ(outputs[i], Float16::ConvertToFloat16(value)) << std::hex << inputs[i];
+        }
+    }
+
+    TEST(Float16, BulkF16ToF32)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        // Every half value, offset by one so that the bulk conversion also ends with a partial batch.
+        eastl::vector<u16> inputs;
+        for (u32 i = 0; i <= 0xffff; i++)
+        {
+            inputs.push_back(static_cast<u16>(i));
+        }
+        inputs.push_back(0x3c00);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<float> outputs(inputs.size());
+        Float16::ConvertFromFloat16(inputs.data(), outputs.data(), inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const float expected = Float16::ConvertFromFloat16(inputs[i]);
+            EXPECT_EQ(*reinterpret_cast<const u32*>(&outputs[i]), *reinterpret_cast<const u32*>(&expected))
+                << std::hex << inputs[i];
+        }
+    }
+}
@@ -0,0 +1,181 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Frustum.hpp>
+#include <KryneEngine/Core/Math/Matrix.hpp>
+#include <KryneEngine/Core/Math/Projection.hpp>
+
+namespace KryneEngine::Tests::Math
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        // Right-handed Z-up projection: the camera looks towards +Y, with a 90 degrees field of view.
+        template <bool ReversedDepth>
+        Frustum MakeFrustum(float _far)
+        {
+            const float4x4 projection = PerspectiveProjection<float4x4, CoordinateSystem::RightHandedZUp>(
+                std::numbers::pi_v<float> * 0.5f, 1.f, 1.f, _far, ReversedDepth);
+            return Frustum(projection, ReversedDepth);
+        }
+    }
+
+    TEST(Frustum, Intersects)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        const Frustum frustum = MakeFrustum<false>(100.f);
+        const Frustum reversedInfiniteFrustum = MakeFrustum<true>(INFINITY);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (const Frustum& f: { frustum, reversedInfiniteFrustum })
+        {
+            EXPECT_TRUE(f.Intersects(BoundingSphere(float3(0.f, 10.f, 0.f), 0.5f)));
+            EXPECT_TRUE(f.Intersects(BoundingBox(float3(-1.f, 5.f, -1.f), float3(1.f, 6.f, 1.f))));
+
+            // Behind the camera and before the near plane
+            EXPECT_FALSE(f.Intersects(BoundingSphere(float3(0.f, -10.f, 0.f), 0.5f)));
+            EXPECT_FALSE(f.Intersects(BoundingSphere(float3(0.f, 0.5f, 0.f), 0.25f)));
+
+            // Out of the sides
+            EXPECT_FALSE(f.Intersects(BoundingSphere(float3(20.f, 10.f, 0.f), 1.f)));
+            EXPECT_FALSE(f.Intersects(BoundingBox(float3(-20.f, 10.f, -1.f), float3(-15.f, 11.f, 1.f))));
+            EXPECT_FALSE(f.Intersects(BoundingSphere(float3(0.f, 10.f, 20.f), 1.f)));
+            EXPECT_FALSE(f.Intersects(BoundingBox(float3(-1.f, 10.f, -20.f), float3(1.f, 11.f, -15.f))));
+
+            // Straddling a plane
+            EXPECT_TRUE(f.Intersects(BoundingSphere(float3(11.f, 10.f, 0.f), 2.f)));
+            EXPECT_TRUE(f.Intersects(BoundingBox(float3(9.f, 10.f, -1.f), float3(12.f, 10.5f, 1.f))));
+        }
+
+        // Far plane
+        EXPECT_FALSE(frustum.Intersects(BoundingSphere(float3(0.f, 200.f, 0.f), 1.f)));
+        EXPECT_TRUE(frustum.Intersects(BoundingSphere(float3(0.f, 100.5f, 0.f), 1.f)));
+        EXPECT_TRUE(reversedInfiniteFrustum.Intersects(BoundingSphere(float3(0.f, 1e6f, 0.f), 1.f)));
+    }
+
+    TEST(Frustum, NearAndFarPlanes)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        const Frustum frustum = MakeFrustum<false>(100.f);
+        const Frustum reversedFrustum = MakeFrustum<true>(100.f);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        // Planes are named after their distance to the camera, whatever the depth direction.
+        for (const Frustum& f: { frustum, reversedFrustum })
+        {
+            EXPECT_NEAR(f.m_planes[Frustum::Near].SignedDistance(float3(0.f, 2.f, 0.f)), 1.f, 1e-4f);
+            EXPECT_NEAR(f.m_planes[Frustum::Far].SignedDistance(float3(0.f, 90.f, 0.f)), 10.f, 1e-3f);
+        }
+    }
+
+    TEST(Frustum, BatchCulling)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        // Not a multiple of 64, so the last mask word is partial.
+        constexpr size_t count = 1037;
+
+        const Frustum frustum = MakeFrustum<false>(100.f);
+
+        std::mt19937 random(0x5eed);
+        std::uniform_real_distribution<float> positionDistribution(-120.f, 120.f);
+        std::uniform_real_distribution<float> sizeDistribution(0.f, 10.f);
+
+        eastl::vector<float> components[7];
+        for (eastl::vector<float>& component: components)
+        {
+            component.resize(count);
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            for (size_t c = 0; c < 3; c++)
+            {
+                components[c][i] = positionDistribution(random);
+                components[c + 3][i] = components[c][i] + sizeDistribution(random);
+            }
+            components[6][i] = sizeDistribution(random);
+        }
+
+        const Vector3Soa<const float> mins { components[0].data(), components[1].data(), components[2].data() };
+        const Vector3Soa<const float> maxs { components[3].data(), components[4].data(), components[5].data() };
+        const float* radii = components[6].data();
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        constexpr size_t wordCount = (count + 63) / 64;
+
+        u64 boxMask[wordCount];
+        CullBoundingBoxes(frustum, mins, maxs, count, boxMask);
+
+        u64 sphereMask[wordCount];
+        CullBoundingSpheres(frustum, mins, radii, count, sphereMask);
+
+        size_t visibleBoxes = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const bool boxVisible = (boxMask[i / 64] >> (i % 64)) & 1;
+            const bool sphereVisible = (sphereMask[i / 64] >> (i % 64)) & 1;
+
+            const BoundingBox box(float3(mins.x[i], mins.y[i], mins.z[i]), float3(maxs.x[i], maxs.y[i], maxs.z[i]));
+            EXPECT_EQ(boxVisible, frustum.Intersects(box)) << i;
+            EXPECT_EQ(sphereVisible, frustum.Intersects(BoundingSphere(float3(mins.x[i], mins.y[i], mins.z[i]), radii[i])))
+                << i;
+
+            visibleBoxes += boxVisible ? 1 : 0;
+        }
+        EXPECT_GT(visibleBoxes, 0);
+        EXPECT_LT(visibleBoxes, count);
+        EXPECT_EQ(boxMask[wordCount - 1] >> (count % 64), 0);
+
+        // Compaction
+        eastl::vector<u32> indices(count);
+        EXPECT_EQ(CompactVisibleIndices(boxMask, count, indices.data(), 10), visibleBoxes);
+        size_t next = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            if ((boxMask[i / 64] >> (i % 64)) & 1)
+            {
+                EXPECT_EQ(indices[next++], i + 10);
+            }
+        }
+
+        // A range starting on a mask word, as done when splitting the culling across jobs.
+        constexpr size_t rangeStart = 128;
+        u64 rangeMask[wordCount];
+        CullBoundingBoxes(
+            frustum,
+            { mins.x + rangeStart, mins.y + rangeStart, mins.z + rangeStart },
+            { maxs.x + rangeStart, maxs.y + rangeStart, maxs.z + rangeStart },
+            count - rangeStart,
+            rangeMask);
+        for (size_t word = 0; word < wordCount - rangeStart / 64; word++)
+        {
+            EXPECT_EQ(rangeMask[word], boxMask[word + rangeStart / 64]);
+        }
+    }
+}
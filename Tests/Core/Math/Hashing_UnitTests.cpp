@@ -0,0 +1,181 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <array>
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Hashing.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        constexpr size_t kPatternSize = 4096;
+
+        constexpr std::array<char, kPatternSize> MakePattern()
+        {
+            std::array<char, kPatternSize> pattern {};
+            for (size_t i = 0; i < kPatternSize; i++)
+            {
+                pattern[i] = static_cast<char>(i * 31 + 7);
+            }
+            return pattern;
+        }
+
+        constexpr std::array<char, kPatternSize> kPattern = MakePattern();
+
+        struct ReferenceValue
+        {
+            size_t m_size;
+            u64 m_hash;
+        };
+    }
+
+    TEST(FastHash, ReferenceValues)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // Values from the reference XXH3 implementation, covering every size class.
+        constexpr ReferenceValue unseeded[] = {
+            { 0, 0x2D06800538D394C2ull },
+            { 3, 0x15F7093B173D005Cull },
+            { 8, 0xDEC6A9A43575982Eull },
+            { 16, 0x7E484C18D74895D0ull },
+            { 100, 0x8C97158042FBF926ull },
+            { 200, 0x12FDB864685F344Dull },
+            { 1000, 0x989765D0EA7A5ECDull },
+            { 4096, 0xA3C19F8174CDE0BBull },
+        };
+        constexpr ReferenceValue seeded[] = {
+            { 0, 0xB029411FF43D84D2ull },
+            { 3, 0x0322C472F9DD3C8Aull },
+            { 8, 0xB18293E9A9982B58ull },
+            { 16, 0x0126FE5707CA8F2Bull },
+            { 100, 0x4CA5C3A331119E67ull },
+            { 200, 0x9B4D9E4B4078C30Full },
+            { 1000, 0x210176AC002574ADull },
+            { 4096, 0x334B260CACB92CA4ull },
+        };
+        constexpr u64 seed = 42;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (const ReferenceValue& value: unseeded)
+        {
+            EXPECT_EQ(Hashing::FastHash64(kPattern.data(), value.m_size), value.m_hash) << value.m_size;
+        }
+        for (const ReferenceValue& value: seeded)
+        {
+            EXPECT_EQ(Hashing::FastHash64(kPattern.data(), value.m_size, seed), value.m_hash) << value.m_size;
+        }
+
+        EXPECT_EQ(Hashing::FastHash64("KryneEngine"), 0x259A788F2773CDBAull);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FastHash, Constexpr)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // Long inputs use the scalar stripe accumulation at compile time, and the vectorized one at runtime.
+        constexpr u64 shortHash = Hashing::FastHash64("KryneEngine");
+        constexpr u64 midSizeHash = Hashing::FastHash64(kPattern.data(), 200, 42);
+        constexpr u64 longHash = Hashing::FastHash64(kPattern.data(), 2500, 42);
+
+        static_assert(shortHash == 0x259A788F2773CDBAull);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        const char* runtimeData = kPattern.data();
+        EXPECT_EQ(midSizeHash, Hashing::FastHash64(runtimeData, 200, 42));
+        EXPECT_EQ(longHash, Hashing::FastHash64(runtimeData, 2500, 42));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FastHash, Streaming)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        std::mt19937_64 random(0x5eed);
+        eastl::vector<char> data(5000);
+        for (char& byte: data)
+        {
+            byte = static_cast<char>(random());
+        }
+
+        // Sizes around the size classes, the stripes, the internal buffer and the blocks.
+        constexpr size_t sizes[] = { 0, 1, 17, 129, 240, 241, 255, 256, 257, 320, 1023, 1024, 1025, 2048, 5000 };
+        constexpr size_t chunkSizes[] = { 1, 7, 64, 100, 256, 1500 };
+        constexpr u64 seeds[] = { 0, 42 };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (const u64 seed: seeds)
+        {
+            Hashing::FastHasher hasher(seed);
+            for (const size_t size: sizes)
+            {
+                const u64 expected = Hashing::FastHash64(data.data(), size, seed);
+                for (const size_t chunkSize: chunkSizes)
+                {
+                    hasher.Reset(seed);
+                    for (size_t offset = 0; offset < size; offset += chunkSize)
+                    {
+                        hasher.Update(data.data() + offset, eastl::min(chunkSize, size - offset));
+                    }
+                    EXPECT_EQ(hasher.Digest(), expected) << size << " " << chunkSize;
+                }
+            }
+        }
+
+        // Digest doesn't end the stream.
+        Hashing::FastHasher hasher;
+        hasher.Update(data.data(), 1000);
+        EXPECT_EQ(hasher.Digest(), Hashing::FastHash64(data.data(), 1000));
+        hasher.Update(data.data() + 1000, 1000);
+        EXPECT_EQ(hasher.Digest(), Hashing::FastHash64(data.data(), 2000));
+
+        // Values are hashed as their bytes.
+        struct Descriptor
+        {
+            u32 m_format;
+            u32 m_flags;
+            u64 m_size;
+        };
+        constexpr Descriptor descriptor { 3, 5, 1024 };
+
+        hasher.Reset();
+        hasher.Update(descriptor.m_format);
+        hasher.Update(descriptor.m_flags);
+        hasher.Update(descriptor.m_size);
+        EXPECT_EQ(hasher.Digest(), Hashing::FastHash64(reinterpret_cast<const char*>(&descriptor), sizeof(descriptor)));
+
+        catcher.ExpectNoMessage();
+    }
+}
@@ -0,0 +1,337 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Float16.hpp>
+#include <KryneEngine/Core/Math/Frustum.hpp>
+#include <KryneEngine/Core/Math/Hashing.hpp>
+#include <KryneEngine/Core/Math/Matrix.hpp>
+#include <KryneEngine/Core/Math/Projection.hpp>
+#include <KryneEngine/Core/Math/SimdDispatch.hpp>
+#include <KryneEngine/Core/Math/TransformBatch.hpp>
+
+namespace KryneEngine::Tests::Math
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        // Not a multiple of any batch size, so the scalar tails are also covered.
+        constexpr size_t kCount = 1037;
+
+        /**
+         * @brief Runs `_execute` once per target supported on this machine, and restores the active target after.
+         * @details The baseline target runs first, so its results can be used as reference.
+         */
+        template <class Func>
+        void ForEachSupportedTarget(Func&& _execute)
+        {
+            const SimdTarget previousTarget = SimdDispatch::GetActiveTarget();
+            for (u8 i = 0; i < static_cast<u8>(SimdTarget::Count); i++)
+            {
+                const auto target = static_cast<SimdTarget>(i);
+                if (!SimdDispatch::IsTargetSupported(target))
+                {
+                    continue;
+                }
+                SimdDispatch::SetActiveTarget(target);
+                _execute(target);
+            }
+            SimdDispatch::SetActiveTarget(previousTarget);
+        }
+
+        template <class T>
+        void ExpectBitIdentical(const eastl::vector<T>& _result, const eastl::vector<T>& _expected, SimdTarget _target)
+        {
+            ASSERT_EQ(_result.size(), _expected.size());
+            for (size_t i = 0; i < _result.size(); i++)
+            {
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    EXPECT_EQ(std::bit_cast<u32>(_result[i]), std::bit_cast<u32>(_expected[i]))
+                        << SimdDispatch::GetTargetName(_target) << ", index " << i;
+                }
+                else
+                {
+                    EXPECT_EQ(_result[i], _expected[i]) << SimdDispatch::GetTargetName(_target) << ", index " << i;
+                }
+            }
+        }
+
+        eastl::vector<float> RandomFloats(std::mt19937& _random, size_t _count, float _min, float _max)
+        {
+            std::uniform_real_distribution<float> distribution(_min, _max);
+            eastl::vector<float> result(_count);
+            for (float& value: result)
+            {
+                value = distribution(_random);
+            }
+            return result;
+        }
+    }
+
+    TEST(SimdDispatch, Targets)
+    {
+        EXPECT_TRUE(SimdDispatch::IsTargetSupported(SimdTarget::Baseline));
+        EXPECT_FALSE(SimdDispatch::IsTargetSupported(SimdTarget::Count));
+        EXPECT_TRUE(SimdDispatch::IsTargetSupported(SimdDispatch::GetBestTarget()));
+
+        // The best target is selected at startup.
+        EXPECT_EQ(SimdDispatch::GetActiveTarget(), SimdDispatch::GetBestTarget());
+
+        ForEachSupportedTarget([](SimdTarget _target)
+        {
+            EXPECT_EQ(SimdDispatch::GetActiveTarget(), _target);
+            EXPECT_GE(SimdDispatch::GetBestTarget(), _target);
+        });
+        EXPECT_EQ(SimdDispatch::GetActiveTarget(), SimdDispatch::GetBestTarget());
+    }
+
+    TEST(SimdDispatch, TransformBatch)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+
+        eastl::vector<float> inputs[16];
+        for (eastl::vector<float>& input: inputs)
+        {
+            input = RandomFloats(random, kCount, -10.f, 10.f);
+        }
+
+        float4x4 matrix;
+        const eastl::vector<float> matrixElements = RandomFloats(random, 16, -2.f, 2.f);
+        for (size_t row = 0; row < 4; row++)
+        {
+            for (size_t col = 0; col < 4; col++)
+            {
+                matrix.Get(row, col) = matrixElements[row * 4 + col];
+            }
+        }
+
+        const Vector3Soa<const float> vectors { inputs[0].data(), inputs[1].data(), inputs[2].data() };
+        const QuaternionSoa<const float> rotations {
+            inputs[3].data(), inputs[4].data(), inputs[5].data(), inputs[6].data() };
+        const Vector3Soa<const float> scales { inputs[7].data(), inputs[8].data(), inputs[9].data() };
+
+        Matrix44Soa<const float> inputMatrices {};
+        for (size_t e = 0; e < 16; e++)
+        {
+            inputMatrices.m_elements[e] = inputs[e].data();
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Transformed points, then composed matrices, then multiplied matrices
+        constexpr size_t outputCount = 3 + 16 + 16;
+        eastl::vector<float> expected[outputCount];
+
+        ForEachSupportedTarget([&](SimdTarget _target)
+        {
+            eastl::vector<float> outputs[outputCount];
+            for (eastl::vector<float>& output: outputs)
+            {
+                output.resize(kCount);
+            }
+
+            Matrix44Soa<float> composed {};
+            Matrix44Soa<float> multiplied {};
+            for (size_t e = 0; e < 16; e++)
+            {
+                composed.m_elements[e] = outputs[3 + e].data();
+                multiplied.m_elements[e] = outputs[3 + 16 + e].data();
+            }
+
+            TransformPoints(matrix, vectors, { outputs[0].data(), outputs[1].data(), outputs[2].data() }, kCount);
+            ComputeTransformMatrices(vectors, rotations, scales, composed, kCount);
+            MultiplyMatrices(inputMatrices, composed, multiplied, kCount);
+
+            for (size_t i = 0; i < outputCount; i++)
+            {
+                if (_target == SimdTarget::Baseline)
+                {
+                    expected[i] = outputs[i];
+                }
+                else
+                {
+                    ExpectBitIdentical(outputs[i], expected[i], _target);
+                }
+            }
+        });
+    }
+
+    TEST(SimdDispatch, FrustumCulling)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+
+        const float4x4 projection = PerspectiveProjection<float4x4, CoordinateSystem::RightHandedZUp>(
+            std::numbers::pi_v<float> * 0.5f, 1.f, 1.f, 100.f, false);
+        const Frustum frustum(projection);
+
+        eastl::vector<float> mins[3];
+        eastl::vector<float> maxs[3];
+        for (size_t c = 0; c < 3; c++)
+        {
+            mins[c] = RandomFloats(random, kCount, -120.f, 120.f);
+            maxs[c] = mins[c];
+            for (float& value: maxs[c])
+            {
+                value += std::uniform_real_distribution<float>(0.f, 10.f)(random);
+            }
+        }
+        const eastl::vector<float> radii = RandomFloats(random, kCount, 0.f, 10.f);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        constexpr size_t wordCount = (kCount + 63) / 64;
+        eastl::vector<u64> expectedBoxMask;
+        eastl::vector<u64> expectedSphereMask;
+
+        ForEachSupportedTarget([&](SimdTarget _target)
+        {
+            eastl::vector<u64> boxMask(wordCount);
+            eastl::vector<u64> sphereMask(wordCount);
+            CullBoundingBoxes(
+                frustum,
+                { mins[0].data(), mins[1].data(), mins[2].data() },
+                { maxs[0].data(), maxs[1].data(), maxs[2].data() },
+                kCount,
+                boxMask.data());
+            CullBoundingSpheres(
+                frustum,
+                { mins[0].data(), mins[1].data(), mins[2].data() },
+                radii.data(),
+                kCount,
+                sphereMask.data());
+
+            if (_target == SimdTarget::Baseline)
+            {
+                expectedBoxMask = boxMask;
+                expectedSphereMask = sphereMask;
+            }
+            else
+            {
+                ExpectBitIdentical(boxMask, expectedBoxMask, _target);
+                ExpectBitIdentical(sphereMask, expectedSphereMask, _target);
+            }
+        });
+    }
+
+    TEST(SimdDispatch, Float16)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+
+        // Random bit patterns cover all the special cases, along with some values in the half range.
+        eastl::vector<float> floats(kCount);
+        for (size_t i = 0; i < kCount; i++)
+        {
+            floats[i] = (i % 2 == 0)
+                ? std::bit_cast<float>(static_cast<u32>(random()))
+                : std::uniform_real_distribution<float>(-70000.f, 70000.f)(random);
+        }
+
+        eastl::vector<u16> halves(1 << 16);
+        for (size_t i = 0; i < halves.size(); i++)
+        {
+            halves[i] = static_cast<u16>(i);
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<u16> expectedHalves;
+        eastl::vector<float> expectedFloats;
+
+        ForEachSupportedTarget([&](SimdTarget _target)
+        {
+            eastl::vector<u16> convertedHalves(floats.size());
+            eastl::vector<float> convertedFloats(halves.size());
+            Float16::ConvertToFloat16(floats.data(), convertedHalves.data(), floats.size());
+            Float16::ConvertFromFloat16(halves.data(), convertedFloats.data(), halves.size());
+
+            if (_target == SimdTarget::Baseline)
+            {
+                expectedHalves = convertedHalves;
+                expectedFloats = convertedFloats;
+            }
+            else
+            {
+                ExpectBitIdentical(convertedHalves, expectedHalves, _target);
+                ExpectBitIdentical(convertedFloats, expectedFloats, _target);
+            }
+        });
+    }
+
+    TEST(SimdDispatch, Hashing)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+
+        eastl::vector<char> data(5000);
+        for (char& byte: data)
+        {
+            byte = static_cast<char>(random());
+        }
+
+        // Long inputs only, as shorter ones never reach the vectorized kernels.
+        const size_t sizes[] = { 241, 256, 1023, 1024, 1025, 4096, 5000 };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<u64> expected;
+
+        ForEachSupportedTarget([&](SimdTarget _target)
+        {
+            eastl::vector<u64> hashes;
+            for (const size_t size: sizes)
+            {
+                hashes.push_back(Hashing::FastHash64(data.data(), size));
+                hashes.push_back(Hashing::FastHash64(data.data(), size, 0x5eed));
+
+                Hashing::FastHasher hasher(0x5eed);
+                hasher.Update(data.data(), size / 3);
+                hasher.Update(data.data() + size / 3, size - size / 3);
+                hashes.push_back(hasher.Digest());
+                EXPECT_EQ(hashes.back(), Hashing::FastHash64(data.data(), size, 0x5eed));
+            }
+
+            if (_target == SimdTarget::Baseline)
+            {
+                expected = hashes;
+            }
+            else
+            {
+                ExpectBitIdentical(hashes, expected, _target);
+            }
+        });
+    }
+}
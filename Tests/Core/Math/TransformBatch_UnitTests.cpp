@@ -0,0 +1,239 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Math/Matrix.hpp>
+#include <KryneEngine/Core/Math/Transform.hpp>
+#include <KryneEngine/Core/Math/TransformBatch.hpp>
+
+namespace KryneEngine::Tests::Math
+{
+    using namespace KryneEngine::Math;
+
+    namespace
+    {
+        // Not a multiple of any batch size, so the scalar tail is also covered.
+        constexpr size_t kCount = 37;
+        constexpr float kEpsilon = 1e-4f;
+
+        struct SoaStorage
+        {
+            explicit SoaStorage(size_t _componentCount): m_components(_componentCount, eastl::vector<float>(kCount)) {}
+
+            float* operator[](size_t _component) { return m_components[_component].data(); }
+
+            eastl::vector<eastl::vector<float>> m_components;
+        };
+
+        Matrix44Soa<float> ToMatrixSoa(SoaStorage& _storage)
+        {
+            Matrix44Soa<float> result {};
+            for (size_t i = 0; i < 16; i++)
+            {
+                result.m_elements[i] = _storage[i];
+            }
+            return result;
+        }
+
+        float4x4 LoadMatrix(const Matrix44Soa<float>& _soa, size_t _index)
+        {
+            float4x4 result;
+            for (size_t row = 0; row < 4; row++)
+            {
+                for (size_t col = 0; col < 4; col++)
+                {
+                    result.Get(row, col) = _soa.Get(row, col)[_index];
+                }
+            }
+            return result;
+        }
+
+        void ExpectMatrixNear(const float4x4& _result, const float4x4& _expected, size_t _index)
+        {
+            for (size_t row = 0; row < 4; row++)
+            {
+                for (size_t col = 0; col < 4; col++)
+                {
+                    EXPECT_NEAR(_result.Get(row, col), _expected.Get(row, col), kEpsilon)
+                        << "Matrix " << _index << ", element (" << row << ", " << col << ")";
+                }
+            }
+        }
+
+        Quaternion RandomRotation(std::mt19937& _random)
+        {
+            std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+            const float w = distribution(_random);
+            const float x = distribution(_random);
+            const float y = distribution(_random);
+            const float z = distribution(_random);
+            const float norm = std::sqrt(w * w + x * x + y * y + z * z);
+            return { w / norm, x / norm, y / norm, z / norm };
+        }
+    }
+
+    TEST(TransformBatch, ComputeTransformMatrices)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+        std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+        SoaStorage positions(3);
+        SoaStorage rotations(4);
+        SoaStorage scales(3);
+        SoaStorage output(16);
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            const Quaternion rotation = RandomRotation(random);
+            rotations[0][i] = rotation.w;
+            rotations[1][i] = rotation.x;
+            rotations[2][i] = rotation.y;
+            rotations[3][i] = rotation.z;
+            for (size_t c = 0; c < 3; c++)
+            {
+                positions[c][i] = distribution(random);
+                scales[c][i] = distribution(random);
+            }
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        const Matrix44Soa<float> matrices = ToMatrixSoa(output);
+        ComputeTransformMatrices(
+            { positions[0], positions[1], positions[2] },
+            { rotations[0], rotations[1], rotations[2], rotations[3] },
+            { scales[0], scales[1], scales[2] },
+            matrices,
+            kCount);
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            const float4x4 expected = ComputeTransformMatrix<float4x4>(
+                float3(positions[0][i], positions[1][i], positions[2][i]),
+                Quaternion(rotations[0][i], rotations[1][i], rotations[2][i], rotations[3][i]),
+                float3(scales[0][i], scales[1][i], scales[2][i]));
+            ExpectMatrixNear(LoadMatrix(matrices, i), expected, i);
+        }
+    }
+
+    TEST(TransformBatch, MultiplyMatrices)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+        std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+
+        SoaStorage lhs(16);
+        SoaStorage rhs(16);
+        for (size_t e = 0; e < 16; e++)
+        {
+            for (size_t i = 0; i < kCount; i++)
+            {
+                lhs[e][i] = distribution(random);
+                rhs[e][i] = distribution(random);
+            }
+        }
+
+        const Matrix44Soa<float> lhsSoa = ToMatrixSoa(lhs);
+        const Matrix44Soa<float> rhsSoa = ToMatrixSoa(rhs);
+
+        eastl::vector<float4x4> expected;
+        for (size_t i = 0; i < kCount; i++)
+        {
+            expected.push_back(LoadMatrix(lhsSoa, i) * LoadMatrix(rhsSoa, i));
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        SoaStorage output(16);
+        const Matrix44Soa<float> outputSoa = ToMatrixSoa(output);
+        MultiplyMatrices(lhsSoa, rhsSoa, outputSoa, kCount);
+        for (size_t i = 0; i < kCount; i++)
+        {
+            ExpectMatrixNear(LoadMatrix(outputSoa, i), expected[i], i);
+        }
+
+        // In place, as done when propagating transforms through a hierarchy.
+        MultiplyMatrices(lhsSoa, rhsSoa, rhsSoa, kCount);
+        for (size_t i = 0; i < kCount; i++)
+        {
+            ExpectMatrixNear(LoadMatrix(rhsSoa, i), expected[i], i);
+        }
+    }
+
+    TEST(TransformBatch, TransformPointsAndDirections)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        std::mt19937 random(0x5eed);
+        std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+        const float4x4 matrix = ComputeTransformMatrix<float4x4>(
+            float3(1.0f, 2.0f, 3.0f),
+            RandomRotation(random),
+            float3(1.0f, 0.5f, 1.2f));
+        const float4x4_simd simdMatrix(matrix);
+
+        SoaStorage input(3);
+        for (size_t c = 0; c < 3; c++)
+        {
+            for (size_t i = 0; i < kCount; i++)
+            {
+                input[c][i] = distribution(random);
+            }
+        }
+        const Vector3Soa<float> inputSoa { input[0], input[1], input[2] };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        SoaStorage points(3);
+        SoaStorage directions(3);
+        const Vector3Soa<float> pointsSoa { points[0], points[1], points[2] };
+        const Vector3Soa<float> directionsSoa { directions[0], directions[1], directions[2] };
+        TransformPoints(matrix, inputSoa, pointsSoa, kCount);
+        TransformDirections(simdMatrix, inputSoa, directionsSoa, kCount);
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            const float x = input[0][i];
+            const float y = input[1][i];
+            const float z = input[2][i];
+            for (size_t row = 0; row < 3; row++)
+            {
+                const float direction = matrix.Get(row, 0) * x + matrix.Get(row, 1) * y + matrix.Get(row, 2) * z;
+                EXPECT_NEAR(points[row][i], direction + matrix.Get(row, 3), kEpsilon);
+                EXPECT_NEAR(directions[row][i], direction, kEpsilon);
+            }
+        }
+
+        // In place
+        TransformPoints(matrix, inputSoa, inputSoa, kCount);
+        for (size_t c = 0; c < 3; c++)
+        {
+            for (size_t i = 0; i < kCount; i++)
+            {
+                EXPECT_EQ(input[c][i], points[c][i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <atomic>
+#include <thread>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <KryneEngine/Core/Memory/Allocators/AllocatorTracker.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        struct BudgetCounter
+        {
+            u32 m_id;
+            std::atomic<u32> m_callCount = 0;
+            std::atomic<u32> m_mismatchCount = 0;
+        };
+
+        // Each callback only expects its own user data.
+        template <u32 Id>
+        void CountBudgetExceeded(const AllocatorTracker&, size_t, void* _userData)
+        {
+            auto* counter = static_cast<BudgetCounter*>(_userData);
+            if (counter->m_id != Id)
+            {
+                counter->m_mismatchCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            counter->m_callCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    TEST(AllocatorTracker, BudgetChangedWhileInUse)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        AllocatorTracker tracker { "Test" };
+
+        BudgetCounter counterA { .m_id = 0 };
+        BudgetCounter counterB { .m_id = 1 };
+
+        constexpr u32 threadCount = 4;
+        constexpr size_t blockSize = 64;
+        constexpr u32 iterationCount = 1'000;
+
+        std::atomic<bool> stop = false;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Usage keeps going back and forth across both budgets.
+        eastl::vector<std::thread> threads;
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back([&]()
+            {
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    tracker.RegisterAllocation(blockSize);
+                    tracker.RegisterAllocation(blockSize);
+                    tracker.RegisterFree(blockSize);
+                    tracker.RegisterFree(blockSize);
+                }
+            });
+        }
+
+        for (u32 i = 0; i < iterationCount; i++)
+        {
+            if (i % 2 == 0)
+            {
+                tracker.SetBudget(blockSize + 1, CountBudgetExceeded<0>, &counterA);
+            }
+            else
+            {
+                tracker.SetBudget(3 * blockSize + 1, CountBudgetExceeded<1>, &counterB);
+            }
+            std::this_thread::yield();
+        }
+        tracker.SetBudget(0, nullptr);
+
+        stop.store(true, std::memory_order_relaxed);
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(counterA.m_mismatchCount.load(), 0);
+        EXPECT_EQ(counterB.m_mismatchCount.load(), 0);
+
+        EXPECT_EQ(tracker.GetBudget(), 0);
+        const AllocatorStats stats = tracker.GetStats();
+        EXPECT_EQ(stats.m_budget, 0);
+        EXPECT_EQ(stats.m_bytesInUse, 0);
+        EXPECT_EQ(stats.m_allocationCount, 0);
+
+        // Not called anymore once disabled.
+        const u32 callCount = counterA.m_callCount.load() + counterB.m_callCount.load();
+        tracker.RegisterAllocation(4 * blockSize);
+        tracker.RegisterFree(4 * blockSize);
+        EXPECT_EQ(counterA.m_callCount.load() + counterB.m_callCount.load(), callCount);
+
+        catcher.ExpectNoMessage();
+    }
+}
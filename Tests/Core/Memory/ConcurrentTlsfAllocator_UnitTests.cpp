@@ -0,0 +1,288 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <KryneEngine/Core/Common/Utils/Alignment.hpp>
+#include <KryneEngine/Core/Memory/Allocators/ConcurrentTlsfAllocator.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(ConcurrentTlsfAllocator, SizeClasses)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Every size must map to the smallest size class able to hold it.
+        for (size_t size = 1; size <= ConcurrentTlsfAllocator::kMaxCachedSize; size++)
+        {
+            const u32 sizeClass = ConcurrentTlsfAllocator::GetSizeClass(size);
+            ASSERT_LT(sizeClass, ConcurrentTlsfAllocator::kSizeClassCount);
+            EXPECT_GE(ConcurrentTlsfAllocator::GetSizeClassSize(sizeClass), size);
+            if (sizeClass > 0)
+            {
+                EXPECT_LT(ConcurrentTlsfAllocator::GetSizeClassSize(sizeClass - 1), size);
+            }
+        }
+
+        EXPECT_EQ(
+            ConcurrentTlsfAllocator::GetSizeClassSize(ConcurrentTlsfAllocator::kSizeClassCount - 1),
+            ConcurrentTlsfAllocator::kMaxCachedSize);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(ConcurrentTlsfAllocator, ThreadCacheReuse)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 64 * 1024;
+        ConcurrentTlsfAllocator* allocator = ConcurrentTlsfAllocator::Create(AllocatorInstance(), heapSize);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // A freed small block goes back to the thread magazine, and is the next one to be returned for its size class.
+        void* p0 = allocator->Allocate(40, 8);
+        ASSERT_NE(p0, nullptr);
+        allocator->Free(p0, 40);
+        void* p1 = allocator->Allocate(48, 16);
+        EXPECT_EQ(p0, p1);
+        EXPECT_TRUE(Alignment::IsAligned(reinterpret_cast<uintptr_t>(p1), ConcurrentTlsfAllocator::kCachedAlignment));
+        allocator->Free(p1, 48);
+
+        // Large and over-aligned allocations go straight to the TLSF heap.
+        void* p2 = allocator->Allocate(4096, 8);
+        EXPECT_NE(p2, nullptr);
+        void* p3 = allocator->Allocate(32, 256);
+        EXPECT_TRUE(Alignment::IsAligned<uintptr_t>(reinterpret_cast<uintptr_t>(p3), 256));
+        allocator->Free(p2, 4096);
+        allocator->Free(p3, 32);
+
+        // Overflow the magazine, to go through the remote-free list.
+        constexpr u32 count = ConcurrentTlsfAllocator::kMagazineCapacity * 4;
+        void* pointers[count];
+        for (void*& p: pointers)
+        {
+            p = allocator->Allocate(64, 0);
+            EXPECT_NE(p, nullptr);
+        }
+        for (void* p: pointers)
+        {
+            allocator->Free(p, 64);
+        }
+
+        allocator->FlushThreadCache();
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        ConcurrentTlsfAllocator::Destroy(allocator);
+    }
+
+    TEST(ConcurrentTlsfAllocator, ThreadCacheRecycling)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 256 * 1024;
+        ConcurrentTlsfAllocator* allocator = ConcurrentTlsfAllocator::Create(AllocatorInstance(), heapSize);
+
+        constexpr u32 threadCount = ConcurrentTlsfAllocator::kMaxThreadCaches * 2;
+        constexpr size_t size = 64;
+        u32 uncachedCount = 0;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Threads exiting give their cache back, so threads created later still get one. A cached allocation refills
+        // the whole magazine at once, which shows in the heap usage.
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            std::thread thread([&]
+            {
+                const size_t bytesInUse = allocator->GetTracker()->GetBytesInUse();
+                void* ptr = allocator->Allocate(size, 16);
+                EXPECT_NE(ptr, nullptr);
+                if (allocator->GetTracker()->GetBytesInUse() - bytesInUse
+                    < ConcurrentTlsfAllocator::kRefillBatchSize * size)
+                {
+                    uncachedCount++;
+                }
+                allocator->Free(ptr, size);
+                allocator->FlushThreadCache();
+            });
+            thread.join();
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(uncachedCount, 0);
+        EXPECT_EQ(allocator->GetTracker()->GetBytesInUse(), 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        ConcurrentTlsfAllocator::Destroy(allocator);
+    }
+
+    TEST(ConcurrentTlsfAllocator, MultiThreadedCrossFrees)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 1024 * 1024;
+        ConcurrentTlsfAllocator* allocator = ConcurrentTlsfAllocator::Create(AllocatorInstance(), heapSize);
+
+        constexpr u32 threadCount = 4;
+        constexpr u32 iterationCount = 20'000;
+
+        struct Allocation
+        {
+            u8* m_ptr;
+            size_t m_size;
+        };
+
+        std::mutex sharedMutex;
+        eastl::vector<Allocation> shared;
+        std::atomic<u32> corruptionCount = 0;
+
+        const auto checkAndFree = [&](const Allocation& _allocation)
+        {
+            for (size_t i = 0; i < _allocation.m_size; i++)
+            {
+                if (_allocation.m_ptr[i] != static_cast<u8>(_allocation.m_size))
+                {
+                    corruptionCount++;
+                    break;
+                }
+            }
+            allocator->Free(_allocation.m_ptr, _allocation.m_size);
+        };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Each thread allocates, and frees either its own blocks or blocks allocated by other threads.
+        const auto threadFunction = [&](u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            eastl::vector<Allocation> owned;
+
+            for (u32 i = 0; i < iterationCount; i++)
+            {
+                if (random() % 3 != 0 || owned.empty())
+                {
+                    const size_t size = random() % 10 == 0 ? 1 + random() % 4096 : 1 + random() % 512;
+                    const size_t alignment = 1ull << (random() % 6);
+                    auto* ptr = static_cast<u8*>(allocator->Allocate(size, alignment));
+                    if (ptr == nullptr || !Alignment::IsAligned(reinterpret_cast<uintptr_t>(ptr), alignment))
+                    {
+                        corruptionCount++;
+                        continue;
+                    }
+                    memset(ptr, static_cast<u8>(size), size);
+                    owned.push_back({ ptr, size });
+                }
+                else
+                {
+                    const size_t index = random() % owned.size();
+                    const Allocation allocation = owned[index];
+                    owned[index] = owned.back();
+                    owned.pop_back();
+
+                    if (random() % 2 == 0)
+                    {
+                        checkAndFree(allocation);
+                    }
+                    else
+                    {
+                        const auto lock = std::lock_guard(sharedMutex);
+                        shared.push_back(allocation);
+                    }
+                }
+
+                if (i % 256 == 0)
+                {
+                    eastl::vector<Allocation> taken;
+                    {
+                        const auto lock = std::lock_guard(sharedMutex);
+                        taken.swap(shared);
+                    }
+                    for (const Allocation& allocation: taken)
+                    {
+                        checkAndFree(allocation);
+                    }
+                }
+            }
+
+            for (const Allocation& allocation: owned)
+            {
+                checkAndFree(allocation);
+            }
+            allocator->FlushThreadCache();
+        };
+
+        eastl::vector<std::thread> threads;
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back(threadFunction, i);
+        }
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        for (const Allocation& allocation: shared)
+        {
+            checkAndFree(allocation);
+        }
+
+        EXPECT_EQ(corruptionCount.load(), 0);
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        ConcurrentTlsfAllocator::Destroy(allocator);
+    }
+}
@@ -0,0 +1,189 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <random>
+#include <gtest/gtest.h>
+#include <EASTL/hash_map.h>
+#include <KryneEngine/Core/Memory/Containers/FlatHashMap.inl>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(FlatHashMap, InsertFindErase)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        FlatHashMap<u64, u64> map;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        EXPECT_TRUE(map.Empty());
+        EXPECT_EQ(map.Find(42), map.end());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.Erase(42));
+
+        constexpr u64 count = 10'000;
+        for (u64 i = 0; i < count; i++)
+        {
+            const auto [it, inserted] = map.Insert(i, i * 3);
+            EXPECT_TRUE(inserted);
+            EXPECT_EQ(it->first, i);
+        }
+        EXPECT_EQ(map.Size(), count);
+        EXPECT_LE(map.Size(), map.Capacity() - map.Capacity() / 8);
+
+        // Existing keys are left untouched
+        const auto [it, inserted] = map.Insert(5, 0);
+        EXPECT_FALSE(inserted);
+        EXPECT_EQ(it->second, 15);
+
+        for (u64 i = 0; i < count; i++)
+        {
+            const auto found = map.Find(i);
+            ASSERT_NE(found, map.end());
+            EXPECT_EQ(found->second, i * 3);
+        }
+        EXPECT_FALSE(map.Contains(count));
+
+        for (u64 i = 0; i < count; i += 2)
+        {
+            EXPECT_TRUE(map.Erase(i));
+        }
+        EXPECT_EQ(map.Size(), count / 2);
+
+        u64 visited = 0;
+        for (const auto& [key, value]: map)
+        {
+            EXPECT_EQ(key % 2, 1);
+            EXPECT_EQ(value, key * 3);
+            visited++;
+        }
+        EXPECT_EQ(visited, count / 2);
+
+        map[1] = 7;
+        EXPECT_EQ(map.Find(1)->second, 7);
+        EXPECT_EQ(map[count], 0);
+
+        map.Clear();
+        EXPECT_TRUE(map.Empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.Contains(1));
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FlatHashMap, RandomOperations)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        FlatHashMap<u64, u32> map;
+        eastl::hash_map<u64, u32> reference;
+
+        // Small key range, so erases and re-inserts keep hitting tombstones
+        std::mt19937_64 random(0x5eed);
+        constexpr u64 keyRange = 2048;
+        constexpr u32 operationCount = 200'000;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (u32 i = 0; i < operationCount; i++)
+        {
+            // Spread keys across the high bits as well, as with pointers or hashes.
+            const u64 key = (random() % keyRange) * 0x1000'0000'1;
+            if (random() % 3 == 0)
+            {
+                EXPECT_EQ(map.Erase(key), reference.erase(key) != 0);
+            }
+            else
+            {
+                EXPECT_EQ(map.Insert(key, i).second, reference.insert({ key, i }).second);
+            }
+        }
+
+        EXPECT_EQ(map.Size(), reference.size());
+        for (const auto& [key, value]: reference)
+        {
+            const auto found = map.Find(key);
+            ASSERT_NE(found, map.end());
+            EXPECT_EQ(found->second, value);
+        }
+
+        // Table only grew as much as needed for the live entries.
+        EXPECT_LE(map.Capacity(), 2 * keyRange - 1);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(FlatHashMap, CopyAndMove)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        struct Counted
+        {
+            explicit Counted(u32* _liveCount): m_liveCount(_liveCount) { (*m_liveCount)++; }
+            Counted(const Counted& _other): m_liveCount(_other.m_liveCount) { (*m_liveCount)++; }
+            ~Counted() { (*m_liveCount)--; }
+
+            u32* m_liveCount;
+        };
+
+        u32 liveCount = 0;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        {
+            FlatHashMap<u32, Counted> map;
+            map.Reserve(100);
+            const size_t capacity = map.Capacity();
+            for (u32 i = 0; i < 100; i++)
+            {
+                map.TryEmplace(i, &liveCount);
+            }
+            EXPECT_EQ(map.Capacity(), capacity);
+            EXPECT_EQ(liveCount, 100);
+
+            FlatHashMap<u32, Counted> copy(map);
+            EXPECT_EQ(copy.Size(), 100);
+            EXPECT_EQ(liveCount, 200);
+
+            FlatHashMap<u32, Counted> moved(eastl::move(copy));
+            EXPECT_TRUE(copy.Empty());
+            EXPECT_EQ(moved.Size(), 100);
+            EXPECT_TRUE(moved.Contains(99));
+            EXPECT_EQ(liveCount, 200);
+
+            moved.Erase(moved.Find(0));
+            EXPECT_EQ(liveCount, 199);
+
+            map = moved;
+            EXPECT_EQ(map.Size(), 99);
+            EXPECT_FALSE(map.Contains(0));
+            EXPECT_EQ(liveCount, 198);
+        }
+        EXPECT_EQ(liveCount, 0);
+
+        catcher.ExpectNoMessage();
+    }
+}
@@ -0,0 +1,214 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <KryneEngine/Core/Common/Utils/Alignment.hpp>
+#include <KryneEngine/Core/Memory/Allocators/FrameArenaAllocator.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(FrameArenaAllocator, BumpAllocation)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t regionSize = 64 * 1024;
+        FrameArenaAllocator* allocator = FrameArenaAllocator::Create(AllocatorInstance(), regionSize, 2, 0);
+        ASSERT_NE(allocator, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Consecutive small allocations are bumped from the same chunk.
+        auto* p0 = static_cast<std::byte*>(allocator->Allocate(24, 8));
+        auto* p1 = static_cast<std::byte*>(allocator->Allocate(8, 8));
+        auto* p2 = static_cast<std::byte*>(allocator->Allocate(40, 32));
+        EXPECT_EQ(p1, p0 + 24);
+        EXPECT_EQ(p2, p1 + 32 - 24);
+        EXPECT_EQ(allocator->GetStats().m_regionBytes, FrameArenaAllocator::kChunkSize);
+
+        // Default alignment
+        void* p3 = allocator->Allocate(1, 0);
+        EXPECT_TRUE(Alignment::IsAligned(reinterpret_cast<uintptr_t>(p3), FrameArenaAllocator::kDefaultAlignment));
+
+        // Large and over-aligned allocations are directly taken from the region.
+        void* p4 = allocator->Allocate(FrameArenaAllocator::kMaxSubArenaAllocationSize + 1, 8);
+        EXPECT_EQ(
+            allocator->GetStats().m_regionBytes,
+            FrameArenaAllocator::kChunkSize
+                + Alignment::AlignUp(FrameArenaAllocator::kMaxSubArenaAllocationSize + 1, FrameArenaAllocator::kChunkAlignment));
+        EXPECT_NE(p4, nullptr);
+
+        void* p5 = allocator->Allocate(16, 4096);
+        EXPECT_TRUE(Alignment::IsAligned<uintptr_t>(reinterpret_cast<uintptr_t>(p5), 4096));
+
+        // Freeing does nothing.
+        allocator->Free(p0, 24);
+        EXPECT_NE(allocator->Allocate(24, 8), p0);
+
+        EXPECT_EQ(allocator->GetStats().m_overflowBlockCount, 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        FrameArenaAllocator::Destroy(allocator);
+    }
+
+    TEST(FrameArenaAllocator, FrameBuffering)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t regionSize = 64 * 1024;
+        constexpr u8 frameCount = 3;
+        FrameArenaAllocator* allocator = FrameArenaAllocator::Create(AllocatorInstance(), regionSize, frameCount, 0);
+        ASSERT_NE(allocator, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Each frame gets its own region, and data stays untouched until the frame slot is reused.
+        u32* frameData[frameCount];
+        for (u8 frame = 0; frame < frameCount; frame++)
+        {
+            allocator->BeginFrame(frame);
+            EXPECT_EQ(allocator->GetStats().m_regionBytes, 0);
+
+            frameData[frame] = static_cast<u32*>(allocator->Allocate(sizeof(u32), alignof(u32)));
+            *frameData[frame] = frame;
+        }
+
+        for (u8 frame = 0; frame < frameCount; frame++)
+        {
+            EXPECT_EQ(*frameData[frame], frame);
+        }
+
+        // Reusing a frame slot resets its region.
+        allocator->BeginFrame(frameCount);
+        EXPECT_EQ(allocator->Allocate(sizeof(u32), alignof(u32)), frameData[0]);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        FrameArenaAllocator::Destroy(allocator);
+    }
+
+    TEST(FrameArenaAllocator, Overflow)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t regionSize = 64 * 1024;
+        FrameArenaAllocator* allocator = FrameArenaAllocator::Create(AllocatorInstance(), regionSize, 2, 0);
+        ASSERT_NE(allocator, nullptr);
+
+        constexpr size_t allocationSize = 8 * 1024;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Exhaust the region, then keep allocating from overflow blocks.
+        for (u32 i = 0; i < regionSize / allocationSize; i++)
+        {
+            EXPECT_NE(allocator->Allocate(allocationSize, 8), nullptr);
+        }
+        EXPECT_EQ(allocator->GetStats().m_regionBytes, regionSize);
+        EXPECT_EQ(allocator->GetStats().m_overflowBlockCount, 0);
+
+        for (u32 i = 0; i < 4; i++)
+        {
+            auto* p = static_cast<u8*>(allocator->Allocate(allocationSize, 8));
+            ASSERT_NE(p, nullptr);
+            memset(p, 0xcd, allocationSize);
+        }
+
+        FrameArenaAllocator::Stats stats = allocator->GetStats();
+        EXPECT_EQ(stats.m_regionBytes, regionSize);
+        EXPECT_EQ(stats.m_overflowBlockCount, 2);
+        EXPECT_EQ(stats.m_overflowBytes, regionSize / 2);
+        EXPECT_EQ(stats.m_highWaterBytes, regionSize + regionSize / 2);
+        EXPECT_EQ(stats.m_overflowedFrameCount, 1);
+
+        // Overflow blocks are released when the frame slot is reset, but high-water marks are kept.
+        allocator->BeginFrame(1);
+        allocator->BeginFrame(2);
+        stats = allocator->GetStats();
+        EXPECT_EQ(stats.m_regionBytes, 0);
+        EXPECT_EQ(stats.m_overflowBlockCount, 0);
+        EXPECT_EQ(stats.m_overflowBytes, 0);
+        EXPECT_EQ(stats.m_highWaterBytes, regionSize + regionSize / 2);
+        EXPECT_EQ(stats.m_highWaterOverflowBytes, regionSize / 2);
+        EXPECT_EQ(stats.m_overflowedFrameCount, 1);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        FrameArenaAllocator::Destroy(allocator);
+    }
+
+    TEST(FrameArenaAllocator, EastlContainer)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t regionSize = 64 * 1024;
+        FrameArenaAllocator* allocator = FrameArenaAllocator::Create(AllocatorInstance(), regionSize, 2, 0);
+        ASSERT_NE(allocator, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        {
+            const AllocatorInstance allocatorInstance(allocator);
+            eastl::vector<u64, AllocatorInstance> vector(allocatorInstance);
+            for (u64 i = 0; i < 1000; i++)
+            {
+                vector.push_back(i);
+            }
+            for (u64 i = 0; i < 1000; i++)
+            {
+                EXPECT_EQ(vector[i], i);
+            }
+        }
+        EXPECT_GT(allocator->GetStats().m_regionBytes, 1000 * sizeof(u64));
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        FrameArenaAllocator::Destroy(allocator);
+    }
+}
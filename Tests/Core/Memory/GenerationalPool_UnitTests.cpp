@@ -5,7 +5,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
+#include <EASTL/hash_map.h>
 #include <KryneEngine/Core/Memory/GenerationalPool.inl>
+#include <KryneEngine/Core/Threads/FibersManager.hpp>
 
 #include "Utils/AssertUtils.hpp"
 
@@ -120,4 +123,384 @@ namespace KryneEngine::Tests
             EXPECT_EQ(catcher.GetCaughtMessages().size(), expectedAssertCount);
         }
     }
+
+    TEST(GenerationalPool, DeferredFree)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        GenerationalPool<u32, u32> pool {{}};
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        const GenPool::Handle handle = pool.Allocate();
+        *pool.Get(handle) = 42;
+        *pool.GetCold(handle) = 43;
+
+        u32 hotCopy = 0;
+        u32 coldCopy = 0;
+        EXPECT_TRUE(pool.Free(handle, &hotCopy, &coldCopy));
+        EXPECT_EQ(hotCopy, 42);
+        EXPECT_EQ(coldCopy, 43);
+
+        // Stale handles are rejected right away
+        EXPECT_EQ(pool.Get(handle), nullptr);
+        EXPECT_FALSE(pool.Free(handle));
+
+        // Index is not reused before the deferred frees are flushed
+        const GenPool::Handle otherHandle = pool.Allocate();
+        EXPECT_NE(otherHandle.m_index, handle.m_index);
+
+        pool.FlushDeferredFrees();
+        const GenPool::Handle reusedHandle = pool.Allocate();
+        EXPECT_EQ(reusedHandle.m_index, handle.m_index);
+        EXPECT_EQ(reusedHandle.m_generation, handle.m_generation + 1);
+        EXPECT_NE(pool.Get(reusedHandle), nullptr);
+        EXPECT_EQ(pool.Get(handle), nullptr);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(GenerationalPool, BulkOperations)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        GenerationalPool<u32> pool {{}};
+
+        constexpr u32 handleCount = 100;
+        GenPool::Handle handles[handleCount];
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(pool.AllocateN(handles), handleCount);
+        EXPECT_EQ(pool.GetSize(), handleCount);
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            EXPECT_EQ(handles[i].m_index, i);
+            EXPECT_EQ(handles[i].m_generation, 0);
+            EXPECT_NE(pool.Get(handles[i]), nullptr);
+        }
+
+        // Only valid handles are freed
+        EXPECT_EQ(pool.FreeN({ handles, handleCount / 2 }), handleCount / 2);
+        EXPECT_EQ(pool.FreeN({ handles, handleCount / 2 }), 0);
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            EXPECT_EQ(pool.Get(handles[i]) == nullptr, i < handleCount / 2);
+        }
+
+        // Freed indices are reused after the flush, before growing the pool
+        pool.FlushDeferredFrees();
+        EXPECT_EQ(pool.AllocateN({ handles, handleCount / 2 }), handleCount / 2);
+        EXPECT_EQ(pool.GetSize(), handleCount);
+        for (u32 i = 0; i < handleCount / 2; i++)
+        {
+            EXPECT_LT(handles[i].m_index, handleCount / 2);
+            EXPECT_EQ(handles[i].m_generation, 1);
+        }
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(GenerationalPool, FiberThreadCaches)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // Fiber threads are pinned to a core each, so don't request more than the machine has.
+        FibersManager fibersManager(eastl::min<s32>(std::thread::hardware_concurrency(), 4), AllocatorInstance());
+
+        GenerationalPool<u32> pool {{}};
+
+        constexpr u32 jobCount = 16;
+        // Several refill batches per job, so fresh indices get reserved concurrently.
+        constexpr u32 allocationCount = GenerationalPool<u32>::kThreadCacheCapacity * 4;
+
+        struct JobData
+        {
+            GenerationalPool<u32>* m_pool;
+            u32 m_valueOffset;
+            eastl::vector<GenPool::Handle> m_live;
+            eastl::vector<u32> m_liveValues;
+            eastl::vector<GenPool::Handle> m_freed;
+        };
+
+        eastl::vector<JobData> jobs(jobCount);
+        for (u32 i = 0; i < jobCount; i++)
+        {
+            jobs[i].m_pool = &pool;
+        }
+
+        // Each job allocates handles from its fiber thread cache and writes a unique value in them, freeing one every
+        // other along the way.
+        constexpr auto allocateAndFreeJob = [](void* _userData)
+        {
+            auto* job = static_cast<JobData*>(_userData);
+            for (u32 i = 0; i < allocationCount; i++)
+            {
+                const GenPool::Handle handle = job->m_pool->Allocate();
+                u32* value = job->m_pool->Get(handle);
+                if (value == nullptr)
+                    continue;
+
+                *value = job->m_valueOffset + i;
+                if (i % 2 == 0 && job->m_pool->Free(handle))
+                {
+                    job->m_freed.push_back(handle);
+                }
+                else
+                {
+                    job->m_live.push_back(handle);
+                    job->m_liveValues.push_back(*value);
+                }
+            }
+        };
+
+        const auto runJobs = [&](u32 _round)
+        {
+            for (u32 i = 0; i < jobCount; i++)
+            {
+                jobs[i].m_valueOffset = (_round * jobCount + i) * allocationCount;
+                jobs[i].m_live.clear();
+                jobs[i].m_liveValues.clear();
+                jobs[i].m_freed.clear();
+            }
+            const SyncCounterId counter = fibersManager.InitAndBatchJobs(jobCount, allocateAndFreeJob, jobs.data());
+            fibersManager.WaitForCounterAndReset(counter);
+        };
+
+        // Checks that live handles have unique indices, and that they still hold the values written by their job.
+        eastl::hash_map<u32, GenPool::Handle> liveHandles;
+        const auto checkLiveHandles = [&](u32 _round)
+        {
+            for (u32 i = 0; i < jobCount; i++)
+            {
+                EXPECT_EQ(jobs[i].m_live.size(), allocationCount / 2);
+                EXPECT_EQ(jobs[i].m_freed.size(), allocationCount / 2);
+                for (u32 j = 0; j < jobs[i].m_live.size(); j++)
+                {
+                    const GenPool::Handle handle = jobs[i].m_live[j];
+                    EXPECT_TRUE(liveHandles.emplace(handle.m_index, handle).second)
+                        << "Index " << handle.m_index << " is used by two live handles";
+
+                    const u32* value = pool.Get(handle);
+                    ASSERT_NE(value, nullptr);
+                    EXPECT_EQ(*value, jobs[i].m_liveValues[j]) << "Round " << _round;
+                }
+                for (const GenPool::Handle& handle: jobs[i].m_freed)
+                {
+                    EXPECT_EQ(pool.Get(handle), nullptr);
+                }
+            }
+        };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        runJobs(0);
+        checkLiveHandles(0);
+
+        // Without a flush in between, freed indices can't be reused, even by the thread which freed them.
+        eastl::hash_map<u32, u32> freedGenerations;
+        for (const JobData& job: jobs)
+        {
+            for (const GenPool::Handle& handle: job.m_freed)
+            {
+                EXPECT_TRUE(liveHandles.find(handle.m_index) == liveHandles.end());
+                EXPECT_TRUE(freedGenerations.emplace(handle.m_index, handle.m_generation).second);
+            }
+        }
+
+        // Indices freed in the first round are still pending in the thread caches, and are promoted after the flush.
+        pool.FlushDeferredFrees();
+        runJobs(1);
+        checkLiveHandles(1);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        u32 reusedCount = 0;
+        for (const JobData& job: jobs)
+        {
+            for (const GenPool::Handle& handle: job.m_live)
+            {
+                const auto it = freedGenerations.find(handle.m_index);
+                if (it != freedGenerations.end())
+                {
+                    EXPECT_EQ(handle.m_generation, it->second + 1);
+                    reusedCount++;
+                }
+                else
+                {
+                    EXPECT_EQ(handle.m_generation, 0);
+                }
+            }
+        }
+        EXPECT_GT(reusedCount, 0);
+        EXPECT_EQ(liveHandles.size(), jobCount * allocationCount);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(GenerationalPool, ForEachLive)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        GenerationalPool<u32, u32> pool {{}};
+
+        // Spans several segments, and several parallel ranges in the last one.
+        constexpr u32 handleCount = 20'000;
+        eastl::vector<GenPool::Handle> handles(handleCount);
+        EXPECT_EQ(pool.AllocateN(handles), handleCount);
+
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            *pool.Get(handles[i]) = i;
+            *pool.GetCold(handles[i]) = 2 * i;
+        }
+
+        // Keep one entry every 3
+        u32 expectedCount = 0;
+        u64 expectedSum = 0;
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            if (i % 3 == 0)
+            {
+                expectedCount++;
+                expectedSum += i;
+            }
+            else
+            {
+                EXPECT_TRUE(pool.Free(handles[i]));
+            }
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        u32 count = 0;
+        u64 sum = 0;
+        s64 previousIndex = -1;
+        pool.ForEachLive([&](GenPool::Handle _handle, u32& _hot, u32& _cold)
+        {
+            EXPECT_EQ(pool.Get(_handle), &_hot);
+            EXPECT_EQ(_cold, 2 * _hot);
+            EXPECT_GT(static_cast<s64>(_handle.m_index), previousIndex);
+            previousIndex = _handle.m_index;
+            count++;
+            sum += _hot;
+        });
+        EXPECT_EQ(count, expectedCount);
+        EXPECT_EQ(sum, expectedSum);
+
+        // Without a fibers manager, ranges are executed in the calling thread.
+        std::atomic<u32> parallelCount = 0;
+        std::atomic<u64> parallelSum = 0;
+        pool.ForEachLiveParallel(nullptr, [&](GenPool::Handle, u32& _hot, u32&)
+        {
+            parallelCount.fetch_add(1, std::memory_order_relaxed);
+            parallelSum.fetch_add(_hot, std::memory_order_relaxed);
+        });
+        EXPECT_EQ(parallelCount.load(), expectedCount);
+        EXPECT_EQ(parallelSum.load(), expectedSum);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(GenerationalPool, ForEachLiveParallelOnFibers)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // Fiber threads are pinned to a core each, so don't request more than the machine has.
+        FibersManager fibersManager(eastl::min<s32>(std::thread::hardware_concurrency(), 4), AllocatorInstance());
+
+        GenerationalPool<u32, u32> pool {{}};
+
+        // Spans several segments, and several parallel ranges in the last one.
+        constexpr u32 handleCount = 40'000;
+        eastl::vector<GenPool::Handle> handles(handleCount);
+        EXPECT_EQ(pool.AllocateN(handles), handleCount);
+
+        u32 maxIndex = 0;
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            *pool.Get(handles[i]) = i;
+            *pool.GetCold(handles[i]) = 2 * i;
+            maxIndex = eastl::max(maxIndex, handles[i].m_index);
+        }
+
+        // Free whole ranges, as well as one entry every 3 in the others.
+        eastl::vector<bool> live(maxIndex + 1, false);
+        u32 expectedCount = 0;
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            if ((i >= 10'000 && i < 20'000) || i % 3 == 1)
+            {
+                EXPECT_TRUE(pool.Free(handles[i]));
+            }
+            else
+            {
+                live[handles[i].m_index] = true;
+                expectedCount++;
+            }
+        }
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<std::atomic<u32>> visitCounts(maxIndex + 1);
+        std::atomic<u32> mismatchCount = 0;
+        pool.ForEachLiveParallel(&fibersManager, [&](GenPool::Handle _handle, u32& _hot, u32& _cold)
+        {
+            if (_handle.m_index > maxIndex || pool.Get(_handle) != &_hot || _cold != 2 * _hot)
+            {
+                mismatchCount.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            visitCounts[_handle.m_index].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(mismatchCount.load(), 0);
+
+        u32 visitedCount = 0;
+        for (u32 index = 0; index <= maxIndex; index++)
+        {
+            const u32 visits = visitCounts[index].load(std::memory_order_relaxed);
+            EXPECT_EQ(visits, live[index] ? 1 : 0) << "Index " << index;
+            visitedCount += visits;
+        }
+        EXPECT_EQ(visitedCount, expectedCount);
+
+        catcher.ExpectNoMessage();
+    }
 }
@@ -0,0 +1,368 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <thread>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <KryneEngine/Core/Memory/Allocators/Allocator.hpp>
+#include <KryneEngine/Core/Memory/Allocators/HeapSamplingProfiler.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+#if defined(_MSC_VER)
+#   define KE_TEST_NOINLINE __declspec(noinline)
+#else
+#   define KE_TEST_NOINLINE __attribute__((noinline))
+#endif
+
+namespace KryneEngine::Tests
+{
+    namespace
+    {
+        using Profiler = HeapSamplingProfiler;
+
+        // Big enough compared to the test sampling interval to always be sampled, with a weight of 1.
+        constexpr size_t kBigBlockSize = 1024 * 1024;
+        constexpr size_t kTestSamplingInterval = 4 * 1024;
+
+        // Allocations are only registered, so any unique address works.
+        void* MakeFakePointer(size_t _index)
+        {
+            return reinterpret_cast<void*>(0x1000'0000 + _index * 16);
+        }
+
+        // The first sampling point of a thread only seeds its generator, and is never sampled.
+        void SeedThread(Profiler& _profiler)
+        {
+            _profiler.RegisterAllocation(nullptr, 0);
+        }
+
+        // Different constants, so the functions can't be folded together by the linker.
+        KE_TEST_NOINLINE void AllocateFromSiteA(Profiler& _profiler, void* _ptr)
+        {
+            _profiler.RegisterAllocation(_ptr, kBigBlockSize);
+        }
+
+        KE_TEST_NOINLINE void AllocateFromSiteB(Profiler& _profiler, void* _ptr)
+        {
+            _profiler.RegisterAllocation(_ptr, 2 * kBigBlockSize);
+        }
+
+        const Profiler::SiteReport* FindSite(const Profiler::Report& _report, u64 _siteHash)
+        {
+            const auto it = eastl::find_if(
+                _report.m_sites.begin(),
+                _report.m_sites.end(),
+                [_siteHash](const auto& _site) { return _site.m_siteHash == _siteHash; });
+            return it == _report.m_sites.end() ? nullptr : &*it;
+        }
+    }
+
+    TEST(HeapSamplingProfiler, PoissonInterval)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        Profiler profiler { kTestSamplingInterval };
+        SeedThread(profiler);
+
+        constexpr size_t blockSize = 64;
+        constexpr size_t blockCount = 100'000;
+        constexpr size_t totalSize = blockSize * blockCount;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            profiler.RegisterAllocation(MakeFakePointer(i), blockSize);
+        }
+
+        const Profiler::Report report = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        // ~1560 samples expected, so the standard deviation is around 2.5%.
+        constexpr double expectedSampleCount = static_cast<double>(totalSize) / kTestSamplingInterval;
+        EXPECT_NEAR(static_cast<double>(report.m_sampleCount), expectedSampleCount, 0.1 * expectedSampleCount);
+        EXPECT_NEAR(static_cast<double>(report.m_allocatedBytes), totalSize, 0.1 * totalSize);
+        EXPECT_NEAR(static_cast<double>(report.m_liveBytes), totalSize, 0.1 * totalSize);
+
+        // Allocations bigger than the interval are always sampled, and weighted as a single allocation.
+        for (size_t i = 0; i < 100; i++)
+        {
+            profiler.RegisterAllocation(MakeFakePointer(blockCount + i), kBigBlockSize);
+        }
+        const Profiler::Report bigReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+        EXPECT_EQ(bigReport.m_sampleCount - report.m_sampleCount, 100);
+        ASSERT_EQ(bigReport.m_sites.size(), 2); // Small allocations site is kept for its live allocations
+        EXPECT_EQ(bigReport.m_sites.front().m_allocatedCount, 100);
+        EXPECT_EQ(bigReport.m_sites.front().m_allocatedBytes, 100 * kBigBlockSize);
+
+        // No sample once disabled.
+        profiler.SetSamplingInterval(0);
+        for (size_t i = 0; i < 100; i++)
+        {
+            profiler.RegisterAllocation(MakeFakePointer(blockCount + 100 + i), kBigBlockSize);
+        }
+        EXPECT_EQ(profiler.TakeReport(Profiler::ReportType::AllocationRate).m_sampleCount, bigReport.m_sampleCount);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(HeapSamplingProfiler, SiteGrouping)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        Profiler profiler { kTestSamplingInterval };
+        SeedThread(profiler);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        size_t pointerIndex = 0;
+        for (size_t i = 0; i < 10; i++)
+        {
+            AllocateFromSiteA(profiler, MakeFakePointer(pointerIndex++));
+        }
+        for (size_t i = 0; i < 20; i++)
+        {
+            AllocateFromSiteB(profiler, MakeFakePointer(pointerIndex++));
+        }
+
+        const Profiler::Report report = profiler.TakeReport(Profiler::ReportType::LiveHeap);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        // Sorted by live bytes.
+        ASSERT_EQ(report.m_sites.size(), 2);
+        const Profiler::SiteReport& siteB = report.m_sites[0];
+        const Profiler::SiteReport& siteA = report.m_sites[1];
+
+        EXPECT_NE(siteA.m_siteHash, siteB.m_siteHash);
+        EXPECT_GT(siteA.m_callstackDepth, 0);
+        EXPECT_GT(siteB.m_callstackDepth, 0);
+
+        EXPECT_EQ(siteA.m_liveCount, 10);
+        EXPECT_EQ(siteA.m_liveBytes, 10 * kBigBlockSize);
+        EXPECT_EQ(siteB.m_liveCount, 20);
+        EXPECT_EQ(siteB.m_liveBytes, 40 * kBigBlockSize);
+        EXPECT_EQ(report.m_liveBytes, 50 * kBigBlockSize);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(HeapSamplingProfiler, PerThreadBuffers)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        Profiler profiler { kTestSamplingInterval };
+
+        constexpr size_t threadCount = 4;
+        // More than a buffer can hold, so buffers are also flushed while allocating.
+        constexpr size_t blockCountPerThread = 3 * Profiler::kThreadBufferCapacity;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        eastl::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&profiler, t]()
+            {
+                SeedThread(profiler);
+                for (size_t i = 0; i < blockCountPerThread; i++)
+                {
+                    const size_t index = t * blockCountPerThread + i;
+                    AllocateFromSiteA(profiler, MakeFakePointer(index));
+
+                    // Free half of the blocks from the allocating thread, some while still pending in its buffer.
+                    if (i % 2 == 1)
+                    {
+                        profiler.RegisterDeallocation(MakeFakePointer(index - 1));
+                    }
+                }
+            });
+        }
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        const Profiler::Report liveReport = profiler.TakeReport(Profiler::ReportType::LiveHeap, false);
+
+        // Free the rest from another thread, after their allocating threads exited.
+        for (size_t index = 1; index < threadCount * blockCountPerThread; index += 2)
+        {
+            profiler.RegisterDeallocation(MakeFakePointer(index));
+        }
+
+        const Profiler::Report rateReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+        const Profiler::Report lastReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        constexpr size_t blockCount = threadCount * blockCountPerThread;
+        EXPECT_EQ(liveReport.m_sampleCount, blockCount);
+        EXPECT_EQ(liveReport.m_allocatedBytes, blockCount * kBigBlockSize);
+        EXPECT_EQ(liveReport.m_liveBytes, blockCount / 2 * kBigBlockSize);
+
+        EXPECT_EQ(rateReport.m_sampleCount, blockCount);
+        EXPECT_EQ(rateReport.m_allocatedBytes, blockCount * kBigBlockSize);
+        EXPECT_EQ(rateReport.m_liveBytes, 0);
+
+        // Sites without live allocations are dropped once their allocation counters are reset.
+        EXPECT_TRUE(lastReport.m_sites.empty());
+        EXPECT_EQ(lastReport.m_allocatedBytes, 0);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(HeapSamplingProfiler, LiveHeapAndAllocationRate)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+        Profiler profiler { kTestSamplingInterval };
+        SeedThread(profiler);
+
+        constexpr size_t blockSize = 1024;
+        constexpr size_t blockCount = 16 * 1024;
+        constexpr size_t totalSize = blockSize * blockCount;
+
+        // -----------------------------------------------------------------------
+        // Execute & Verify
+        // -----------------------------------------------------------------------
+
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            profiler.RegisterAllocation(MakeFakePointer(i), blockSize);
+        }
+
+        // Estimation error is around 2% at this sample count.
+        const Profiler::Report liveReport = profiler.TakeReport(Profiler::ReportType::LiveHeap, false);
+        ASSERT_EQ(liveReport.m_sites.size(), 1);
+        const Profiler::SiteReport site = liveReport.m_sites.front();
+        EXPECT_NEAR(static_cast<double>(site.m_liveBytes), totalSize, 0.15 * totalSize);
+        EXPECT_NEAR(static_cast<double>(site.m_liveCount), blockCount, 0.15 * blockCount);
+        EXPECT_EQ(site.m_allocatedBytes, site.m_liveBytes);
+
+        // Free every other block.
+        for (size_t i = 0; i < blockCount; i += 2)
+        {
+            profiler.RegisterDeallocation(MakeFakePointer(i));
+        }
+
+        const Profiler::Report rateReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+        const Profiler::SiteReport* rateSite = FindSite(rateReport, site.m_siteHash);
+        ASSERT_NE(rateSite, nullptr);
+        EXPECT_NEAR(static_cast<double>(rateSite->m_liveBytes), totalSize / 2, 0.15 * totalSize);
+        EXPECT_EQ(rateSite->m_allocatedBytes, site.m_allocatedBytes);
+        EXPECT_GT(rateReport.m_durationSeconds, 0);
+
+        // Allocation counters were reset, but the site is kept for its live allocations.
+        const Profiler::Report resetReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+        const Profiler::SiteReport* resetSite = FindSite(resetReport, site.m_siteHash);
+        ASSERT_NE(resetSite, nullptr);
+        EXPECT_EQ(resetSite->m_allocatedBytes, 0);
+        EXPECT_EQ(resetSite->m_liveBytes, rateSite->m_liveBytes);
+
+        // Dropped once all its allocations are freed, at the next counters reset.
+        for (size_t i = 1; i < blockCount; i += 2)
+        {
+            profiler.RegisterDeallocation(MakeFakePointer(i));
+        }
+        const Profiler::Report freedReport = profiler.TakeReport(Profiler::ReportType::AllocationRate);
+        EXPECT_EQ(freedReport.m_liveBytes, 0);
+        EXPECT_EQ(FindSite(profiler.TakeReport(Profiler::ReportType::AllocationRate), site.m_siteHash), nullptr);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(HeapSamplingProfiler, DefaultHeapHook)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        Profiler* profiler = AllocatorInstance::GetDefaultHeapProfiler();
+        if (profiler == nullptr)
+        {
+            GTEST_SKIP() << "Default heap tracking is disabled";
+        }
+
+        ScopedAssertCatcher catcher;
+
+        const size_t previousInterval = profiler->GetSamplingInterval();
+        profiler->SetSamplingInterval(kTestSamplingInterval);
+
+        constexpr size_t blockSize = 1024;
+        constexpr size_t blockCount = 16 * 1024;
+        constexpr size_t totalSize = blockSize * blockCount;
+
+        eastl::vector<void*> blocks;
+        blocks.reserve(blockCount);
+
+        // Start from a clean allocation rate
+        (void)profiler->TakeReport(Profiler::ReportType::AllocationRate);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        const AllocatorInstance allocator {};
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            blocks.push_back(allocator.allocate(blockSize));
+        }
+
+        const Profiler::Report liveReport = profiler->TakeReport(Profiler::ReportType::LiveHeap, false);
+        ASSERT_FALSE(liveReport.m_sites.empty());
+
+        // All blocks come from the same site, which is the biggest one.
+        const Profiler::SiteReport& site = liveReport.m_sites.front();
+        EXPECT_GT(site.m_callstackDepth, 0);
+        EXPECT_NEAR(static_cast<double>(site.m_liveBytes), static_cast<double>(totalSize), 0.15 * totalSize);
+
+        for (void* block: blocks)
+        {
+            allocator.deallocate(block);
+        }
+
+        const Profiler::Report rateReport = profiler->TakeReport(Profiler::ReportType::AllocationRate);
+        const Profiler::SiteReport* freedSite = FindSite(rateReport, site.m_siteHash);
+        ASSERT_NE(freedSite, nullptr);
+        EXPECT_EQ(freedSite->m_liveBytes, 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        profiler->SetSamplingInterval(previousInterval);
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <gtest/gtest.h>
+#include <KryneEngine/Core/Common/Utils/Alignment.hpp>
+#include <KryneEngine/Core/Memory/Allocators/HugePageAllocator.hpp>
+#include <KryneEngine/Core/Memory/Allocators/TlsfAllocator.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(HugePageAllocator, AllocateFree)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        HugePageAllocator* allocator = HugePageAllocator::Create(AllocatorInstance());
+        ASSERT_NE(allocator, nullptr);
+
+        constexpr size_t hugePageSize = HugePageAllocator::kHugePageSize;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Allocations under the threshold are forwarded to the parent allocator
+        void* small = allocator->Allocate(1024, 16);
+        EXPECT_NE(small, nullptr);
+        EXPECT_EQ(allocator->GetStats().m_mappedBytes, 0);
+        allocator->Free(small, 1024);
+
+        // Bigger allocations are mapped to whole huge pages, whether reserved huge pages are available or not.
+        auto* big = static_cast<u8*>(allocator->Allocate(hugePageSize + 1, 64));
+        ASSERT_NE(big, nullptr);
+        EXPECT_TRUE(Alignment::IsAligned<uintptr_t>(reinterpret_cast<uintptr_t>(big), hugePageSize));
+        memset(big, 0xab, hugePageSize + 1);
+
+        HugePageAllocator::Stats stats = allocator->GetStats();
+        EXPECT_EQ(stats.m_mappedBytes, 2 * hugePageSize);
+        // Regular pages are only counted as transparent huge pages when the kernel accepted the advice.
+        EXPECT_TRUE(stats.m_hugePageCount == 0 || stats.m_hugePageCount == 2);
+        EXPECT_TRUE(stats.m_transparentHugePageCount == 0 || stats.m_transparentHugePageCount == 2);
+        EXPECT_EQ(stats.m_fallbackCount, stats.m_hugePageCount == 0 ? 1 : 0);
+
+        // Mappings are tracked, so they can be freed without a size
+        allocator->Free(big, 0);
+        stats = allocator->GetStats();
+        EXPECT_EQ(stats.m_mappedBytes, 0);
+        EXPECT_EQ(stats.m_hugePageCount + stats.m_transparentHugePageCount, 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        HugePageAllocator::Destroy(allocator);
+    }
+
+    TEST(HugePageAllocator, TlsfParent)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        HugePageAllocator* pageAllocator = HugePageAllocator::Create(
+            AllocatorInstance(),
+            HugePageAllocator::kHugePageSize,
+            HugePageAllocator::Mode::Transparent);
+        ASSERT_NE(pageAllocator, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        constexpr size_t heapSize = 4 * HugePageAllocator::kHugePageSize;
+        TlsfAllocator* tlsf = TlsfAllocator::Create(AllocatorInstance(pageAllocator), heapSize);
+        ASSERT_NE(tlsf, nullptr);
+
+        const HugePageAllocator::Stats stats = pageAllocator->GetStats();
+        EXPECT_EQ(stats.m_mappedBytes, heapSize);
+        EXPECT_EQ(stats.m_hugePageCount, 0);
+        // Depends on whether the platform supports transparent huge pages.
+        EXPECT_TRUE(stats.m_transparentHugePageCount == 0 || stats.m_transparentHugePageCount == 4);
+        EXPECT_EQ(stats.m_fallbackCount, 0);
+
+        void* ptr = tlsf->Allocate(1024 * 1024, 0);
+        EXPECT_NE(ptr, nullptr);
+        tlsf->Free(ptr, 1024 * 1024);
+
+        TlsfAllocator::Destroy(tlsf);
+        EXPECT_EQ(pageAllocator->GetStats().m_mappedBytes, 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        HugePageAllocator::Destroy(pageAllocator);
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <gtest/gtest.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Memory/SimplePool.inl>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(SimplePool, ForEachLive)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        SimplePool<u32, u64> pool { AllocatorInstance() };
+
+        // Grows the pool several times, with a partial last occupancy word.
+        constexpr u32 handleCount = 300;
+        eastl::vector<SimplePoolHandle> handles(handleCount);
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            handles[i] = pool.Allocate();
+            pool.Get(handles[i]) = i;
+            pool.GetCold(handles[i]) = 2 * i;
+        }
+
+        // Free all entries of some occupancy words, and one entry every 3 in the others.
+        eastl::vector<bool> live(handleCount, true);
+        for (u32 i = 0; i < handleCount; i++)
+        {
+            if ((i >= 64 && i < 192) || i % 3 == 0)
+            {
+                EXPECT_TRUE(pool.Free(handles[i]));
+                live[i] = false;
+            }
+        }
+
+        const auto checkLiveEntries = [&]
+        {
+            u32 visitedCount = 0;
+            s64 previousHandle = -1;
+            eastl::vector<bool> visited(handleCount, false);
+            pool.ForEachLive([&](SimplePoolHandle _handle, u32& _hot, u64& _cold)
+            {
+                EXPECT_GT(static_cast<s64>(_handle), previousHandle);
+                previousHandle = static_cast<s64>(_handle);
+
+                ASSERT_LT(_handle, handleCount);
+                EXPECT_TRUE(live[_handle]) << "Handle " << _handle << " is not allocated";
+                EXPECT_EQ(&_hot, &pool.Get(_handle));
+                EXPECT_EQ(_cold, 2ull * _hot);
+                visited[_handle] = true;
+                visitedCount++;
+            });
+
+            u32 liveCount = 0;
+            for (u32 i = 0; i < handleCount; i++)
+            {
+                liveCount += live[i] ? 1 : 0;
+                EXPECT_EQ(visited[i], live[i]) << "Handle " << i;
+            }
+            EXPECT_EQ(visitedCount, liveCount);
+        };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        checkLiveEntries();
+
+        // Freed entries are visited again once reallocated.
+        for (u32 i = 0; i < 50; i++)
+        {
+            const SimplePoolHandle handle = pool.Allocate();
+            ASSERT_LT(handle, handleCount);
+            EXPECT_FALSE(live[handle]);
+            live[handle] = true;
+            pool.Get(handle) = static_cast<u32>(handle);
+            pool.GetCold(handle) = 2 * handle;
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        checkLiveEntries();
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(SimplePool, ForEachLiveRefCounted)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        SimplePool<u32, void, true> pool { AllocatorInstance() };
+
+        const SimplePoolHandle first = pool.Allocate();
+        const SimplePoolHandle second = pool.Allocate();
+        pool.Get(first) = 1;
+        pool.Get(second) = 2;
+        EXPECT_EQ(pool.AddRef(second), 2);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Entries stay live until their last reference is released.
+        EXPECT_TRUE(pool.Free(first));
+        EXPECT_FALSE(pool.Free(second));
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        u32 visitedCount = 0;
+        pool.ForEachLive([&](SimplePoolHandle _handle, u32& _hot)
+        {
+            EXPECT_EQ(_handle, second);
+            EXPECT_EQ(_hot, 2);
+            visitedCount++;
+        });
+        EXPECT_EQ(visitedCount, 1);
+
+        EXPECT_TRUE(pool.Free(second));
+        pool.ForEachLive([&](SimplePoolHandle, u32&) { visitedCount++; });
+        EXPECT_EQ(visitedCount, 1);
+
+        catcher.ExpectNoMessage();
+    }
+}
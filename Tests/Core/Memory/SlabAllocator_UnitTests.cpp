@@ -0,0 +1,291 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <KryneEngine/Core/Common/Utils/Alignment.hpp>
+#include <KryneEngine/Core/Memory/Allocators/SlabAllocator.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(SlabAllocator, SizeClasses)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(SlabAllocator::GetSizeClass(1, 0), 0);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(16, 8), 0);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(17, 0), 1);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(256, 16), SlabAllocator::kSizeClassCount - 1);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(257, 0), SlabAllocator::kInvalidSizeClass);
+
+        // Aligned allocations use slots which size is a multiple of the alignment.
+        EXPECT_EQ(SlabAllocator::GetSlotSize(SlabAllocator::GetSizeClass(16, 64)), 64);
+        EXPECT_EQ(SlabAllocator::GetSlotSize(SlabAllocator::GetSizeClass(80, 32)), 96);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(240, 64), SlabAllocator::kSizeClassCount - 1);
+        EXPECT_EQ(SlabAllocator::GetSizeClass(16, 128), SlabAllocator::kInvalidSizeClass);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(SlabAllocator, AllocateFree)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 16 * SlabAllocator::kPageSize;
+        SlabAllocator* allocator = SlabAllocator::Create(AllocatorInstance(), heapSize, false);
+        ASSERT_NE(allocator, nullptr);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Same size class allocations are packed in the same page.
+        auto* p0 = static_cast<std::byte*>(allocator->Allocate(48, 0));
+        auto* p1 = static_cast<std::byte*>(allocator->Allocate(40, 8));
+        EXPECT_TRUE(allocator->Owns(p0));
+        EXPECT_EQ(p1, p0 + 48);
+        EXPECT_EQ(allocator->GetUsedPageCount(), 1);
+
+        // Freed slots are reused first.
+        allocator->Free(p0, 0);
+        EXPECT_EQ(allocator->Allocate(33, 16), p0);
+
+        // Other size classes get their own page.
+        void* p2 = allocator->Allocate(200, 0);
+        EXPECT_TRUE(allocator->Owns(p2));
+        EXPECT_EQ(allocator->GetUsedPageCount(), 2);
+
+        for (u32 alignment = 16; alignment <= SlabAllocator::kMaxSlotAlignment; alignment *= 2)
+        {
+            for (u32 size = 1; size <= SlabAllocator::kMaxSlotSize - alignment; size += 7)
+            {
+                void* p = allocator->Allocate(size, alignment);
+                EXPECT_TRUE(allocator->Owns(p));
+                EXPECT_TRUE(Alignment::IsAligned<uintptr_t>(reinterpret_cast<uintptr_t>(p), alignment));
+                allocator->Free(p, size);
+            }
+        }
+
+        // Allocations not fitting a size class are forwarded to the parent allocator.
+        void* p3 = allocator->Allocate(SlabAllocator::kMaxSlotSize + 1, 0);
+        EXPECT_FALSE(allocator->Owns(p3));
+        allocator->Free(p3, SlabAllocator::kMaxSlotSize + 1);
+        void* p4 = allocator->Allocate(16, 256);
+        EXPECT_FALSE(allocator->Owns(p4));
+        allocator->Free(p4, 16);
+
+        // Empty pages are released, except the last one of each size class.
+        allocator->Free(p0, 0);
+        allocator->Free(p1, 0);
+        allocator->Free(p2, 0);
+        EXPECT_LE(allocator->GetUsedPageCount(), SlabAllocator::kSizeClassCount);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        SlabAllocator::Destroy(allocator);
+    }
+
+    TEST(SlabAllocator, HeapExhaustion)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 2 * SlabAllocator::kPageSize;
+        SlabAllocator* allocator = SlabAllocator::Create(AllocatorInstance(), heapSize, false);
+        ASSERT_NE(allocator, nullptr);
+
+        constexpr size_t slotSize = 256;
+        constexpr u32 slotsPerPage = (SlabAllocator::kPageSize - 64) / slotSize;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Fill both pages, then overflow to the parent allocator.
+        eastl::vector<void*> pointers;
+        for (u32 i = 0; i < 2 * slotsPerPage + 10; i++)
+        {
+            pointers.push_back(allocator->Allocate(slotSize, 0));
+            EXPECT_EQ(allocator->Owns(pointers.back()), i < 2 * slotsPerPage);
+        }
+        EXPECT_EQ(allocator->GetUsedPageCount(), 2);
+
+        // Free all, pages go back to the free list.
+        for (void* p: pointers)
+        {
+            allocator->Free(p, slotSize);
+        }
+        EXPECT_EQ(allocator->GetUsedPageCount(), 1);
+
+        // Released pages can be used for another size class.
+        for (u32 i = 0; i < slotsPerPage * 2; i++)
+        {
+            EXPECT_TRUE(allocator->Owns(allocator->Allocate(128, 0)));
+        }
+        EXPECT_EQ(allocator->GetUsedPageCount(), 2);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        SlabAllocator::Destroy(allocator);
+    }
+
+    TEST(SlabAllocator, ThreadCaching)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 256 * SlabAllocator::kPageSize;
+        SlabAllocator* allocator = SlabAllocator::Create(AllocatorInstance(), heapSize, true);
+        ASSERT_NE(allocator, nullptr);
+
+        constexpr u32 threadCount = 4;
+        constexpr u32 iterationCount = 20'000;
+
+        struct Allocation
+        {
+            u8* m_ptr;
+            size_t m_size;
+        };
+
+        std::mutex sharedMutex;
+        eastl::vector<Allocation> shared;
+        std::atomic<u32> errorCount = 0;
+
+        const auto checkAndFree = [&](const Allocation& _allocation)
+        {
+            for (size_t i = 0; i < _allocation.m_size; i++)
+            {
+                if (_allocation.m_ptr[i] != static_cast<u8>(_allocation.m_size))
+                {
+                    errorCount++;
+                    break;
+                }
+            }
+            allocator->Free(_allocation.m_ptr, _allocation.m_size);
+        };
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Threads allocate, and free either their own slots or slots allocated by other threads.
+        const auto threadFunction = [&](u32 _seed)
+        {
+            std::mt19937 random(_seed);
+            eastl::vector<Allocation> owned;
+
+            for (u32 i = 0; i < iterationCount; i++)
+            {
+                if (random() % 3 != 0 || owned.empty())
+                {
+                    const size_t size = 1 + random() % SlabAllocator::kMaxSlotSize;
+                    auto* ptr = static_cast<u8*>(allocator->Allocate(size, 0));
+                    if (ptr == nullptr)
+                    {
+                        errorCount++;
+                        continue;
+                    }
+                    memset(ptr, static_cast<u8>(size), size);
+                    owned.push_back({ ptr, size });
+                }
+                else
+                {
+                    const size_t index = random() % owned.size();
+                    const Allocation allocation = owned[index];
+                    owned[index] = owned.back();
+                    owned.pop_back();
+
+                    if (random() % 2 == 0)
+                    {
+                        checkAndFree(allocation);
+                    }
+                    else
+                    {
+                        const auto lock = std::lock_guard(sharedMutex);
+                        shared.push_back(allocation);
+                    }
+                }
+
+                if (i % 256 == 0)
+                {
+                    eastl::vector<Allocation> taken;
+                    {
+                        const auto lock = std::lock_guard(sharedMutex);
+                        taken.swap(shared);
+                    }
+                    for (const Allocation& allocation: taken)
+                    {
+                        checkAndFree(allocation);
+                    }
+                }
+            }
+
+            for (const Allocation& allocation: owned)
+            {
+                checkAndFree(allocation);
+            }
+            allocator->FlushThreadCache();
+        };
+
+        eastl::vector<std::thread> threads;
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back(threadFunction, i);
+        }
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        for (const Allocation& allocation: shared)
+        {
+            checkAndFree(allocation);
+        }
+        allocator->FlushThreadCache();
+
+        EXPECT_EQ(errorCount.load(), 0);
+        EXPECT_LE(allocator->GetUsedPageCount(), SlabAllocator::kSizeClassCount);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        SlabAllocator::Destroy(allocator);
+    }
+}
@@ -5,6 +5,7 @@
  */
 
 #include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 #include <gtest/gtest.h>
 #include <KryneEngine/Core/Common/BitUtils.hpp>
 #include <KryneEngine/Core/Common/Utils/Alignment.hpp>
@@ -361,6 +362,51 @@ namespace KryneEngine::Tests
         TlsfAllocator::Destroy(allocator);
     }
 
+    TEST(TlsfAllocator, SmallAlignedAlloc)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 16 * 1024;
+        TlsfAllocator* allocator = TlsfAllocator::Create(AllocatorInstance(), heapSize);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Small allocations leave little room to trim the alignment gap, make sure it's still accounted for.
+        // Keep a few allocations alive in between, to get blocks starting at different offsets.
+        eastl::vector<void*> pointers;
+        for (size_t size = 1; size <= 64; size++)
+        {
+            for (u8 i = 4; i <= 6; i++)
+            {
+                const size_t alignment = 1 << i;
+                void* p = allocator->Allocate(size, alignment);
+                EXPECT_TRUE(Alignment::IsAligned(reinterpret_cast<uintptr_t>(p), alignment))
+                    << std::format("Pointer {:#x} is not aligned to {:#x}", reinterpret_cast<uintptr_t>(p), alignment);
+                pointers.push_back(p);
+            }
+            pointers.push_back(allocator->Allocate(size, 0));
+        }
+
+        for (void* p: pointers)
+        {
+            allocator->Free(p, 0);
+        }
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        TlsfAllocator::Destroy(allocator);
+    }
+
     TEST(TlsfAllocator, MultiHeapDestruction)
     {
         // -----------------------------------------------------------------------
@@ -431,4 +477,202 @@ namespace KryneEngine::Tests
 
         TlsfAllocator::Destroy(allocator);
     }
+
+    TEST(TlsfAllocator, TrimEmptyHeaps)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 8 * 1024;
+        TlsfAllocator* allocator = TlsfAllocator::Create(AllocatorInstance(), heapSize);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Block size that is big enough to warrant a new heap, even for the first allocation
+        constexpr size_t blockSize = 6 * 1024;
+
+        void* p0 = allocator->Allocate(blockSize, 0);
+        void* p1 = allocator->Allocate(blockSize, 0);
+        void* p2 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(allocator->GetHeapCount(), 4);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 0);
+        EXPECT_GE(allocator->GetUsedBytes(), 3 * blockSize);
+
+        allocator->Free(p1, blockSize);
+        allocator->Free(p2, blockSize);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 2);
+
+        // Heaps aren't released unless requested
+        EXPECT_EQ(allocator->GetHeapCount(), 4);
+
+        EXPECT_EQ(allocator->TrimEmptyHeaps(1), 1);
+        EXPECT_EQ(allocator->GetHeapCount(), 3);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 1);
+
+        // Kept empty heap is reused by the next allocation
+        p1 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(allocator->GetHeapCount(), 3);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 0);
+        allocator->Free(p1, blockSize);
+
+        EXPECT_EQ(allocator->TrimEmptyHeaps(0), 1);
+        EXPECT_EQ(allocator->GetHeapCount(), 2);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 0);
+
+        // The initial heap is never released
+        allocator->Free(p0, blockSize);
+        EXPECT_EQ(allocator->TrimEmptyHeaps(0), 1);
+        EXPECT_EQ(allocator->TrimEmptyHeaps(0), 0);
+        EXPECT_EQ(allocator->GetHeapCount(), 1);
+        EXPECT_EQ(allocator->GetUsedBytes(), 0);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        TlsfAllocator::Destroy(allocator);
+    }
+
+    TEST(TlsfAllocator, AutoTrim)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 8 * 1024;
+        TlsfAllocator* allocator = TlsfAllocator::Create(AllocatorInstance(), heapSize);
+        allocator->SetTrimPolicy({ .m_keptEmptyHeaps = 1, .m_autoTrimThreshold = 2 });
+
+        constexpr size_t blockSize = 6 * 1024;
+        constexpr u32 blockCount = 5;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        void* blocks[blockCount];
+        for (u32 i = 0; i < blockCount; i++)
+        {
+            blocks[i] = allocator->Allocate(blockSize, 0);
+            EXPECT_NE(blocks[i], nullptr);
+        }
+        EXPECT_EQ(allocator->GetHeapCount(), blockCount + 1);
+
+        allocator->Free(blocks[1], blockSize);
+        allocator->Free(blocks[2], blockSize);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 2);
+        EXPECT_EQ(allocator->GetHeapCount(), blockCount + 1);
+
+        // Going over the threshold trims down to the kept count
+        allocator->Free(blocks[3], blockSize);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 1);
+        EXPECT_EQ(allocator->GetHeapCount(), blockCount - 1);
+
+        allocator->SetTrimPolicy({ .m_keptEmptyHeaps = 0, .m_autoTrimThreshold = 1 });
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 1);
+        allocator->Free(blocks[4], blockSize);
+        EXPECT_EQ(allocator->GetEmptyHeapCount(), 0);
+        EXPECT_EQ(allocator->GetHeapCount(), 2);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        allocator->Free(blocks[0], blockSize);
+        TlsfAllocator::Destroy(allocator);
+    }
+    TEST(TlsfAllocator, Stats)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t heapSize = 16 * 1024;
+        TlsfAllocator* allocator = TlsfAllocator::Create(AllocatorInstance(), heapSize);
+        allocator->SetAutoGrowth(false);
+
+        u32 budgetCallbackCount = 0;
+        allocator->GetTracker()->SetBudget(
+            2 * 1024 + 512,
+            [](const AllocatorTracker&, size_t, void* _userData) { (*static_cast<u32*>(_userData))++; },
+            &budgetCallbackCount);
+
+        constexpr size_t blockSize = 1024;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        AllocatorStats stats {};
+        EXPECT_TRUE(allocator->GetAllocatorStats(stats));
+        EXPECT_EQ(stats.m_bytesInUse, 0);
+        EXPECT_GT(stats.m_totalFreeBytes, 0);
+        EXPECT_EQ(stats.m_totalFreeBytes, stats.m_largestFreeBlock);
+        EXPECT_FLOAT_EQ(stats.GetFragmentation(), 0.f);
+        const size_t initialFreeBytes = stats.m_totalFreeBytes;
+
+        void* p0 = allocator->Allocate(blockSize, 0);
+        void* p1 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(budgetCallbackCount, 0);
+        void* p2 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(budgetCallbackCount, 1);
+
+        // Callback isn't called again while staying over the budget.
+        void* p3 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(budgetCallbackCount, 1);
+        allocator->Free(p3, blockSize);
+
+        EXPECT_TRUE(allocator->GetAllocatorStats(stats));
+        EXPECT_EQ(stats.m_allocationCount, 3);
+        EXPECT_EQ(stats.m_totalAllocationCount, 4);
+        EXPECT_EQ(stats.m_bytesInUse, allocator->GetUsedBytes());
+        EXPECT_GE(stats.m_bytesInUse, 3 * blockSize);
+
+        // Freeing the middle block leaves a hole which can't be merged with the remaining free space.
+        allocator->Free(p1, blockSize);
+        EXPECT_TRUE(allocator->GetAllocatorStats(stats));
+        EXPECT_EQ(stats.m_allocationCount, 2);
+        EXPECT_EQ(stats.m_totalAllocationCount, 4);
+        EXPECT_GT(stats.m_peakBytesInUse, stats.m_bytesInUse);
+        EXPECT_LT(stats.m_largestFreeBlock, stats.m_totalFreeBytes);
+        EXPECT_GT(stats.GetFragmentation(), 0.f);
+
+        // Usage went back under the budget, so going over it again calls the callback.
+        p1 = allocator->Allocate(blockSize, 0);
+        EXPECT_EQ(budgetCallbackCount, 2);
+
+        EXPECT_EQ(allocator->Allocate(heapSize, 0), nullptr);
+        EXPECT_TRUE(allocator->GetAllocatorStats(stats));
+        EXPECT_EQ(stats.m_failedAllocationCount, 1);
+
+        allocator->Free(p0, blockSize);
+        allocator->Free(p1, blockSize);
+        allocator->Free(p2, blockSize);
+        EXPECT_TRUE(allocator->GetAllocatorStats(stats));
+        EXPECT_EQ(stats.m_bytesInUse, 0);
+        EXPECT_EQ(stats.m_allocationCount, 0);
+        EXPECT_EQ(stats.m_totalFreeBytes, initialFreeBytes);
+        EXPECT_FLOAT_EQ(stats.GetFragmentation(), 0.f);
+
+        catcher.ExpectNoMessage();
+
+        // -----------------------------------------------------------------------
+        // Teardown
+        // -----------------------------------------------------------------------
+
+        TlsfAllocator::Destroy(allocator);
+    }
 }
\ No newline at end of file
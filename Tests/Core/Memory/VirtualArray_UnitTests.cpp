@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <gtest/gtest.h>
+#include <KryneEngine/Core/Memory/Containers/VirtualArray.inl>
+#include <KryneEngine/Core/Platform/VirtualMemory.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(VirtualArray, PushBack)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr size_t maxCount = 1 << 20;
+        VirtualArray<u64> array(maxCount, VirtualMemory::GetPageSize());
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        EXPECT_TRUE(array.Empty());
+        EXPECT_EQ(array.Capacity(), 0);
+        EXPECT_GE(array.MaxSize(), maxCount);
+
+        u64& first = array.PushBack(0);
+        const u64* data = array.Data();
+        EXPECT_EQ(array.Capacity(), VirtualMemory::GetPageSize() / sizeof(u64));
+
+        constexpr u64 count = 100'000;
+        for (u64 i = 1; i < count; i++)
+        {
+            EXPECT_EQ(array.EmplaceBack(i), i);
+        }
+
+        // Growth never moves the elements
+        EXPECT_EQ(array.Data(), data);
+        EXPECT_EQ(&array[0], &first);
+        EXPECT_EQ(array.Size(), count);
+        EXPECT_GE(array.Capacity(), count);
+
+        u64 index = 0;
+        for (const u64 value : array)
+        {
+            EXPECT_EQ(value, index++);
+        }
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(VirtualArray, Shrink)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        const size_t granularity = VirtualMemory::GetPageSize();
+        const size_t countPerChunk = granularity / sizeof(u32);
+        VirtualArray<u32> array(countPerChunk * 64, granularity);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        array.Resize(countPerChunk * 16);
+        EXPECT_EQ(array.GetCommittedBytes(), granularity * 16);
+        for (u32 i = 0; i < array.Size(); i++)
+        {
+            array[i] = i + 1;
+        }
+
+        // One chunk of slack is kept past the size
+        array.Resize(countPerChunk * 4);
+        EXPECT_EQ(array.GetCommittedBytes(), granularity * 5);
+        EXPECT_EQ(array[countPerChunk * 4 - 1], countPerChunk * 4);
+
+        array.PopBack();
+        EXPECT_EQ(array.GetCommittedBytes(), granularity * 5);
+
+        array.ShrinkToFit();
+        EXPECT_EQ(array.GetCommittedBytes(), granularity * 4);
+
+        // Decommitted pages come back zeroed
+        array.Resize(countPerChunk * 8);
+        EXPECT_EQ(array[countPerChunk * 4 - 2], countPerChunk * 4 - 1);
+        for (size_t i = countPerChunk * 4; i < array.Size(); i++)
+        {
+            EXPECT_EQ(array[i], 0);
+        }
+
+        array.Clear();
+        EXPECT_TRUE(array.Empty());
+        EXPECT_EQ(array.GetCommittedBytes(), granularity);
+
+        // Going over the reservation fails
+        EXPECT_FALSE(array.Reserve(array.MaxSize() + 1));
+        EXPECT_EQ(catcher.GetCaughtMessages().size(), 1);
+    }
+}
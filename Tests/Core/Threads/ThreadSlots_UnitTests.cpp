@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#include <atomic>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <KryneEngine/Core/Threads/ThreadSlots.hpp>
+
+#include "Utils/AssertUtils.hpp"
+
+namespace KryneEngine::Tests
+{
+    TEST(ThreadSlots, UniqueAmongLiveThreads)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr u32 threadCount = Threads::kMaxThreadSlots + 8;
+        std::atomic<u32> readyCount = 0;
+        std::atomic<bool> release = false;
+        eastl::vector<u32> slots(threadCount, Threads::kNoThreadSlot);
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // All threads keep their slot until every thread tried to get one.
+        eastl::vector<std::thread> threads;
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back([&, i]
+            {
+                slots[i] = Threads::GetThreadSlot();
+                EXPECT_EQ(Threads::PeekThreadSlot(), slots[i]);
+                readyCount++;
+                while (!release.load())
+                {
+                    std::this_thread::yield();
+                }
+            });
+        }
+        while (readyCount.load() < threadCount)
+        {
+            std::this_thread::yield();
+        }
+        release = true;
+        for (std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        u64 usedSlots = 0;
+        u32 slotCount = 0;
+        for (const u32 slot: slots)
+        {
+            if (slot == Threads::kNoThreadSlot)
+                continue;
+
+            ASSERT_LT(slot, Threads::kMaxThreadSlots);
+            EXPECT_EQ(usedSlots & (1ull << slot), 0) << "Slot " << slot << " attributed twice";
+            usedSlots |= 1ull << slot;
+            slotCount++;
+        }
+        EXPECT_EQ(slotCount, Threads::kMaxThreadSlots);
+
+        catcher.ExpectNoMessage();
+    }
+
+    TEST(ThreadSlots, RecycledOnThreadExit)
+    {
+        // -----------------------------------------------------------------------
+        // Setup
+        // -----------------------------------------------------------------------
+
+        ScopedAssertCatcher catcher;
+
+        constexpr u32 threadCount = Threads::kMaxThreadSlots * 4;
+        u32 failedCount = 0;
+
+        // -----------------------------------------------------------------------
+        // Execute
+        // -----------------------------------------------------------------------
+
+        // Sequential threads must never run out of slots, as each one gives its slot back when exiting.
+        for (u32 i = 0; i < threadCount; i++)
+        {
+            std::thread thread([&]
+            {
+                if (Threads::GetThreadSlot() == Threads::kNoThreadSlot)
+                {
+                    failedCount++;
+                }
+            });
+            thread.join();
+        }
+
+        // -----------------------------------------------------------------------
+        // Verify
+        // -----------------------------------------------------------------------
+
+        EXPECT_EQ(failedCount, 0);
+
+        catcher.ExpectNoMessage();
+    }
+}
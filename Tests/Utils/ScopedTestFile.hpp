@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @author Max Godefroy
+ * @date 18/10/2026.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <KryneEngine/Core/Common/Types.hpp>
+
+namespace KryneEngine::Tests
+{
+    /// A file in the temporary directory, removed on construction and destruction.
+    class ScopedTestFile
+    {
+    public:
+        explicit ScopedTestFile(const char* _name)
+            : m_path((std::filesystem::temp_directory_path() / _name).string().c_str())
+        {
+            std::filesystem::remove(m_path.c_str());
+        }
+
+        ~ScopedTestFile()
+        {
+            std::filesystem::remove(m_path.c_str());
+        }
+
+        [[nodiscard]] const char* GetPath() const { return m_path.c_str(); }
+
+        [[nodiscard]] eastl::vector<u8> ReadContent() const
+        {
+            eastl::vector<u8> content;
+            FILE* file = fopen(m_path.c_str(), "rb");
+            if (file == nullptr)
+            {
+                return content;
+            }
+
+            u8 buffer[4096];
+            size_t read;
+            while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            {
+                content.insert(content.end(), buffer, buffer + read);
+            }
+            fclose(file);
+            return content;
+        }
+
+        void WriteContent(const eastl::vector<u8>& _content) const
+        {
+            FILE* file = fopen(m_path.c_str(), "wb");
+            if (file == nullptr)
+            {
+                return;
+            }
+            fwrite(_content.data(), 1, _content.size(), file);
+            fclose(file);
+        }
+
+    private:
+        eastl::string m_path;
+    };
+}